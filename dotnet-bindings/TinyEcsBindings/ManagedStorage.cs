@@ -449,6 +449,41 @@ public static unsafe class ManagedStorage
         return storage.AsSpan(0, count)!;
     }
 
+    /// <summary>
+    /// Get a Span over managed components of a chunk described by SpanIteration.ChunkBatch.
+    /// The chunk's storage handle comes from the batch, so there is no P/Invoke and no
+    /// per-element delegate transition.
+    /// </summary>
+    public static Span<T?> GetManagedSpan<T>(SpanIteration.ChunkBatch batch, int chunk, int component) where T : notnull
+    {
+        ref readonly var span = ref batch[chunk];
+        var chunkData = (IntPtr)span.columns[component];
+        if (chunkData == IntPtr.Zero || (span.custom_mask & (1u << component)) == 0)
+            return Span<T?>.Empty;
+
+        var handle = GCHandle.FromIntPtr(chunkData);
+        var storage = (ManagedComponentStorage<T>)handle.Target!;
+        return storage.AsSpan(0, span.count);
+    }
+
+    /// <summary>
+    /// Iterate every matched chunk with an unmanaged and a managed component, one P/Invoke per pass.
+    /// The batch must list the unmanaged component first.
+    /// </summary>
+    public static void ForEachChunk<T1, T2>(
+        SpanIteration.ChunkBatch batch,
+        TinyEcs.Query query,
+        Action<Span<T1>, Span<T2?>> action)
+        where T1 : unmanaged
+        where T2 : notnull
+    {
+        var count = batch.Fill(query);
+        for (int i = 0; i < count; i++)
+        {
+            action(batch.Column<T1>(i, 0), GetManagedSpan<T2>(batch, i, 1));
+        }
+    }
+
     /// <summary>
     /// Iterate over entities with mixed unmanaged and managed components using Span for unmanaged.
     /// More efficient than ForEachMixed when you need to process all components.
@@ -188,4 +188,123 @@ public static unsafe class SpanIteration
             }
         }
     }
+
+    /// <summary>
+    /// Pinned buffers for tecs_query_fill_chunks. One native call describes every matched
+    /// chunk, so a pass over the query costs a single P/Invoke instead of one per chunk
+    /// and column. Reuse an instance across frames to avoid reallocating.
+    /// </summary>
+    public sealed class ChunkBatch
+    {
+        private readonly ulong[] _components;
+        private TinyEcs.ChunkSpan[] _spans;
+        private IntPtr[] _columns;
+
+        public ChunkBatch(params TinyEcs.ComponentId[] components)
+        {
+            _components = new ulong[components.Length];
+            for (int i = 0; i < components.Length; i++)
+                _components[i] = components[i].Value;
+            _spans = GC.AllocateArray<TinyEcs.ChunkSpan>(16, pinned: true);
+            _columns = GC.AllocateArray<IntPtr>(16 * Math.Max(1, components.Length), pinned: true);
+        }
+
+        /// <summary>Chunks described by the last Fill</summary>
+        public int Count { get; private set; }
+
+        /// <summary>Describe every chunk matched by the query; grows the buffers if needed</summary>
+        public int Fill(TinyEcs.Query query)
+        {
+            var total = FillNative(query);
+            if (total > _spans.Length)
+            {
+                _spans = GC.AllocateArray<TinyEcs.ChunkSpan>(total * 2, pinned: true);
+                _columns = GC.AllocateArray<IntPtr>(total * 2 * Math.Max(1, _components.Length), pinned: true);
+                total = FillNative(query);
+            }
+            Count = Math.Max(total, 0);
+            return Count;
+        }
+
+        private int FillNative(TinyEcs.Query query)
+        {
+            fixed (ulong* ids = _components)
+            fixed (TinyEcs.ChunkSpan* spans = _spans)
+            fixed (IntPtr* columns = _columns)
+            {
+                return TinyEcs.tecs_query_fill_chunks(query, ids, _components.Length, spans,
+                                                      (void**)columns, _spans.Length);
+            }
+        }
+
+        public ref readonly TinyEcs.ChunkSpan this[int chunk] => ref _spans[chunk];
+
+        /// <summary>Entities of a chunk</summary>
+        public ReadOnlySpan<TinyEcs.Entity> Entities(int chunk)
+        {
+            ref readonly var span = ref _spans[chunk];
+            return new ReadOnlySpan<TinyEcs.Entity>(span.entities, span.count);
+        }
+
+        /// <summary>Native column of a chunk; empty for custom storage or missing components</summary>
+        public Span<T> Column<T>(int chunk, int component) where T : unmanaged
+        {
+            ref readonly var span = ref _spans[chunk];
+            var ptr = span.columns[component];
+            if (ptr == null || (span.custom_mask & (1u << component)) != 0)
+                return Span<T>.Empty;
+            return new Span<T>(ptr, span.count);
+        }
+    }
+
+    /// <summary>
+    /// Iterate every matched chunk with Span access for 1 component (one P/Invoke per pass)
+    /// </summary>
+    public static void ForEachChunk<T1>(
+        ChunkBatch batch,
+        TinyEcs.Query query,
+        Action<Span<T1>> action)
+        where T1 : unmanaged
+    {
+        var count = batch.Fill(query);
+        for (int i = 0; i < count; i++)
+        {
+            action(batch.Column<T1>(i, 0));
+        }
+    }
+
+    /// <summary>
+    /// Iterate every matched chunk with Span access for 2 components
+    /// </summary>
+    public static void ForEachChunk<T1, T2>(
+        ChunkBatch batch,
+        TinyEcs.Query query,
+        Action<Span<T1>, Span<T2>> action)
+        where T1 : unmanaged
+        where T2 : unmanaged
+    {
+        var count = batch.Fill(query);
+        for (int i = 0; i < count; i++)
+        {
+            action(batch.Column<T1>(i, 0), batch.Column<T2>(i, 1));
+        }
+    }
+
+    /// <summary>
+    /// Iterate every matched chunk with Span access for 3 components
+    /// </summary>
+    public static void ForEachChunk<T1, T2, T3>(
+        ChunkBatch batch,
+        TinyEcs.Query query,
+        Action<Span<T1>, Span<T2>, Span<T3>> action)
+        where T1 : unmanaged
+        where T2 : unmanaged
+        where T3 : unmanaged
+    {
+        var count = batch.Fill(query);
+        for (int i = 0; i < count; i++)
+        {
+            action(batch.Column<T1>(i, 0), batch.Column<T2>(i, 1), batch.Column<T3>(i, 2));
+        }
+    }
 }
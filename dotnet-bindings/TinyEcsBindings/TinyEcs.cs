@@ -69,13 +69,16 @@ public static unsafe class TinyEcs
         public bool IsNull => Value == 0;
     }
 
+    /// <summary>64-bit hash of the component name, matches tecs_component_id_t</summary>
     public readonly struct ComponentId
     {
-        public readonly uint Value;
+        public readonly ulong Value;
 
-        public ComponentId(uint value) => Value = value;
+        public ComponentId(ulong value) => Value = value;
 
-        public static readonly ComponentId Invalid = new(0xFFFFFFFF);
+        /// <summary>Returned by the native API for unknown or rejected names</summary>
+        public static readonly ComponentId Invalid = new(0);
+        public bool IsValid => Value != 0;
     }
 
     public readonly struct Tick
@@ -315,6 +318,24 @@ public static unsafe class TinyEcs
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern Tick* tecs_iter_added_ticks(QueryIter* iter, int index);
 
+    // ============================================================================
+    // Batched Chunk Iteration
+    // ============================================================================
+
+    /// <summary>One matched chunk (must match tecs_chunk_span_t)</summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ChunkSpan
+    {
+        public Entity* entities;            // tecs_entity_t*
+        public void** columns;              // One pointer per requested component
+        public int count;                   // int32_t
+        public uint custom_mask;            // Bit c set = columns[c] is custom storage data
+    }
+
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int tecs_query_fill_chunks(Query query, ulong* components, int componentCount,
+                                                    ChunkSpan* spans, void** columns, int capacity);
+
     // ============================================================================
     // Query Helper Methods
     // ============================================================================
@@ -8,6 +8,8 @@
  * - Camera system
  * - Particle effects
  * - System ordering
+ * - Pipelined rendering: a render sub-app with its own world draws frame N
+ *   on a separate thread while the main app simulates frame N+1
  */
 
 #define TINYECS_IMPLEMENTATION
@@ -130,6 +132,31 @@ typedef struct {
 } SpawnManager;
 tecs_component_id_t SpawnManager_id;
 
+/* Input sampled at the extract point, while the render thread is idle */
+typedef struct {
+    bool keys[KEY_KP_EQUAL + 1];
+    float frame_time;
+    bool should_close;
+} InputState;
+tecs_component_id_t InputState_id;
+
+/* Render-world view of the main app, filled by the extract step */
+typedef struct {
+    Camera3D camera;
+    GameStats stats;
+} RenderView;
+tecs_component_id_t RenderView_id;
+
+/* Component IDs in the render world */
+static tecs_component_id_t RenderTransform_id;
+static tecs_component_id_t RenderMesh_id;
+
+/* Keys forwarded to the simulation */
+static const int INPUT_KEYS[] = {
+    KEY_W, KEY_S, KEY_A, KEY_D, KEY_Q, KEY_E,
+    KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT, KEY_SPACE
+};
+
 /* ============================================================================
  * Helper Functions
  * ========================================================================= */
@@ -147,6 +174,19 @@ Vector3 TransformPoint(Vector3 point, Transform3D transform) {
     return Vector3Transform(point, mat);
 }
 
+/* Stamp a column as changed so the render extract picks it up */
+static void MarkColumnChanged(tbevy_system_ctx_t* ctx, tecs_query_iter_t* iter,
+                              tecs_component_id_t component_id) {
+    tecs_tick_t tick = tecs_world_tick(ctx->world);
+    tecs_tick_t* ticks = tecs_iter_changed_ticks(iter, tecs_iter_column_index(iter, component_id));
+    int count = tecs_iter_count(iter);
+    for (int i = 0; i < count; i++) ticks[i] = tick;
+}
+
+static bool KeyHeld(const InputState* input, int key) {
+    return input && input->keys[key];
+}
+
 /* ============================================================================
  * Game Systems
  * ========================================================================= */
@@ -177,6 +217,7 @@ static void movement_system(tbevy_system_ctx_t* ctx, void* user_data) {
             transforms[i].rotation = Vector3Add(transforms[i].rotation,
                 Vector3Scale(velocities[i].angular, time->delta_time));
         }
+        MarkColumnChanged(ctx, iter, Transform3D_id);
     }
 
     tecs_query_iter_free(iter);
@@ -188,6 +229,7 @@ static void player_input_system(tbevy_system_ctx_t* ctx, void* user_data) {
     (void)user_data;
 
     const TimeResource* time = TBEVY_CTX_GET_RESOURCE(ctx, TimeResource);
+    const InputState* input = TBEVY_CTX_GET_RESOURCE(ctx, InputState);
     if (!time) return;
 
 
@@ -212,24 +254,24 @@ static void player_input_system(tbevy_system_ctx_t* ctx, void* user_data) {
             velocities[i].linear = (Vector3){0};
             float speed = 15.0f;
 
-            if (IsKeyDown(KEY_W)) velocities[i].linear.z -= speed;
-            if (IsKeyDown(KEY_S)) velocities[i].linear.z += speed;
-            if (IsKeyDown(KEY_A)) velocities[i].linear.x -= speed;
-            if (IsKeyDown(KEY_D)) velocities[i].linear.x += speed;
-            if (IsKeyDown(KEY_Q)) velocities[i].linear.y -= speed;
-            if (IsKeyDown(KEY_E)) velocities[i].linear.y += speed;
+            if (KeyHeld(input, KEY_W)) velocities[i].linear.z -= speed;
+            if (KeyHeld(input, KEY_S)) velocities[i].linear.z += speed;
+            if (KeyHeld(input, KEY_A)) velocities[i].linear.x -= speed;
+            if (KeyHeld(input, KEY_D)) velocities[i].linear.x += speed;
+            if (KeyHeld(input, KEY_Q)) velocities[i].linear.y -= speed;
+            if (KeyHeld(input, KEY_E)) velocities[i].linear.y += speed;
 
             // Rotation controls (Arrow keys)
             velocities[i].angular = (Vector3){0};
             float rot_speed = 2.0f;
 
-            if (IsKeyDown(KEY_UP)) velocities[i].angular.x -= rot_speed;
-            if (IsKeyDown(KEY_DOWN)) velocities[i].angular.x += rot_speed;
-            if (IsKeyDown(KEY_LEFT)) velocities[i].angular.y += rot_speed;
-            if (IsKeyDown(KEY_RIGHT)) velocities[i].angular.y -= rot_speed;
+            if (KeyHeld(input, KEY_UP)) velocities[i].angular.x -= rot_speed;
+            if (KeyHeld(input, KEY_DOWN)) velocities[i].angular.x += rot_speed;
+            if (KeyHeld(input, KEY_LEFT)) velocities[i].angular.y += rot_speed;
+            if (KeyHeld(input, KEY_RIGHT)) velocities[i].angular.y -= rot_speed;
 
             // Fire weapon (SPACE)
-            if (IsKeyDown(KEY_SPACE) &&
+            if (KeyHeld(input, KEY_SPACE) &&
                 time->time - weapons[i].last_fired > 1.0f / weapons[i].fire_rate) {
 
                 weapons[i].last_fired = time->time;
@@ -373,6 +415,7 @@ static void turret_system(tbevy_system_ctx_t* ctx, void* user_data) {
                 }
             }
         }
+        MarkColumnChanged(ctx, iter, Transform3D_id);
     }
 
     tecs_query_iter_free(iter);
@@ -424,6 +467,8 @@ static void shield_system(tbevy_system_ctx_t* ctx, void* user_data) {
                 }
             }
         }
+        MarkColumnChanged(ctx, iter, Transform3D_id);
+        MarkColumnChanged(ctx, iter, MeshRenderer_id);
     }
 
     tecs_query_iter_free(iter);
@@ -602,6 +647,8 @@ static void particle_system(tbevy_system_ctx_t* ctx, void* user_data) {
             float alpha = particles[i].lifetime / particles[i].max_lifetime;
             renderers[i].color.a = (unsigned char)(alpha * 255);
         }
+        MarkColumnChanged(ctx, iter, Transform3D_id);
+        MarkColumnChanged(ctx, iter, MeshRenderer_id);
     }
 
     tecs_query_iter_free(iter);
@@ -718,19 +765,38 @@ static void camera_system(tbevy_system_ctx_t* ctx, void* user_data) {
     tecs_query_free(query);
 }
 
-/* Render system */
+/* ============================================================================
+ * Render Sub-App (runs on the render thread)
+ * ========================================================================= */
+
+/* Window lives on the render thread, which owns the GL context */
+static void render_startup_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)ctx;
+    (void)user_data;
+
+    InitWindow(1280, 720, "TinyECS + Raylib 3D - Space Shooter");
+    SetTargetFPS(-1);
+}
+
+static void render_shutdown(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)ctx;
+    (void)user_data;
+
+    CloseWindow();
+}
+
+/* Render system - draws the render world only */
 static void render_system(tbevy_system_ctx_t* ctx, void* user_data) {
     (void)user_data;
 
-    const CameraResource* cam_res = TBEVY_CTX_GET_RESOURCE(ctx, CameraResource);
-    const GameStats* stats = TBEVY_CTX_GET_RESOURCE(ctx, GameStats);
-    const TimeResource* time = TBEVY_CTX_GET_RESOURCE(ctx, TimeResource);
-    if (!cam_res) return;
+    const RenderView* view = TBEVY_CTX_GET_RESOURCE(ctx, RenderView);
+    if (!view) return;
+    const GameStats* stats = &view->stats;
 
     BeginDrawing();
     ClearBackground(BLACK);
 
-    BeginMode3D(cam_res->camera);
+    BeginMode3D(view->camera);
 
     // Draw grid
     DrawGrid(100, 5.0f);
@@ -739,15 +805,17 @@ static void render_system(tbevy_system_ctx_t* ctx, void* user_data) {
 
 
     tecs_query_t* query = tecs_query_new(ctx->world);
-    TECS_QUERY_WITH(query, Transform3D);
-    TECS_QUERY_WITH(query, MeshRenderer);
+    tecs_query_with(query, RenderTransform_id);
+    tecs_query_with(query, RenderMesh_id);
     tecs_query_build(query);
 
     tecs_query_iter_t* iter = tecs_query_iter(query);
     while (tecs_iter_next(iter)) {
         int count = tecs_iter_count(iter);
-        Transform3D* transforms = (Transform3D*)tecs_iter_column(iter, 0);
-        MeshRenderer* renderers = (MeshRenderer*)tecs_iter_column(iter, 1);
+        Transform3D* transforms = (Transform3D*)tecs_iter_column(iter,
+            tecs_iter_column_index(iter, RenderTransform_id));
+        MeshRenderer* renderers = (MeshRenderer*)tecs_iter_column(iter,
+            tecs_iter_column_index(iter, RenderMesh_id));
 
         for (int i = 0; i < count; i++) {
             Vector3 pos = transforms[i].position;
@@ -785,7 +853,7 @@ static void render_system(tbevy_system_ctx_t* ctx, void* user_data) {
     EndMode3D();
 
     // Draw UI
-    if (stats && time) {
+    if (stats) {
         DrawText(TextFormat("Score: %d", stats->score), 10, 10, 20, WHITE);
         DrawText(TextFormat("Kills: %d", stats->enemies_killed), 10, 35, 20, WHITE);
         DrawText(TextFormat("Shots: %d", stats->bullets_fired), 10, 60, 20, WHITE);
@@ -797,13 +865,34 @@ static void render_system(tbevy_system_ctx_t* ctx, void* user_data) {
     EndDrawing();
 }
 
+/* Extract - main thread, between frames; neither app is running */
+static void render_extract(tbevy_app_t* main_app, tbevy_app_t* render_app, void* user_data) {
+    (void)user_data;
+
+    const CameraResource* cam_res = TBEVY_GET_RESOURCE(main_app, CameraResource);
+    const GameStats* stats = TBEVY_GET_RESOURCE(main_app, GameStats);
+    RenderView* view = TBEVY_GET_RESOURCE_MUT(render_app, RenderView);
+    if (cam_res) view->camera = cam_res->camera;
+    if (stats) view->stats = *stats;
+
+    /* Raylib input is updated by EndDrawing() on the render thread */
+    InputState* input = TBEVY_GET_RESOURCE_MUT(main_app, InputState);
+    if (input && IsWindowReady()) {
+        for (size_t i = 0; i < sizeof(INPUT_KEYS) / sizeof(INPUT_KEYS[0]); i++)
+            input->keys[INPUT_KEYS[i]] = IsKeyDown(INPUT_KEYS[i]);
+        input->frame_time = GetFrameTime();
+        input->should_close = WindowShouldClose();
+    }
+}
+
 /* Time update */
 static void time_update_system(tbevy_system_ctx_t* ctx, void* user_data) {
     (void)user_data;
 
     TimeResource* time = TBEVY_CTX_GET_RESOURCE_MUT(ctx, TimeResource);
-    if (time) {
-        time->delta_time = GetFrameTime();
+    const InputState* input = TBEVY_CTX_GET_RESOURCE(ctx, InputState);
+    if (time && input && input->frame_time > 0.0f) {
+        time->delta_time = input->frame_time;
         time->time += time->delta_time;
         time->frame++;
     }
@@ -838,8 +927,8 @@ static void startup_system(tbevy_system_ctx_t* ctx, void* user_data) {
  * ========================================================================= */
 
 static bool should_quit(tbevy_app_t* app) {
-    (void)app;
-    return WindowShouldClose();
+    const InputState* input = TBEVY_GET_RESOURCE(app, InputState);
+    return input && input->should_close;
 }
 
 int main(void) {
@@ -850,10 +939,6 @@ int main(void) {
     printf("║  SPACE: Fire      ESC: Quit              ║\n");
     printf("╚═══════════════════════════════════════════╝\n\n");
 
-    // Initialize Raylib
-    InitWindow(1280, 720, "TinyECS + Raylib 3D - Space Shooter");
-    SetTargetFPS(-1);
-
     // Create app
     tbevy_app_t* app = tbevy_app_new(TBEVY_THREADING_SINGLE);
     tecs_world_t* world = tbevy_app_world(app);
@@ -877,6 +962,8 @@ int main(void) {
     CameraResource_id = TBEVY_REGISTER_RESOURCE(CameraResource);
     GameStats_id = TBEVY_REGISTER_RESOURCE(GameStats);
     SpawnManager_id = TBEVY_REGISTER_RESOURCE(SpawnManager);
+    InputState_id = TBEVY_REGISTER_RESOURCE(InputState);
+    RenderView_id = TBEVY_REGISTER_RESOURCE(RenderView);
 
     // Initialize resources
     TimeResource time_init = {0.0f, 0.016f, 0};
@@ -898,6 +985,26 @@ int main(void) {
     TBEVY_APP_INSERT_RESOURCE(app, stats_init, GameStats);
     TBEVY_APP_INSERT_RESOURCE(app, spawn_init, SpawnManager);
 
+    InputState input_init = {0};
+    TBEVY_APP_INSERT_RESOURCE(app, input_init, InputState);
+
+    // Render sub-app: GLFW needs the main thread on macOS, so render inline there
+#ifdef __APPLE__
+    tbevy_sub_app_t* render = tbevy_app_add_sub_app(app, false);
+#else
+    tbevy_sub_app_t* render = tbevy_app_add_sub_app(app, true);
+#endif
+    tbevy_app_t* render_app = tbevy_sub_app_app(render);
+
+    // Only what the renderer needs is mirrored, and only rows that changed
+    RenderTransform_id = tbevy_sub_app_extract_component(render, Transform3D_id);
+    RenderMesh_id = tbevy_sub_app_extract_component(render, MeshRenderer_id);
+    tbevy_sub_app_add_extract(render, render_extract, NULL);
+    tbevy_sub_app_on_exit(render, render_shutdown, NULL);
+
+    RenderView view_init = {cam_init.camera, stats_init};
+    TBEVY_APP_INSERT_RESOURCE(render_app, view_init, RenderView);
+
     // Add systems
     tbevy_system_build(
         tbevy_system_in_stage(
@@ -985,8 +1092,15 @@ int main(void) {
 
     tbevy_system_build(
         tbevy_system_in_stage(
-            tbevy_app_add_system(app, render_system, NULL),
-            tbevy_stage_default(TBEVY_STAGE_LAST)
+            tbevy_app_add_system(render_app, render_startup_system, NULL),
+            tbevy_app_stage(render_app, TBEVY_STAGE_STARTUP)
+        )
+    );
+
+    tbevy_system_build(
+        tbevy_system_in_stage(
+            tbevy_app_add_system(render_app, render_system, NULL),
+            tbevy_app_stage(render_app, TBEVY_STAGE_UPDATE)
         )
     );
 
@@ -997,8 +1111,7 @@ int main(void) {
 
     // Cleanup
     printf("\nShutting down...\n");
-    tbevy_app_free(app);
-    CloseWindow();
+    tbevy_app_free(app);  // Joins the render thread, which closes the window
 
     printf("Game completed successfully!\n");
     return 0;
@@ -0,0 +1,330 @@
+/*
+ * TinyEcs.Bevy Thread-Scaling Benchmark
+ *
+ * Runs one synthetic schedule with 1..N scheduler threads and prints JSON:
+ * - Movement, AI, regen, heat, animation and damage systems with declared access
+ * - A spawner and a damage system that spawn, despawn and send events via commands
+ * - An undeclared bookkeeping system that always runs alone
+ *
+ * Usage: example_bevy_scaling [max_threads] [frames] [entities]
+ * Per-frame times are averages; worker arrays are indexed by task pool worker.
+ */
+
+#define TINYECS_IMPLEMENTATION
+#define TINYECS_BEVY_IMPLEMENTATION
+#include "tinyecs.h"
+#include "tinyecs_bevy.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef struct { float x, y; } Position;
+typedef struct { float x, y; } Velocity;
+typedef struct { int value; } Health;
+typedef struct { float value; } Heat;
+typedef struct { float goal_x, goal_y; int decision; } Brain;
+typedef struct { float time; int frame; } Animation;
+
+typedef struct { int spawn_per_frame; } Config;
+typedef struct { int frame; int deaths; } Totals;
+typedef struct { tecs_entity_t entity; } Died;
+
+static uint64_t Config_id;
+static uint64_t Totals_id;
+static uint64_t Died_id;
+
+typedef struct {
+    tbevy_app_t* app;
+    tecs_component_id_t pos_id, vel_id, hp_id, heat_id, brain_id, anim_id;
+    tecs_query_t* queries[8];
+    int query_count;
+} scene_t;
+
+static tecs_query_t* scene_query(scene_t* scene, tecs_component_id_t a, tecs_component_id_t b) {
+    tecs_query_t* query = tecs_query_new(tbevy_app_world(scene->app));
+    tecs_query_with(query, a);
+    if (b) tecs_query_with(query, b);
+    tecs_query_build(query);
+    scene->queries[scene->query_count++] = query;
+    return query;
+}
+
+#define COLUMN(iter, Type, id) ((Type*)tecs_iter_column(iter, tecs_iter_column_index(iter, id)))
+
+typedef struct {
+    scene_t* scene;
+    tecs_query_t* query;
+} system_data_t;
+
+static void movement_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        Position* pos = COLUMN(iter, Position, data->scene->pos_id);
+        Velocity* vel = COLUMN(iter, Velocity, data->scene->vel_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            pos[i].x += vel[i].x * 0.016f;
+            pos[i].y += vel[i].y * 0.016f;
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+/* The heaviest system: some math per entity */
+static void ai_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        const Position* pos = COLUMN(iter, Position, data->scene->pos_id);
+        Brain* brain = COLUMN(iter, Brain, data->scene->brain_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            float dx = brain[i].goal_x - pos[i].x;
+            float dy = brain[i].goal_y - pos[i].y;
+            float dist = sqrtf(dx * dx + dy * dy);
+            float angle = atan2f(dy, dx);
+            brain[i].decision = dist < 10.0f ? 0 : (angle > 0.0f ? 1 : 2);
+            if (dist < 1.0f) {
+                brain[i].goal_x = sinf(pos[i].y) * 100.0f;
+                brain[i].goal_y = cosf(pos[i].x) * 100.0f;
+            }
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void heat_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        Heat* heat = COLUMN(iter, Heat, data->scene->heat_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) heat[i].value = heat[i].value * 0.98f + 0.5f;
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void regen_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        Health* hp = COLUMN(iter, Health, data->scene->hp_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            if (hp[i].value < 100 && hp[i].value % 5 == 0) hp[i].value++;
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void animation_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        Animation* anim = COLUMN(iter, Animation, data->scene->anim_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            anim[i].time += 0.016f;
+            anim[i].frame = (int)(anim[i].time * 12.0f) % 8;
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void spawn_one(tbevy_commands_t* commands, scene_t* scene, int seed) {
+    Position pos = {(float)(seed % 1000), (float)(seed / 1000 % 1000)};
+    Velocity vel = {(float)(seed % 7) - 3.0f, (float)(seed % 5) - 2.0f};
+    Health hp = {20 + seed % 80};
+    Heat heat = {0.0f};
+    Brain brain = {0.0f, 0.0f, 0};
+    Animation anim = {0.0f, 0};
+    tbevy_entity_commands_t ec = tbevy_commands_spawn(commands);
+    tbevy_entity_insert(&ec, scene->pos_id, &pos, sizeof(Position));
+    tbevy_entity_insert(&ec, scene->vel_id, &vel, sizeof(Velocity));
+    tbevy_entity_insert(&ec, scene->hp_id, &hp, sizeof(Health));
+    tbevy_entity_insert(&ec, scene->heat_id, &heat, sizeof(Heat));
+    if (seed % 2) tbevy_entity_insert(&ec, scene->brain_id, &brain, sizeof(Brain));
+    if (seed % 3) tbevy_entity_insert(&ec, scene->anim_id, &anim, sizeof(Animation));
+}
+
+static void spawner_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    const Config* config = TBEVY_CTX_GET_RESOURCE(ctx, Config);
+    const Totals* totals = TBEVY_CTX_GET_RESOURCE(ctx, Totals);
+    for (int i = 0; i < config->spawn_per_frame; i++)
+        spawn_one(ctx->commands, data->scene, totals->frame * 7919 + i);
+}
+
+/* Reads Heat, writes Health: despawns and reports entities that run out */
+static void damage_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    system_data_t* data = (system_data_t*)user_data;
+    tecs_query_iter_t* iter = tecs_query_iter(data->query);
+    while (tecs_iter_next(iter)) {
+        tecs_entity_t* entities = tecs_iter_entities(iter);
+        const Heat* heat = COLUMN(iter, Heat, data->scene->heat_id);
+        Health* hp = COLUMN(iter, Health, data->scene->hp_id);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            if (heat[i].value > 20.0f) hp[i].value -= 1;
+            if (hp[i].value <= 0) {
+                Died died = {entities[i]};
+                tbevy_commands_entity_despawn(ctx->commands, entities[i]);
+                tbevy_commands_send_event(ctx->commands, Died_id, &died, sizeof(Died));
+            }
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void count_death(tbevy_app_t* app, const void* event_data, void* user_data) {
+    (void)app; (void)event_data;
+    ((Totals*)user_data)->deaths++;
+}
+
+/* Undeclared: runs exclusively */
+static void bookkeeping_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)user_data;
+    Totals* totals = TBEVY_CTX_GET_RESOURCE_MUT(ctx, Totals);
+    tbevy_app_read_events(ctx->_app, Died_id, count_death, totals);
+    totals->frame++;
+}
+
+static void scene_init(scene_t* scene, system_data_t* data, int threads, int entities) {
+    memset(scene, 0, sizeof(*scene));
+    scene->app = tbevy_app_new(TBEVY_THREADING_MULTI);
+    tbevy_app_set_threads(scene->app, threads);
+
+    tecs_world_t* world = tbevy_app_world(scene->app);
+    scene->pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    scene->vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    scene->hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    scene->heat_id = tecs_register_component(world, "Heat", sizeof(Heat));
+    scene->brain_id = tecs_register_component(world, "Brain", sizeof(Brain));
+    scene->anim_id = tecs_register_component(world, "Animation", sizeof(Animation));
+
+    TBEVY_APP_INSERT_RESOURCE(scene->app, ((Config){entities / 500 + 1}), Config);
+    TBEVY_APP_INSERT_RESOURCE(scene->app, ((Totals){0, 0}), Totals);
+
+    /* Initial population goes through the same commands path, applied serially */
+    tbevy_commands_t commands;
+    tbevy_commands_init(&commands, scene->app);
+    for (int i = 0; i < entities; i++) spawn_one(&commands, scene, i);
+    tbevy_commands_apply(&commands);
+    tbevy_commands_free(&commands);
+
+    struct { tbevy_system_fn_t fn; tecs_component_id_t a, b; } defs[] = {
+        {movement_system, scene->pos_id, scene->vel_id},
+        {ai_system, scene->pos_id, scene->brain_id},
+        {heat_system, scene->heat_id, 0},
+        {regen_system, scene->hp_id, 0},
+        {animation_system, scene->anim_id, 0},
+        {spawner_system, 0, 0},
+        {damage_system, scene->heat_id, scene->hp_id},
+    };
+    for (int i = 0; i < 7; i++) {
+        data[i].scene = scene;
+        data[i].query = defs[i].a ? scene_query(scene, defs[i].a, defs[i].b) : NULL;
+    }
+
+    /* Batches: {movement, heat, regen, animation, spawner}, {ai, damage}, then bookkeeping */
+    tbevy_system_builder_t* b;
+    b = tbevy_app_add_system(scene->app, movement_system, &data[0]);
+    tbevy_system_build(tbevy_system_writes(tbevy_system_reads(b, scene->vel_id), scene->pos_id));
+    b = tbevy_app_add_system(scene->app, heat_system, &data[2]);
+    tbevy_system_build(tbevy_system_writes(b, scene->heat_id));
+    b = tbevy_app_add_system(scene->app, regen_system, &data[3]);
+    tbevy_system_build(tbevy_system_writes(b, scene->hp_id));
+    b = tbevy_app_add_system(scene->app, animation_system, &data[4]);
+    tbevy_system_build(tbevy_system_writes(b, scene->anim_id));
+    b = tbevy_app_add_system(scene->app, spawner_system, &data[5]);
+    tbevy_system_build(tbevy_system_reads_resource(tbevy_system_reads_resource(b, Config_id), Totals_id));
+    b = tbevy_app_add_system(scene->app, ai_system, &data[1]);
+    tbevy_system_build(tbevy_system_writes(tbevy_system_reads(b, scene->pos_id), scene->brain_id));
+    b = tbevy_app_add_system(scene->app, damage_system, &data[6]);
+    tbevy_system_build(tbevy_system_writes(tbevy_system_reads(b, scene->heat_id), scene->hp_id));
+    tbevy_system_build(tbevy_app_add_system(scene->app, bookkeeping_system, NULL));
+}
+
+static void scene_free(scene_t* scene) {
+    for (int i = 0; i < scene->query_count; i++) tecs_query_free(scene->queries[i]);
+    tbevy_app_free(scene->app);
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : tecs_cpu_count();
+    int frames = argc > 2 ? atoi(argv[2]) : 300;
+    int entities = argc > 3 ? atoi(argv[3]) : 200000;
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > TBEVY_MAX_WORKERS) max_threads = TBEVY_MAX_WORKERS;
+    if (frames < 1) frames = 1;
+
+    Config_id = TBEVY_REGISTER_RESOURCE(Config);
+    Totals_id = TBEVY_REGISTER_RESOURCE(Totals);
+    Died_id = TBEVY_REGISTER_EVENT(Died);
+
+    printf("{\n  \"benchmark\": \"bevy_scaling\",\n");
+    printf("  \"entities\": %d,\n  \"frames\": %d,\n  \"cpu_count\": %d,\n", entities, frames,
+           tecs_cpu_count());
+    printf("  \"runs\": [\n");
+
+    double serial_frame_ms = 0.0;
+    uint64_t serial_hash = 0;
+    /* Powers of two, then the maximum */
+    int thread_counts[16];
+    int run_count = 0;
+    for (int t = 1; t < max_threads; t *= 2) thread_counts[run_count++] = t;
+    thread_counts[run_count++] = max_threads;
+
+    for (int run = 0; run < run_count; run++) {
+        int threads = thread_counts[run];
+        scene_t scene;
+        system_data_t data[7];
+        scene_init(&scene, data, threads, entities);
+
+        /* Warm up: queries, chunks and the pool */
+        for (int i = 0; i < 10; i++) tbevy_app_update(scene.app);
+        tbevy_app_reset_scheduler_stats(scene.app);
+
+        uint64_t start_ns = tecs_time_ns();
+        for (int i = 0; i < frames; i++) tbevy_app_update(scene.app);
+        double frame_ms = (double)(tecs_time_ns() - start_ns) / 1e6 / frames;
+
+        tbevy_scheduler_stats_t stats;
+        tbevy_app_scheduler_stats(scene.app, &stats);
+        uint64_t hash = tecs_world_hash(tbevy_app_world(scene.app));
+        if (threads == 1) {
+            serial_frame_ms = frame_ms;
+            serial_hash = hash;
+        }
+
+        double f = (double)frames;
+        printf("    {\n      \"threads\": %d,\n", threads);
+        printf("      \"frame_ms\": %.4f,\n      \"speedup\": %.3f,\n", frame_ms,
+               frame_ms > 0.0 ? serial_frame_ms / frame_ms : 0.0);
+        printf("      \"entities_end\": %d,\n", tecs_world_entity_count(tbevy_app_world(scene.app)));
+        printf("      \"matches_serial\": %s,\n", hash == serial_hash ? "true" : "false");
+        printf("      \"batches_per_frame\": %.2f,\n", (double)stats.batches / f);
+        printf("      \"parallel_systems_per_frame\": %.2f,\n", (double)stats.parallel_systems / f);
+        printf("      \"serial_systems_per_frame\": %.2f,\n", (double)stats.serial_systems / f);
+        printf("      \"steals_per_frame\": %.2f,\n", (double)stats.steals / f);
+        printf("      \"batch_ms\": %.4f,\n", stats.batch_ms / f);
+        printf("      \"barrier_ms\": %.4f,\n", stats.barrier_ms / f);
+        printf("      \"apply_ms\": %.4f,\n", stats.apply_ms / f);
+        printf("      \"serial_ms\": %.4f,\n", stats.serial_ms / f);
+        printf("      \"workers\": [");
+        for (int w = 0; w < stats.worker_count; w++) {
+            printf("%s\n        {\"worker\": %d, \"busy_ms\": %.4f, \"idle_ms\": %.4f, \"tasks\": %llu}",
+                   w ? "," : "", w, stats.busy_ms[w] / f, stats.idle_ms[w] / f,
+                   (unsigned long long)stats.tasks[w]);
+        }
+        printf("\n      ]\n    }%s\n", run + 1 < run_count ? "," : "");
+        fflush(stdout);
+
+        scene_free(&scene);
+    }
+
+    printf("  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * TinyEcs Fragmentation Benchmark
+ *
+ * Measures query iteration over many small archetypes, where each chunk holds only a
+ * few entities and the iterator spends its time hopping between chunks instead of
+ * streaming through columns:
+ * - Every entity has Position and Velocity plus a combination of tag components, so
+ *   2^tag_bits archetypes each hold entities_per_archetype rows
+ * - A movement query (Position += Velocity) runs with each prefetch distance
+ * - "cold" passes evict the caches first, like a frame where other systems ran in
+ *   between; "warm" passes run back to back
+ *
+ * Usage: example_fragmentation [tag_bits] [entities_per_archetype] [passes]
+ */
+
+#define TINYECS_IMPLEMENTATION
+#include "tinyecs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+static tecs_component_id_t Position_id;
+static tecs_component_id_t Velocity_id;
+
+/* Larger than the last-level cache of common desktop parts */
+#define EVICT_BYTES (64 * 1024 * 1024)
+
+static unsigned char* evict_buffer;
+static volatile unsigned evict_sink;
+
+static void evict_caches(void) {
+    unsigned sum = 0;
+    for (size_t i = 0; i < EVICT_BYTES; i += 64) {
+        evict_buffer[i]++;
+        sum += evict_buffer[i];
+    }
+    evict_sink = sum;
+}
+
+static int run_movement(tecs_query_t* query) {
+    int rows = 0;
+    tecs_query_iter_t iter;
+    tecs_query_iter_init(&iter, query);
+    while (tecs_iter_next(&iter)) {
+        int count = tecs_iter_count(&iter);
+        Position* pos = (Position*)tecs_iter_column(&iter, 0);
+        Velocity* vel = (Velocity*)tecs_iter_column(&iter, 1);
+        for (int i = 0; i < count; i++) {
+            pos[i].x += vel[i].x;
+            pos[i].y += vel[i].y;
+        }
+        rows += count;
+    }
+    return rows;
+}
+
+/* Average nanoseconds per pass */
+static double measure(tecs_query_t* query, int passes, bool cold, int expected) {
+    uint64_t total = 0;
+    for (int p = 0; p < passes; p++) {
+        if (cold) evict_caches();
+        uint64_t start = tecs_time_ns();
+        int rows = run_movement(query);
+        total += tecs_time_ns() - start;
+        if (rows != expected) {
+            fprintf(stderr, "iterated %d rows, expected %d\n", rows, expected);
+            exit(1);
+        }
+    }
+    return (double)total / passes;
+}
+
+int main(int argc, char** argv) {
+    int tag_bits = argc > 1 ? atoi(argv[1]) : 12;
+    int per_archetype = argc > 2 ? atoi(argv[2]) : 16;
+    int passes = argc > 3 ? atoi(argv[3]) : 50;
+    if (tag_bits < 0) tag_bits = 0;
+    if (tag_bits > 16) tag_bits = 16;
+    if (per_archetype < 1) per_archetype = 1;
+    if (passes < 1) passes = 1;
+
+    int archetypes = 1 << tag_bits;
+    int entities = archetypes * per_archetype;
+
+    printf("=== TinyEcs Fragmentation Benchmark ===\n");
+    printf("Archetypes: %d  Entities per archetype: %d  Entities: %d  Passes: %d\n\n",
+           archetypes, per_archetype, entities, passes);
+
+    tecs_world_t* world = tecs_world_new();
+    Position_id = TECS_REGISTER_COMPONENT(world, Position);
+    Velocity_id = TECS_REGISTER_COMPONENT(world, Velocity);
+
+    tecs_component_id_t tags[16];
+    for (int t = 0; t < tag_bits; t++) {
+        char name[16];
+        snprintf(name, sizeof(name), "Tag%d", t);
+        tags[t] = tecs_register_component(world, name, 0);
+    }
+
+    /* Interleave spawning so neighbouring archetypes are not neighbours in memory */
+    for (int n = 0; n < per_archetype; n++) {
+        for (int a = 0; a < archetypes; a++) {
+            tecs_entity_t e = tecs_entity_new(world);
+            Position pos = {(float)a, (float)n};
+            Velocity vel = {1.0f, 0.5f};
+            tecs_set(world, e, Position_id, &pos, sizeof(Position));
+            tecs_set(world, e, Velocity_id, &vel, sizeof(Velocity));
+            for (int t = 0; t < tag_bits; t++) {
+                if (a & (1 << t)) tecs_add_tag(world, e, tags[t]);
+            }
+        }
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, Position_id);
+    tecs_query_with(query, Velocity_id);
+    tecs_query_build(query);
+
+    evict_buffer = calloc(EVICT_BYTES, 1);
+    run_movement(query);
+
+    static const int distances[] = {0, 1, 2, 4, 8, 16};
+    const int distance_count = (int)(sizeof(distances) / sizeof(distances[0]));
+    double cold_base = 0.0, warm_base = 0.0;
+
+    printf("%-9s %12s %10s %8s %12s %10s %8s\n", "distance", "cold ns/ent", "ns/chunk", "speedup",
+           "warm ns/ent", "ns/chunk", "speedup");
+    for (int d = 0; d < distance_count; d++) {
+        tecs_query_set_prefetch(query, distances[d]);
+        double cold = measure(query, passes, true, entities);
+        double warm = measure(query, passes, false, entities);
+        if (d == 0) {
+            cold_base = cold;
+            warm_base = warm;
+        }
+        printf("%-9d %12.2f %10.1f %7.2fx %12.2f %10.1f %7.2fx\n", distances[d],
+               cold / entities, cold / archetypes, cold_base / cold,
+               warm / entities, warm / archetypes, warm_base / warm);
+    }
+
+    free(evict_buffer);
+    tecs_query_free(query);
+    tecs_world_free(world);
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * TinyEcs Sharded World Benchmark
+ *
+ * Simulates one map split into 1..N vertical strips, one shard world per strip:
+ * - Every entity has Position, Velocity and a steering Goal; the tick integrates,
+ *   steers and clamps to the map edges
+ * - Entities crossing a strip border migrate to the neighbouring shard
+ * - Each shard sends its population to its neighbours every frame and mirrors a
+ *   beacon of every other shard through a proxy
+ *
+ * Usage: example_shards [max_shards] [entities] [frames]
+ * Shard counts double up to max_shards (default: CPU count, at least 4). The same
+ * entities are simulated for every shard count; one thread per shard.
+ */
+
+#define TINYECS_IMPLEMENTATION
+#include "tinyecs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define MAP_WIDTH 4096.0f
+#define MAP_HEIGHT 4096.0f
+#define MSG_POPULATION 1
+
+typedef struct { float x, y; } Position;
+typedef struct { float x, y; } Velocity;
+typedef struct { float x, y; } Goal;
+
+typedef struct {
+    tecs_component_id_t pos_id, vel_id, goal_id;
+    tecs_query_t* queries[64];
+    int neighbour_population[64];
+} scene_t;
+
+static int strip_of(float x, int shards) {
+    int strip = (int)(x * (float)shards / MAP_WIDTH);
+    return strip < 0 ? 0 : strip >= shards ? shards - 1 : strip;
+}
+
+static void shard_tick(tecs_shard_set_t* set, int shard, tecs_world_t* world, void* user_data) {
+    scene_t* scene = (scene_t*)user_data;
+    int shards = tecs_shard_count(set);
+    int population = 0;
+    (void)world;
+
+    tecs_query_iter_t iter;
+    tecs_query_iter_init(&iter, scene->queries[shard]);
+    while (tecs_iter_next(&iter)) {
+        int count = tecs_iter_count(&iter);
+        tecs_entity_t* entities = tecs_iter_entities(&iter);
+        Position* pos = (Position*)tecs_iter_column(&iter, tecs_iter_column_index(&iter, scene->pos_id));
+        Velocity* vel = (Velocity*)tecs_iter_column(&iter, tecs_iter_column_index(&iter, scene->vel_id));
+        Goal* goal = (Goal*)tecs_iter_column(&iter, tecs_iter_column_index(&iter, scene->goal_id));
+
+        for (int i = 0; i < count; i++) {
+            /* Steer towards the goal, capped speed */
+            float dx = goal[i].x - pos[i].x;
+            float dy = goal[i].y - pos[i].y;
+            float dist = sqrtf(dx * dx + dy * dy) + 1e-3f;
+            vel[i].x = vel[i].x * 0.9f + dx / dist * 0.5f;
+            vel[i].y = vel[i].y * 0.9f + dy / dist * 0.5f;
+            float speed = sqrtf(vel[i].x * vel[i].x + vel[i].y * vel[i].y);
+            if (speed > 4.0f) {
+                vel[i].x *= 4.0f / speed;
+                vel[i].y *= 4.0f / speed;
+            }
+            pos[i].x += vel[i].x;
+            pos[i].y += vel[i].y;
+
+            /* Goals mirror across the map once reached */
+            if (dist < 8.0f) {
+                goal[i].x = MAP_WIDTH - goal[i].x;
+                goal[i].y = MAP_HEIGHT - goal[i].y;
+            }
+            if (pos[i].x < 0.0f) pos[i].x = 0.0f;
+            if (pos[i].x >= MAP_WIDTH) pos[i].x = MAP_WIDTH - 1.0f;
+            if (pos[i].y < 0.0f) pos[i].y = 0.0f;
+            if (pos[i].y >= MAP_HEIGHT) pos[i].y = MAP_HEIGHT - 1.0f;
+
+            int strip = strip_of(pos[i].x, shards);
+            if (strip != shard) tecs_shard_migrate(set, shard, entities[i], strip);
+            else population++;
+        }
+    }
+
+    if (shard > 0) tecs_shard_send(set, shard, shard - 1, MSG_POPULATION, &population, sizeof(int));
+    if (shard + 1 < shards) tecs_shard_send(set, shard, shard + 1, MSG_POPULATION, &population, sizeof(int));
+}
+
+static void on_message(tecs_shard_set_t* set, int shard, int from, uint32_t type, const void* data,
+                       int size, void* user_data) {
+    scene_t* scene = (scene_t*)user_data;
+    (void)set; (void)from; (void)size;
+    if (type == MSG_POPULATION) memcpy(&scene->neighbour_population[shard], data, sizeof(int));
+}
+
+static uint32_t rng_state = 12345;
+static float rng_float(float max) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (float)(rng_state >> 8) / 16777216.0f * max;
+}
+
+typedef struct {
+    double frame_ms, tick_ms, boundary_ms, migrated;
+} run_result_t;
+
+static run_result_t run(int shards, int entities, int frames) {
+    scene_t scene;
+    memset(&scene, 0, sizeof(scene));
+
+    tecs_shard_set_t* set = tecs_shard_set_new(shards, shards);
+    scene.pos_id = tecs_shard_register_component(set, "Position", sizeof(Position));
+    scene.vel_id = tecs_shard_register_component(set, "Velocity", sizeof(Velocity));
+    scene.goal_id = tecs_shard_register_component(set, "Goal", sizeof(Goal));
+
+    for (int s = 0; s < shards; s++) {
+        scene.queries[s] = tecs_query_new(tecs_shard_world(set, s));
+        tecs_query_with(scene.queries[s], scene.pos_id);
+        tecs_query_with(scene.queries[s], scene.vel_id);
+        tecs_query_with(scene.queries[s], scene.goal_id);
+        tecs_query_build(scene.queries[s]);
+    }
+
+    /* Same entities for every shard count */
+    rng_state = 12345;
+    tecs_entity_t beacons[64];
+    int beacon_shards[64];
+    for (int i = 0; i < entities; i++) {
+        Position pos = {rng_float(MAP_WIDTH), rng_float(MAP_HEIGHT)};
+        Velocity vel = {0.0f, 0.0f};
+        Goal goal = {rng_float(MAP_WIDTH), rng_float(MAP_HEIGHT)};
+        int shard = strip_of(pos.x, shards);
+        tecs_world_t* world = tecs_shard_world(set, shard);
+
+        tecs_entity_t e = tecs_entity_new(world);
+        tecs_set(world, e, scene.pos_id, &pos, sizeof(Position));
+        tecs_set(world, e, scene.vel_id, &vel, sizeof(Velocity));
+        tecs_set(world, e, scene.goal_id, &goal, sizeof(Goal));
+        if (i < shards) {
+            beacons[i] = e;
+            beacon_shards[i] = shard;
+        }
+    }
+    for (int s = 0; s < shards; s++) {
+        for (int b = 0; b < shards && b < entities; b++) {
+            if (beacon_shards[b] != s) {
+                tecs_shard_proxy_new(set, s, beacon_shards[b], beacons[b], &scene.pos_id, 1);
+            }
+        }
+    }
+
+    tecs_shard_set_systems(set, shard_tick, on_message, &scene);
+    tecs_shard_set_step(set);  /* Warm-up */
+
+    run_result_t result = {0, 0, 0, 0};
+    uint64_t start = tecs_time_ns();
+    for (int f = 0; f < frames; f++) {
+        tecs_shard_set_step(set);
+        tecs_shard_stats_t stats = tecs_shard_set_stats(set);
+        result.tick_ms += stats.tick_ms;
+        result.boundary_ms += stats.boundary_ms;
+        result.migrated += stats.migrated;
+    }
+    result.frame_ms = (double)(tecs_time_ns() - start) / 1e6 / frames;
+    result.tick_ms /= frames;
+    result.boundary_ms /= frames;
+    result.migrated /= frames;
+
+    int total = 0;
+    for (int s = 0; s < shards; s++) total += tecs_world_entity_count(tecs_shard_world(set, s));
+    if (entities >= shards && total != entities + shards * (shards - 1)) {
+        fprintf(stderr, "entity count drifted: %d\n", total);
+        exit(1);
+    }
+
+    for (int s = 0; s < shards; s++) tecs_query_free(scene.queries[s]);
+    tecs_shard_set_free(set);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int max_shards = argc > 1 ? atoi(argv[1]) : tecs_cpu_count();
+    int entities = argc > 2 ? atoi(argv[2]) : 200000;
+    int frames = argc > 3 ? atoi(argv[3]) : 100;
+    if (max_shards < 4) max_shards = 4;
+    if (max_shards > 64) max_shards = 64;
+    if (entities < 1) entities = 1;
+    if (frames < 1) frames = 1;
+
+    printf("=== TinyEcs Sharded World Benchmark ===\n");
+    printf("Entities: %d  Frames: %d  CPUs: %d\n\n", entities, frames, tecs_cpu_count());
+    printf("%-7s %10s %10s %12s %12s %14s %8s\n", "shards", "frame ms", "tick ms", "boundary ms",
+           "migrated/f", "entities/s", "speedup");
+
+    double base = 0.0;
+    for (int shards = 1; shards <= max_shards; shards *= 2) {
+        run_result_t r = run(shards, entities, frames);
+        if (shards == 1) base = r.frame_ms;
+        printf("%-7d %10.3f %10.3f %12.3f %12.1f %14.0f %7.2fx\n", shards, r.frame_ms, r.tick_ms,
+               r.boundary_ms, r.migrated, entities / (r.frame_ms / 1000.0), base / r.frame_ms);
+    }
+    return 0;
+}
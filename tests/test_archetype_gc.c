@@ -0,0 +1,191 @@
+/*
+ * Test: Archetype Garbage Collection
+ * Tests edge unlinking, query updates, table tombstones and retention policies
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    int value;
+} Health;
+
+static int count_query(tecs_query_t* query) {
+    int total = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) total += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    return total;
+}
+
+static void test_gc_unlinks_edges_and_queries(void) {
+    printf("Testing archetype GC with edges and queries...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    tecs_component_id_t tag_id = tecs_register_component(world, "Tag", 0);
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+
+    /* root -> {Position} -> {Position, Health} -> {Position, Health, Tag} */
+    Position pos = {1.0f, 2.0f};
+    Health hp = {10};
+    tecs_entity_t e = tecs_entity_new(world);
+    tecs_set(world, e, pos_id, &pos, sizeof(Position));
+    tecs_set(world, e, hp_id, &hp, sizeof(Health));
+    tecs_add_tag(world, e, tag_id);
+    assert(tecs_world_archetype_count(world) == 4);
+    assert(count_query(query) == 1);
+
+    /* Both intermediate archetypes are empty now */
+    assert(tecs_remove_empty_archetypes(world) == 2);
+    assert(tecs_world_archetype_count(world) == 2);
+
+    /* Walking the graph again recreates them instead of following freed edges */
+    tecs_entity_t f = tecs_entity_new(world);
+    tecs_set(world, f, pos_id, &pos, sizeof(Position));
+    tecs_set(world, f, hp_id, &hp, sizeof(Health));
+    tecs_unset(world, e, tag_id);
+    tecs_unset(world, e, hp_id);
+    assert(tecs_world_archetype_count(world) == 4);
+    assert(count_query(query) == 2);
+
+    /* The full archetype is empty again; the query drops it before any rebuild */
+    assert(tecs_remove_empty_archetypes(world) == 1);
+    assert(count_query(query) == 2);
+    tecs_add_tag(world, f, tag_id);
+    assert(((Health*)tecs_get(world, f, hp_id))->value == 10);
+
+    /* Queries freed after their world are detached, not dangling */
+    tecs_query_t* late = tecs_query_new(world);
+    tecs_query_free(query);
+    tecs_world_free(world);
+    tecs_query_free(late);
+    printf("  ✓ Removed archetypes are unlinked from the graph and from queries\n");
+}
+
+static void test_gc_tombstones(void) {
+    printf("Testing archetype table tombstones...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t ids[200];
+    for (int i = 0; i < 200; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Kind%d", i);
+        ids[i] = tecs_register_component(world, name, 0);
+    }
+
+    /* Many archetypes share probe chains */
+    Position pos = {0.0f, 0.0f};
+    tecs_entity_t entities[200];
+    for (int i = 0; i < 200; i++) {
+        entities[i] = tecs_entity_new(world);
+        tecs_add_tag(world, entities[i], ids[i]);
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+    }
+    assert(tecs_world_archetype_count(world) == 1 + 200 + 200);  /* root, {Kind}, {Kind, Position} */
+
+    /* Empty half of the {Kind, Position} archetypes */
+    for (int i = 0; i < 200; i += 2) tecs_entity_delete(world, entities[i]);
+    assert(tecs_remove_empty_archetypes(world) == 200 + 100);
+
+    /* Survivors stay reachable by hash across the tombstones: reaching them from
+     * a new {Position} archetype must not create duplicates */
+    for (int i = 1; i < 200; i += 2) {
+        tecs_entity_t e = tecs_entity_new(world);
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_add_tag(world, e, ids[i]);
+    }
+    assert(tecs_world_archetype_count(world) == 1 + 1 + 100);
+
+    /* Churn reuses tombstones instead of growing the table without bound */
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < 200; i += 2) {
+            tecs_entity_t e = tecs_entity_new(world);
+            tecs_add_tag(world, e, ids[i]);
+            tecs_entity_delete(world, e);
+        }
+        tecs_remove_empty_archetypes(world);
+    }
+    assert(tecs_world_archetype_count(world) == 1 + 100);
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+    assert(count_query(query) == 200);
+    tecs_query_free(query);
+
+    tecs_world_free(world);
+    printf("  ✓ Tombstones keep lookups correct under archetype churn\n");
+}
+
+static void test_gc_retention_policy(void) {
+    printf("Testing tecs_world_gc_archetypes() retention...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+
+    Position pos = {0.0f, 0.0f};
+    Health hp = {1};
+    tecs_entity_t flicker = tecs_entity_new(world);
+    tecs_set(world, flicker, hp_id, &hp, sizeof(Health));
+    tecs_entity_delete(world, flicker);
+
+    tecs_archetype_gc_policy_t policy = {5, 1};
+    tecs_world_update(world);
+    assert(tecs_world_gc_archetypes(world, &policy) == 0);  /* Too recent */
+    for (int i = 0; i < 5; i++) tecs_world_update(world);
+    assert(tecs_world_gc_archetypes(world, &policy) == 1);
+
+    /* Three chunks, then shrink back to one */
+    const int count = TECS_CHUNK_SIZE * 2 + 10;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+    }
+    int chunks = tecs_world_chunk_count(world);
+    for (int i = TECS_CHUNK_SIZE; i < count; i++) tecs_entity_delete(world, entities[i]);
+
+    /* Idle empty chunks past the first one are freed from the tail */
+    assert(tecs_world_gc_archetypes(world, &policy) == 0);
+    assert(tecs_world_chunk_count(world) == chunks);
+    for (int i = 0; i < 5; i++) tecs_world_update(world);
+    assert(tecs_world_gc_archetypes(world, &policy) == 0);
+    assert(tecs_world_chunk_count(world) == chunks - 1);
+
+    for (int i = 0; i < TECS_CHUNK_SIZE; i++) {
+        assert(((Position*)tecs_get(world, entities[i], pos_id)) != NULL);
+    }
+    tecs_entity_t extra = tecs_entity_new(world);
+    tecs_set(world, extra, pos_id, &pos, sizeof(Position));
+
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Minimum age and chunk keep-alive bound the collection\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Archetype GC Tests ===\n\n");
+
+    test_gc_unlinks_edges_and_queries();
+    test_gc_tombstones();
+    test_gc_retention_policy();
+
+    printf("\n=== All Archetype GC Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Test: Archetype Graph
+ * Tests component lookups and the world edge table with many archetypes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+#define TAG_BITS 12
+
+static int count_query(tecs_query_t* query) {
+    int total = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) total += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    return total;
+}
+
+static void test_wide_archetypes(void) {
+    printf("Testing archetypes with many components...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t ids[48];
+    for (int i = 0; i < 48; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Field%d", i);
+        ids[i] = tecs_register_component(world, name, i % 3 == 0 ? 0 : (int)sizeof(int));
+    }
+
+    /* Added out of ID order, so column lookups search past the linear window */
+    tecs_entity_t e = tecs_entity_new(world);
+    for (int i = 47; i >= 0; i--) {
+        int value = i * 10;
+        tecs_set(world, e, ids[i], i % 3 == 0 ? NULL : &value, i % 3 == 0 ? 0 : (int)sizeof(int));
+    }
+    for (int i = 0; i < 48; i++) {
+        assert(tecs_has(world, e, ids[i]));
+        if (i % 3 == 0) {
+            assert(tecs_get(world, e, ids[i]) == NULL);
+        } else {
+            assert(*(int*)tecs_get(world, e, ids[i]) == i * 10);
+        }
+    }
+
+    /* Removing from the middle keeps the remaining columns addressable */
+    tecs_unset(world, e, ids[20]);
+    tecs_unset(world, e, ids[21]);
+    assert(!tecs_has(world, e, ids[20]) && !tecs_has(world, e, ids[21]));
+    assert(*(int*)tecs_get(world, e, ids[47]) == 470);
+    assert(*(int*)tecs_get(world, e, ids[22]) == 220);
+
+    tecs_world_free(world);
+    printf("  ✓ Sorted component arrays resolve tags and columns\n");
+}
+
+static void test_many_archetypes(void) {
+    printf("Testing a graph with 4k archetypes...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t tags[TAG_BITS];
+    for (int b = 0; b < TAG_BITS; b++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Tag%d", b);
+        tags[b] = tecs_register_component(world, name, 0);
+    }
+
+    /* Every combination of tags: one archetype per entity */
+    const int count = 1 << TAG_BITS;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        for (int b = 0; b < TAG_BITS; b++) {
+            if (i & (1 << b)) tecs_add_tag(world, entities[i], tags[b]);
+        }
+    }
+    assert(tecs_world_archetype_count(world) == count);
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, tags[3]);
+    tecs_query_without(query, tags[7]);
+    tecs_query_build(query);
+    assert(count_query(query) == count / 4);
+
+    /* Collect every archetype with Tag0: walking back into them rebuilds edges */
+    for (int i = 1; i < count; i += 2) tecs_entity_delete(world, entities[i]);
+    assert(tecs_remove_empty_archetypes(world) == count / 2);
+    assert(count_query(query) == count / 8);
+
+    for (int i = 0; i < count; i += 2) {
+        tecs_add_tag(world, entities[i], tags[0]);
+        for (int b = 1; b < TAG_BITS; b++) {
+            assert(tecs_has(world, entities[i], tags[b]) == ((i & (1 << b)) != 0));
+        }
+        tecs_unset(world, entities[i], tags[0]);
+        tecs_add_tag(world, entities[i], tags[0]);
+    }
+    assert(tecs_world_archetype_count(world) == count);
+    assert(count_query(query) == count / 8);
+
+    tecs_query_free(query);
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Edges and lookups stay correct through collection\n");
+}
+
+static void test_edge_keys(void) {
+    printf("Testing edge keys...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t a_id = tecs_register_component(world, "A", 0);
+    tecs_component_id_t b_id = tecs_register_component(world, "B", 0);
+    tecs_entity_t a = tecs_entity_new(world);
+    tecs_entity_t b = tecs_entity_new(world);
+    tecs_add_tag(world, a, a_id);
+    tecs_add_tag(world, b, b_id);
+    tecs_archetype_t* source = world->root_archetype;
+    tecs_archetype_t* a_arch = tecs_sparse_set_get(&world->entities, a)->archetype;
+    tecs_archetype_t* b_arch = tecs_sparse_set_get(&world->entities, b)->archetype;
+
+    /* IDs are full 64-bit hashes: ones differing only in the top bit get their own edges */
+    tecs_component_id_t low = 0x0123456789abcdefULL;
+    tecs_component_id_t high = low | (1ULL << 63);
+    tecs_archetype_add_edge(world, source, low, a_arch, true);
+    tecs_archetype_add_edge(world, source, high, b_arch, true);
+    tecs_archetype_add_edge(world, source, high, a_arch, false);
+    assert(tecs_archetype_find_edge(world, source, low, true) == a_arch);
+    assert(tecs_archetype_find_edge(world, source, high, true) == b_arch);
+    assert(tecs_archetype_find_edge(world, source, high, false) == a_arch);
+    assert(tecs_archetype_find_edge(world, source, low, false) == NULL);
+    (void)a_arch; (void)b_arch;
+
+    tecs_world_free(world);
+    printf("  ✓ Edges keep every ID bit and the direction apart\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Archetype Graph Tests ===\n\n");
+
+    test_wide_archetypes();
+    test_many_archetypes();
+    test_edge_keys();
+
+    printf("\n=== All Archetype Graph Tests Passed ✓ ===\n");
+    return 0;
+}
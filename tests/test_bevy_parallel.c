@@ -0,0 +1,294 @@
+/*
+ * Test: Bevy Parallel Scheduling
+ * Tests that declared-access systems run in parallel batches with serial results
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#define TINYECS_BEVY_IMPLEMENTATION
+#include "../tinyecs.h"
+#include "../tinyecs_bevy.h"
+
+#define ENTITY_COUNT 6000
+#define FRAMES 12
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float dx, dy;
+} Velocity;
+
+typedef struct {
+    int value;
+} Health;
+
+typedef struct {
+    int frames;
+} Age;
+
+typedef struct {
+    int frame;
+    int died;
+} Counters;
+
+typedef struct {
+    int id;
+} Died;
+
+static uint64_t Counters_id;
+static uint64_t Died_id;
+
+typedef struct {
+    tbevy_app_t* app;
+    tecs_component_id_t pos_id, vel_id, hp_id, age_id;
+    tecs_query_t* move_query;
+    tecs_query_t* regen_query;
+    tecs_query_t* damage_query;
+    tecs_query_t* age_query;
+    int provisional_spawns;
+} sim_t;
+
+static tecs_query_t* query_of(tecs_world_t* world, tecs_component_id_t a, tecs_component_id_t b) {
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, a);
+    if (b) tecs_query_with(query, b);
+    tecs_query_build(query);
+    return query;
+}
+
+static void movement_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(sim->move_query);
+    while (tecs_iter_next(iter)) {
+        Position* pos = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->pos_id));
+        Velocity* vel = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->vel_id));
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            pos[i].x += vel[i].dx;
+            pos[i].y += vel[i].dy;
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void regen_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(sim->regen_query);
+    while (tecs_iter_next(iter)) {
+        Health* hp = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->hp_id));
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            if (hp[i].value % 7 == 0) hp[i].value += 2;
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void spawner_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    const Counters* counters = TBEVY_CTX_GET_RESOURCE(ctx, Counters);
+    for (int i = 0; i < 25; i++) {
+        Position pos = {(float)counters->frame, (float)i};
+        Velocity vel = {0.5f, -0.25f};
+        Health hp = {3 + i % 5};
+        Age age = {0};
+        tbevy_entity_commands_t ec = tbevy_commands_spawn(ctx->commands);
+        tbevy_entity_insert(&ec, sim->pos_id, &pos, sizeof(Position));
+        tbevy_entity_insert(&ec, sim->vel_id, &vel, sizeof(Velocity));
+        tbevy_entity_insert(&ec, sim->hp_id, &hp, sizeof(Health));
+        tbevy_entity_insert(&ec, sim->age_id, &age, sizeof(Age));
+        if (tbevy_entity_id(&ec) & TECS_ENTITY_PROVISIONAL) sim->provisional_spawns++;
+    }
+}
+
+static void damage_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    tecs_query_iter_t* iter = tecs_query_iter(sim->damage_query);
+    while (tecs_iter_next(iter)) {
+        tecs_entity_t* entities = tecs_iter_entities(iter);
+        Position* pos = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->pos_id));
+        Health* hp = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->hp_id));
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            hp[i].value -= pos[i].y > 0.0f ? 2 : 1;
+            if (hp[i].value <= 0) {
+                Died died = {(int)TECS_ENTITY_INDEX(entities[i])};
+                tbevy_commands_entity_despawn(ctx->commands, entities[i]);
+                tbevy_commands_send_event(ctx->commands, Died_id, &died, sizeof(Died));
+            }
+        }
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void aging_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    (void)ctx;
+    tecs_query_iter_t* iter = tecs_query_iter(sim->age_query);
+    while (tecs_iter_next(iter)) {
+        Age* age = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->age_id));
+        for (int i = 0; i < tecs_iter_count(iter); i++) age[i].frames++;
+    }
+    tecs_query_iter_free(iter);
+}
+
+static void count_died(tbevy_app_t* app, const void* event_data, void* user_data) {
+    Counters* counters = (Counters*)user_data;
+    (void)app;
+    counters->died += ((const Died*)event_data)->id >= 0;
+}
+
+/* Undeclared: always runs alone */
+static void bookkeeping_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)user_data;
+    Counters* counters = TBEVY_CTX_GET_RESOURCE_MUT(ctx, Counters);
+    tbevy_app_read_events(ctx->_app, Died_id, count_died, counters);
+    counters->frame++;
+}
+
+static void sim_init(sim_t* sim, bool parallel) {
+    memset(sim, 0, sizeof(*sim));
+    sim->app = tbevy_app_new(parallel ? TBEVY_THREADING_MULTI : TBEVY_THREADING_SINGLE);
+    if (parallel) tbevy_app_set_threads(sim->app, 4);
+
+    tecs_world_t* world = tbevy_app_world(sim->app);
+    sim->pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    sim->vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    sim->hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    sim->age_id = tecs_register_component(world, "Age", sizeof(Age));
+    TBEVY_APP_INSERT_RESOURCE(sim->app, ((Counters){0, 0}), Counters);
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        Position pos = {(float)i, (float)(i % 3) - 1.0f};
+        Velocity vel = {1.0f, (float)(i % 5) * 0.1f};
+        Health hp = {1 + i % 40};
+        tecs_entity_t e = tecs_entity_new(world);
+        tecs_set(world, e, sim->pos_id, &pos, sizeof(Position));
+        tecs_set(world, e, sim->vel_id, &vel, sizeof(Velocity));
+        tecs_set(world, e, sim->hp_id, &hp, sizeof(Health));
+        if (i % 2) tecs_set(world, e, sim->age_id, &(Age){i}, sizeof(Age));
+    }
+
+    sim->move_query = query_of(world, sim->pos_id, sim->vel_id);
+    sim->regen_query = query_of(world, sim->hp_id, 0);
+    sim->damage_query = query_of(world, sim->pos_id, sim->hp_id);
+    sim->age_query = query_of(world, sim->age_id, 0);
+
+    /* Batches: {movement, regen, spawner}, then {damage, aging}, then bookkeeping alone */
+    tbevy_system_builder_t* b;
+    b = tbevy_app_add_system(sim->app, movement_system, sim);
+    tbevy_system_writes(tbevy_system_reads(b, sim->vel_id), sim->pos_id);
+    tbevy_system_build(b);
+
+    b = tbevy_app_add_system(sim->app, regen_system, sim);
+    tbevy_system_writes(b, sim->hp_id);
+    tbevy_system_build(b);
+
+    b = tbevy_app_add_system(sim->app, spawner_system, sim);
+    tbevy_system_reads_resource(b, Counters_id);
+    tbevy_system_build(b);
+
+    b = tbevy_app_add_system(sim->app, damage_system, sim);
+    tbevy_system_writes(tbevy_system_reads(b, sim->pos_id), sim->hp_id);
+    tbevy_system_build(b);
+
+    b = tbevy_app_add_system(sim->app, aging_system, sim);
+    tbevy_system_writes(b, sim->age_id);
+    tbevy_system_build(b);
+
+    tbevy_system_build(tbevy_app_add_system(sim->app, bookkeeping_system, NULL));
+}
+
+static void sim_free(sim_t* sim) {
+    tecs_query_free(sim->move_query);
+    tecs_query_free(sim->regen_query);
+    tecs_query_free(sim->damage_query);
+    tecs_query_free(sim->age_query);
+    tbevy_app_free(sim->app);
+}
+
+static void test_parallel_matches_serial(void) {
+    printf("Testing parallel batches against a single-threaded app...\n");
+
+    sim_t serial, parallel;
+    sim_init(&serial, false);
+    sim_init(&parallel, true);
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        tbevy_app_update(serial.app);
+        tbevy_app_update(parallel.app);
+        assert(tecs_world_hash(tbevy_app_world(serial.app)) ==
+               tecs_world_hash(tbevy_app_world(parallel.app)));
+    }
+
+    const Counters* a = TBEVY_GET_RESOURCE(serial.app, Counters);
+    const Counters* b = TBEVY_GET_RESOURCE(parallel.app, Counters);
+    assert(a->frame == FRAMES && b->frame == FRAMES);
+    assert(a->died > 0 && a->died == b->died);
+    assert(tecs_world_entity_count(tbevy_app_world(serial.app)) ==
+           tecs_world_entity_count(tbevy_app_world(parallel.app)));
+
+    /* Spawns inside batches got provisional IDs that resolved on apply */
+    assert(serial.provisional_spawns == 0);
+    assert(parallel.provisional_spawns == 25 * FRAMES);
+
+    sim_free(&serial);
+    sim_free(&parallel);
+    printf("  ✓ World hash, spawns, despawns and events match\n");
+}
+
+static void test_scheduler_stats(void) {
+    printf("Testing tbevy_app_scheduler_stats()...\n");
+
+    sim_t sim;
+    sim_init(&sim, true);
+    for (int frame = 0; frame < FRAMES; frame++) tbevy_app_update(sim.app);
+
+    tbevy_scheduler_stats_t stats;
+    tbevy_app_scheduler_stats(sim.app, &stats);
+    assert(stats.frames == FRAMES);
+    assert(stats.worker_count == 4);
+    assert(stats.batches == 2 * FRAMES);
+    assert(stats.parallel_systems == 5 * FRAMES);
+    assert(stats.serial_systems == FRAMES);
+
+    uint64_t tasks = 0;
+    for (int w = 0; w < stats.worker_count; w++) {
+        tasks += stats.tasks[w];
+        assert(stats.busy_ms[w] >= 0.0 && stats.idle_ms[w] >= 0.0);
+    }
+    assert(tasks == stats.parallel_systems);
+    assert(stats.steals == tasks - stats.tasks[0]);
+    assert(stats.batch_ms > 0.0 && stats.apply_ms > 0.0);
+
+    tbevy_app_reset_scheduler_stats(sim.app);
+    tbevy_app_scheduler_stats(sim.app, &stats);
+    assert(stats.frames == 0 && stats.batches == 0 && stats.worker_count == 4);
+
+    /* One thread: everything runs exclusively */
+    tbevy_app_set_threads(sim.app, 1);
+    tbevy_app_update(sim.app);
+    tbevy_app_scheduler_stats(sim.app, &stats);
+    assert(stats.batches == 0 && stats.serial_systems == 6 && stats.worker_count == 1);
+
+    sim_free(&sim);
+    printf("  ✓ Batches, steals, busy and idle time are reported per worker\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Bevy Parallel Scheduling Tests ===\n\n");
+
+    Counters_id = TBEVY_REGISTER_RESOURCE(Counters);
+    Died_id = TBEVY_REGISTER_EVENT(Died);
+
+    test_parallel_matches_serial();
+    test_scheduler_stats();
+
+    printf("\n=== All Bevy Parallel Scheduling Tests Passed ✓ ===\n");
+    return 0;
+}
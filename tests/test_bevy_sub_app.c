@@ -0,0 +1,232 @@
+/*
+ * Test: Bevy Sub-Apps
+ * Tests change-tick based extraction into a sub-app world and pipelined updates
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#define TINYECS_BEVY_IMPLEMENTATION
+#include "../tinyecs.h"
+#include "../tinyecs_bevy.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float dx, dy;
+} Velocity;
+
+typedef struct {
+    int frame;
+} FrameCounter;
+
+static tecs_component_id_t Position_id;
+static tecs_component_id_t Velocity_id;
+static tecs_component_id_t Visible_id;
+static uint64_t FrameCounter_id;
+
+static int count_entities(tecs_world_t* world, tecs_component_id_t component_id) {
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, component_id);
+    tecs_query_build(query);
+
+    int count = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) count += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    tecs_query_free(query);
+    return count;
+}
+
+static void test_sub_app_extract(void) {
+    printf("Testing tbevy_sub_app_extract_component()...\n");
+
+    tbevy_app_t* app = tbevy_app_new(TBEVY_THREADING_SINGLE);
+    tecs_world_t* world = tbevy_app_world(app);
+    Position_id = tecs_register_component(world, "Position", sizeof(Position));
+    Velocity_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    Visible_id = tecs_register_component(world, "Visible", 0);
+
+    tbevy_sub_app_t* render = tbevy_app_add_sub_app(app, false);
+    tecs_world_t* render_world = tbevy_app_world(tbevy_sub_app_app(render));
+    tecs_component_id_t render_pos_id = tbevy_sub_app_extract_component(render, Position_id);
+    tecs_component_id_t render_visible_id = tbevy_sub_app_extract_component(render, Visible_id);
+    assert(render_pos_id != 0 && render_visible_id != 0);
+    assert(tbevy_sub_app_extract_component(render, Position_id) == render_pos_id);
+    assert(tbevy_sub_app_extract_component(render, tecs_get_parent_component_id(world)) == 0);
+
+    tecs_entity_t entities[100];
+    for (int i = 0; i < 100; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {(float)i, 0.0f};
+        Velocity vel = {1.0f, 1.0f};
+        tecs_set(world, entities[i], Position_id, &pos, sizeof(Position));
+        tecs_set(world, entities[i], Velocity_id, &vel, sizeof(Velocity));
+        if (i % 2 == 0) tecs_add_tag(world, entities[i], Visible_id);
+    }
+
+    tbevy_app_update(app);
+    assert(count_entities(render_world, render_pos_id) == 100);
+    assert(count_entities(render_world, render_visible_id) == 50);
+
+    tecs_entity_t mirror = tbevy_sub_app_entity(render, entities[10]);
+    assert(mirror != TECS_ENTITY_NULL);
+    assert(!tecs_has(render_world, mirror, tecs_get_component_id(render_world, "Velocity")));
+    assert(((Position*)tecs_get(render_world, mirror, render_pos_id))->x == 10.0f);
+
+    /* Writes without a change tick are not extracted, marked ones are */
+    ((Position*)tecs_get(world, entities[10], Position_id))->x = -1.0f;
+    tbevy_app_update(app);
+    assert(((Position*)tecs_get(render_world, mirror, render_pos_id))->x == 10.0f);
+
+    tecs_mark_changed(world, entities[10], Position_id);
+    tbevy_app_update(app);
+    assert(((Position*)tecs_get(render_world, mirror, render_pos_id))->x == -1.0f);
+
+    /* Removals and despawns propagate */
+    tecs_unset(world, entities[0], Visible_id);
+    tecs_entity_delete(world, entities[1]);
+    tecs_entity_t mirror_deleted = tbevy_sub_app_entity(render, entities[1]);
+    tbevy_app_update(app);
+
+    assert(count_entities(render_world, render_visible_id) == 49);
+    assert(count_entities(render_world, render_pos_id) == 99);
+    assert(!tecs_entity_exists(render_world, mirror_deleted));
+    assert(tbevy_sub_app_entity(render, entities[1]) == TECS_ENTITY_NULL);
+
+    /* A recycled index gets a fresh mirror */
+    tecs_entity_t reused = tecs_entity_new(world);
+    Position pos = {42.0f, 0.0f};
+    tecs_set(world, reused, Position_id, &pos, sizeof(Position));
+    tbevy_app_update(app);
+    mirror = tbevy_sub_app_entity(render, reused);
+    assert(mirror != TECS_ENTITY_NULL);
+    assert(((Position*)tecs_get(render_world, mirror, render_pos_id))->x == 42.0f);
+    assert(count_entities(render_world, render_pos_id) == 100);
+
+    tbevy_app_free(app);
+    printf("  ✓ Only changed rows are extracted, removals propagate\n");
+}
+
+typedef struct {
+    tecs_component_id_t pos_id;
+    int frames;
+    int last_frame;
+    float last_x;
+    int exits;
+} RenderState;
+
+static void move_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)user_data;
+    tecs_query_t* query = tecs_query_new(ctx->world);
+    tecs_query_with(query, Position_id);
+    tecs_query_build(query);
+
+    tecs_tick_t tick = tecs_world_tick(ctx->world);
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) {
+        int column = tecs_iter_column_index(iter, Position_id);
+        Position* positions = (Position*)tecs_iter_column(iter, column);
+        tecs_tick_t* ticks = tecs_iter_changed_ticks(iter, column);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            positions[i].x += 1.0f;
+            ticks[i] = tick;
+        }
+    }
+    tecs_query_iter_free(iter);
+    tecs_query_free(query);
+
+    FrameCounter* counter = (FrameCounter*)tbevy_app_get_resource_mut(ctx->_app, FrameCounter_id);
+    counter->frame++;
+}
+
+static void render_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    RenderState* state = (RenderState*)user_data;
+    const FrameCounter* counter = (const FrameCounter*)tbevy_app_get_resource(ctx->_app, FrameCounter_id);
+
+    tecs_query_t* query = tecs_query_new(ctx->world);
+    tecs_query_with(query, state->pos_id);
+    tecs_query_build(query);
+
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) {
+        Position* positions = (Position*)tecs_iter_column(iter, tecs_iter_column_index(iter, state->pos_id));
+        state->last_x = positions[0].x;
+    }
+    tecs_query_iter_free(iter);
+    tecs_query_free(query);
+
+    state->last_frame = counter->frame;
+    state->frames++;
+}
+
+static void render_exit(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)ctx;
+    ((RenderState*)user_data)->exits++;
+}
+
+static void extract_frame(tbevy_app_t* main_app, tbevy_app_t* sub_app, void* user_data) {
+    (void)user_data;
+    const FrameCounter* counter = (const FrameCounter*)tbevy_app_get_resource(main_app, FrameCounter_id);
+    tbevy_app_insert_resource(sub_app, FrameCounter_id, (void*)counter, sizeof(FrameCounter));
+}
+
+static void test_sub_app_threaded(void) {
+    printf("Testing threaded sub-app pipeline...\n");
+
+    tbevy_app_t* app = tbevy_app_new(TBEVY_THREADING_SINGLE);
+    tecs_world_t* world = tbevy_app_world(app);
+    Position_id = tecs_register_component(world, "Position", sizeof(Position));
+    FrameCounter_id = tbevy_register_resource_type("FrameCounter", sizeof(FrameCounter), NULL);
+    FrameCounter counter = {0};
+    tbevy_app_insert_resource(app, FrameCounter_id, &counter, sizeof(FrameCounter));
+
+    tecs_entity_t e = tecs_entity_new(world);
+    Position pos = {0.0f, 0.0f};
+    tecs_set(world, e, Position_id, &pos, sizeof(Position));
+
+    tbevy_system_build(tbevy_system_in_stage(
+        tbevy_app_add_system(app, move_system, NULL), tbevy_stage_default(TBEVY_STAGE_UPDATE)));
+
+    RenderState state = {0};
+    tbevy_sub_app_t* render = tbevy_app_add_sub_app(app, true);
+    tbevy_app_t* render_app = tbevy_sub_app_app(render);
+    state.pos_id = tbevy_sub_app_extract_component(render, Position_id);
+    tbevy_sub_app_add_extract(render, extract_frame, NULL);
+    tbevy_sub_app_on_exit(render, render_exit, &state);
+
+    /* Creating the sub-app keeps tbevy_stage_default() on the main app */
+    assert(tbevy_stage_default(TBEVY_STAGE_UPDATE) == tbevy_app_stage(app, TBEVY_STAGE_UPDATE));
+    tbevy_system_build(tbevy_system_in_stage(
+        tbevy_app_add_system(render_app, render_system, &state),
+        tbevy_app_stage(render_app, TBEVY_STAGE_UPDATE)));
+
+    for (int frame = 1; frame <= 50; frame++) {
+        tbevy_app_update(app);
+
+        /* The render frame runs while the main app simulates the next one */
+        tbevy_sub_app_wait(render);
+        assert(state.frames == frame);
+        assert(state.last_frame == frame);
+        assert(state.last_x == (float)frame);
+    }
+
+    tbevy_app_free(app);
+    assert(state.exits == 1);
+    printf("  ✓ Sub-app renders extracted frames on its own thread\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Bevy Sub-App Tests ===\n\n");
+
+    test_sub_app_extract();
+    test_sub_app_threaded();
+
+    printf("\n=== All Bevy Sub-App Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -0,0 +1,263 @@
+/*
+ * Test: Budgeted Iteration
+ * Tests resumable query cursors and time-sliced tbevy systems
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#define TINYECS_BEVY_IMPLEMENTATION
+#include "../tinyecs.h"
+#include "../tinyecs_bevy.h"
+
+typedef struct {
+    int index;
+    int visits;
+} Visit;
+
+typedef struct {
+    int value;
+} Health;
+
+static tecs_component_id_t Visit_id;
+
+/* Runs one budgeted slice and returns the rows it covered */
+static int visit_slice(tecs_query_t* query, tecs_query_cursor_t* cursor, int max_rows) {
+    int rows = 0;
+    tecs_query_iter_t* iter = tecs_query_iter_resume(query, cursor, max_rows);
+    while (tecs_iter_next(iter)) {
+        Visit* visits = (Visit*)tecs_iter_column(iter, tecs_iter_column_index(iter, Visit_id));
+        for (int i = 0; i < tecs_iter_count(iter); i++) visits[i].visits++;
+        rows += tecs_iter_count(iter);
+    }
+    tecs_query_iter_free(iter);
+    return rows;
+}
+
+static void test_cursor_row_budget(void) {
+    printf("Testing tecs_query_iter_resume() with a row budget...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    Visit_id = tecs_register_component(world, "Visit", sizeof(Visit));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+
+    const int count = TECS_CHUNK_SIZE * 2 + 300;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        Visit visit = {i, 0};
+        tecs_set(world, entities[i], Visit_id, &visit, sizeof(Visit));
+        if (i % 2 == 0) {
+            Health hp = {i};
+            tecs_set(world, entities[i], hp_id, &hp, sizeof(Health));
+        }
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, Visit_id);
+    tecs_query_build(query);
+
+    /* Slices never exceed the budget and split chunks where needed */
+    tecs_query_cursor_t cursor = {0};
+    int frames = 0;
+    int total = 0;
+    while (cursor.passes == 0) {
+        int rows = visit_slice(query, &cursor, 1000);
+        assert(rows <= 1000);
+        total += rows;
+        frames++;
+    }
+    assert(total == count);
+    assert(frames == count / 1000 + 1);
+
+    /* Ranges expose the right rows */
+    for (int i = 0; i < count; i++) {
+        Visit* visit = (Visit*)tecs_get(world, entities[i], Visit_id);
+        assert(visit->index == i && visit->visits == 1);
+    }
+
+    /* An unlimited slice finishes the next pass in one call */
+    assert(visit_slice(query, &cursor, 0) == count);
+    assert(cursor.passes == 2);
+
+    /* Change ticks and entities are offset like the columns */
+    tecs_query_iter_t* iter = tecs_query_iter_resume(query, &cursor, 10);
+    assert(tecs_iter_next(iter));
+    int first_row = tecs_iter_offset(iter);
+    assert(visit_slice(query, &cursor, 5) == 5);
+    tecs_query_iter_free(iter);
+
+    iter = tecs_query_iter_resume(query, &cursor, 10);
+    assert(tecs_iter_next(iter));
+    assert(tecs_iter_offset(iter) == first_row + 15);
+    assert(tecs_iter_count(iter) == 10);
+    int column = tecs_iter_column_index(iter, Visit_id);
+    Visit* visits = (Visit*)tecs_iter_column(iter, column);
+    tecs_entity_t* range = tecs_iter_entities(iter);
+    assert(tecs_get(world, range[3], Visit_id) == &visits[3]);
+    assert(tecs_iter_changed_ticks(iter, column) != NULL);
+    assert(!tecs_iter_next(iter));
+    tecs_query_iter_free(iter);
+
+    tecs_query_free(query);
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Budgeted slices cover every entity once per pass\n");
+}
+
+static void test_cursor_structural_changes(void) {
+    printf("Testing cursors across structural changes...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    Visit_id = tecs_register_component(world, "Visit", sizeof(Visit));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    tecs_component_id_t tag_id = tecs_register_component(world, "Tagged", 0);
+
+    tecs_entity_t plain[200];
+    tecs_entity_t healthy[200];
+    for (int i = 0; i < 200; i++) {
+        Visit visit = {i, 0};
+        Health hp = {i};
+        plain[i] = tecs_entity_new(world);
+        tecs_set(world, plain[i], Visit_id, &visit, sizeof(Visit));
+        healthy[i] = tecs_entity_new(world);
+        tecs_set(world, healthy[i], Visit_id, &visit, sizeof(Visit));
+        tecs_set(world, healthy[i], hp_id, &hp, sizeof(Health));
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, Visit_id);
+    tecs_query_build(query);
+
+    tecs_query_cursor_t cursor = {0};
+    assert(visit_slice(query, &cursor, 250) == 250);
+
+    /* New archetypes appear and an old one disappears between frames */
+    tecs_entity_t tagged[50];
+    for (int i = 0; i < 50; i++) {
+        Visit visit = {i, 0};
+        tagged[i] = tecs_entity_new(world);
+        tecs_set(world, tagged[i], Visit_id, &visit, sizeof(Visit));
+        tecs_add_tag(world, tagged[i], tag_id);
+    }
+    for (int i = 0; i < 200; i++) tecs_unset(world, healthy[i], hp_id);
+    assert(tecs_remove_empty_archetypes(world) >= 1);
+
+    /* Archetypes created behind the cursor are picked up by the next pass */
+    while (cursor.passes < 2) visit_slice(query, &cursor, 250);
+
+    for (int i = 0; i < 200; i++) {
+        assert(((Visit*)tecs_get(world, plain[i], Visit_id))->visits >= 1);
+        int visits = ((Visit*)tecs_get(world, healthy[i], Visit_id))->visits;
+        assert(visits >= 1 && visits <= 3);
+    }
+    for (int i = 0; i < 50; i++) {
+        assert(((Visit*)tecs_get(world, tagged[i], Visit_id))->visits >= 1);
+    }
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+    printf("  ✓ Cursors survive archetype creation and removal\n");
+}
+
+/* ============================================================================
+ * Time-Sliced Systems
+ * ========================================================================= */
+
+typedef struct {
+    tecs_query_t* query;
+    int passes_seen;
+    int batches;
+} SliceState;
+
+static void spin_ms(double ms) {
+    uint64_t start = tecs_time_ns();
+    while ((double)(tecs_time_ns() - start) < ms * 1e6) {}
+}
+
+static void sliced_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    SliceState* state = (SliceState*)user_data;
+    tecs_query_cursor_t* cursor = tbevy_system_cursor(ctx);
+    uint32_t pass = cursor->passes;
+
+    while (!tbevy_system_over_budget(ctx) && cursor->passes == pass) {
+        visit_slice(state->query, cursor, 100);
+        spin_ms(0.2);
+        state->batches++;
+    }
+    state->passes_seen = (int)cursor->passes;
+}
+
+static void slow_system(tbevy_system_ctx_t* ctx, void* user_data) {
+    (void)ctx;
+    (void)user_data;
+    spin_ms(1.0);
+}
+
+static void test_system_budgets(void) {
+    printf("Testing tbevy system budgets...\n");
+
+    tbevy_app_t* app = tbevy_app_new(TBEVY_THREADING_SINGLE);
+    tecs_world_t* world = tbevy_app_world(app);
+    Visit_id = tecs_register_component(world, "Visit", sizeof(Visit));
+
+    tecs_entity_t entities[1000];
+    for (int i = 0; i < 1000; i++) {
+        Visit visit = {i, 0};
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], Visit_id, &visit, sizeof(Visit));
+    }
+
+    SliceState state = {0};
+    state.query = tecs_query_new(world);
+    tecs_query_with(state.query, Visit_id);
+    tecs_query_build(state.query);
+
+    tbevy_system_build(tbevy_system_budget(tbevy_system_label(
+        tbevy_app_add_system(app, sliced_system, &state), "sliced"), 0.5));
+    tbevy_system_build(tbevy_system_budget(tbevy_system_label(
+        tbevy_app_add_system(app, slow_system, NULL), "slow"), 0.1));
+
+    /* The walk is spread over several frames */
+    tbevy_app_update(app);
+    assert(state.passes_seen == 0);
+    int frames = 1;
+    while (state.passes_seen == 0) {
+        tbevy_app_update(app);
+        frames++;
+    }
+    assert(frames > 1);
+    assert(state.batches == 11);  /* Ten batches plus the one that ends the pass */
+
+    for (int i = 0; i < 1000; i++) {
+        assert(((Visit*)tecs_get(world, entities[i], Visit_id))->visits == 1);
+    }
+
+    tbevy_system_stats_t stats;
+    assert(tbevy_app_system_stats(app, "slow", &stats));
+    assert(stats.run_count == (uint64_t)frames);
+    assert(stats.overrun_count == (uint64_t)frames);
+    assert(stats.max_ms >= 1.0 && stats.total_ms >= stats.max_ms);
+
+    assert(tbevy_app_system_stats(app, "sliced", &stats));
+    assert(stats.run_count == (uint64_t)frames);
+    assert(!tbevy_app_system_stats(app, "missing", &stats));
+
+    tecs_query_free(state.query);
+    tbevy_app_free(app);
+    printf("  ✓ Budgeted systems resume across frames and overruns are counted\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Budgeted Iteration Tests ===\n\n");
+
+    test_cursor_row_budget();
+    test_cursor_structural_changes();
+    test_system_budgets();
+
+    printf("\n=== All Budgeted Iteration Tests Passed ✓ ===\n");
+    return 0;
+}
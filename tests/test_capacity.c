@@ -0,0 +1,148 @@
+/*
+ * Test: Capacity Planning
+ * Tests that reserved and warmed-up worlds spawn without growth allocations
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static int allocations = 0;
+
+static void* counted_malloc(size_t size) { allocations++; return malloc(size); }
+static void* counted_calloc(size_t count, size_t size) { allocations++; return calloc(count, size); }
+static void* counted_realloc(void* ptr, size_t size) { allocations++; return realloc(ptr, size); }
+
+#define TECS_MALLOC(size) counted_malloc(size)
+#define TECS_CALLOC(count, size) counted_calloc(count, size)
+#define TECS_REALLOC(ptr, size) counted_realloc(ptr, size)
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+static int count_query(tecs_query_t* query) {
+    int total = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) total += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    return total;
+}
+
+static void spawn(tecs_world_t* world, tecs_component_id_t pos_id, tecs_component_id_t vel_id, int count) {
+    Position pos = {0.0f, 0.0f};
+    Velocity vel = {1.0f, 1.0f};
+    for (int i = 0; i < count; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_set(world, e, vel_id, &vel, sizeof(Velocity));
+    }
+}
+
+static void test_reserve_rows(void) {
+    printf("Testing tecs_world_reserve_entities() and tecs_world_reserve_rows()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+
+    const int count = TECS_CHUNK_SIZE * 3;
+    tecs_component_id_t path[] = {pos_id, vel_id};
+    tecs_world_reserve_entities(world, count);
+    assert(tecs_world_reserve_rows(world, path, 2, count) == 3);
+    assert(tecs_world_reserve_rows(world, path, 2, count) == 0);  /* Already free */
+    assert(tecs_world_archetype_count(world) == 3);
+
+    /* The first wave allocates nothing */
+    allocations = 0;
+    spawn(world, pos_id, vel_id, count);
+    assert(allocations == 0);
+    assert(tecs_world_entity_count(world) == count);
+
+    /* Unregistered components cannot be planned */
+    tecs_component_id_t bogus[] = {pos_id, 999};
+    assert(tecs_world_reserve_rows(world, bogus, 2, 10) == -1);
+
+    tecs_world_free(world);
+    printf("  ✓ Reserved waves spawn without growth events\n");
+}
+
+static void test_warm_up(void) {
+    printf("Testing tecs_world_warm_up()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    tecs_component_id_t kinds[64];
+    for (int i = 0; i < 64; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Kind%d", i);
+        kinds[i] = tecs_register_component(world, name, 0);
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+
+    /* Every kind of unit: a tag, then Position and Velocity */
+    tecs_component_id_t paths[64][3];
+    tecs_archetype_desc_t descs[64];
+    for (int i = 0; i < 64; i++) {
+        paths[i][0] = kinds[i];
+        paths[i][1] = pos_id;
+        paths[i][2] = vel_id;
+        descs[i].components = paths[i];
+        descs[i].component_count = 3;
+        descs[i].rows = 16;
+    }
+    tecs_world_reserve_entities(world, 64 * 16);
+    assert(tecs_world_warm_up(world, descs, 64) == 64);
+    assert(tecs_world_archetype_count(world) == 1 + 64 * 3);
+
+    allocations = 0;
+    Position pos = {0.0f, 0.0f};
+    Velocity vel = {1.0f, 1.0f};
+    for (int n = 0; n < 16; n++) {
+        for (int i = 0; i < 64; i++) {
+            tecs_entity_t e = tecs_entity_new(world);
+            tecs_add_tag(world, e, kinds[i]);
+            tecs_set(world, e, pos_id, &pos, sizeof(Position));
+            tecs_set(world, e, vel_id, &vel, sizeof(Velocity));
+        }
+    }
+    assert(allocations == 0);
+
+    /* Registered queries were matched during the warm-up */
+    assert(count_query(query) == 64 * 16);
+
+    /* Warmed archetypes are ordinary empty archetypes to the GC */
+    tecs_world_t* spare = tecs_world_new();
+    tecs_component_id_t spare_pos = tecs_register_component(spare, "Position", sizeof(Position));
+    tecs_archetype_desc_t desc = {&spare_pos, 1, 100};
+    tecs_world_warm_up(spare, &desc, 1);
+    assert(tecs_world_chunk_count(spare) == 2);
+    assert(tecs_remove_empty_archetypes(spare) == 1);
+    tecs_world_free(spare);
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+    printf("  ✓ Warm-up builds archetypes, edges, chunks and query matches\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Capacity Planning Tests ===\n\n");
+
+    test_reserve_rows();
+    test_warm_up();
+
+    printf("\n=== All Capacity Planning Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -0,0 +1,255 @@
+/*
+ * Test: Component Type Hooks
+ * Tests constructors, destructors, copies and relocation of owning components
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+/* Owns a heap string */
+typedef struct {
+    char* text;
+} Name;
+
+/* Points into itself, so it is only valid at its current address */
+typedef struct {
+    int value;
+    int* self;
+} Anchored;
+
+typedef struct {
+    float x, y;
+} Position;
+
+static int live_names = 0;
+static int relocations = 0;
+
+static char* copy_text(const char* text) {
+    char* copy = malloc(strlen(text) + 1);
+    strcpy(copy, text);
+    live_names++;
+    return copy;
+}
+
+static void name_ctor(void* ptr, int count, void* user_data) {
+    (void)user_data;
+    Name* names = (Name*)ptr;
+    for (int i = 0; i < count; i++) names[i].text = copy_text("");
+}
+
+static void name_dtor(void* ptr, int count, void* user_data) {
+    (void)user_data;
+    Name* names = (Name*)ptr;
+    for (int i = 0; i < count; i++) {
+        free(names[i].text);
+        live_names--;
+    }
+}
+
+static void name_copy(void* dst, const void* src, int count, void* user_data) {
+    (void)user_data;
+    for (int i = 0; i < count; i++) {
+        ((Name*)dst)[i].text = copy_text(((const Name*)src)[i].text);
+    }
+}
+
+static void anchored_relocate(void* dst, void* src, int count, void* user_data) {
+    int* calls = (int*)user_data;
+    (*calls)++;
+    memcpy(dst, src, (size_t)count * sizeof(Anchored));
+    Anchored* anchors = (Anchored*)dst;
+    for (int i = 0; i < count; i++) anchors[i].self = &anchors[i].value;
+    relocations += count;
+}
+
+static void set_anchored(tecs_world_t* world, tecs_entity_t e, tecs_component_id_t id, int value) {
+    tecs_set(world, e, id, NULL, sizeof(Anchored));
+    Anchored* anchor = (Anchored*)tecs_get(world, e, id);
+    anchor->value = value;
+    anchor->self = &anchor->value;
+}
+
+static bool anchored_ok(tecs_world_t* world, tecs_entity_t e, tecs_component_id_t id, int value) {
+    Anchored* anchor = (Anchored*)tecs_get(world, e, id);
+    return anchor && anchor->value == value && anchor->self == &anchor->value;
+}
+
+static tecs_component_id_t register_name(tecs_world_t* world) {
+    tecs_type_hooks_t hooks = {0};
+    hooks.ctor = name_ctor;
+    hooks.dtor = name_dtor;
+    hooks.copy = name_copy;
+    return tecs_register_component_hooks(world, "Name", sizeof(Name), NULL, &hooks);
+}
+
+static void test_hooks_lifecycle(void) {
+    printf("Testing ctor/dtor/copy hooks...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t name_id = register_name(world);
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+
+    /* tecs_set copies through the hook, so the caller keeps its value */
+    char local[] = "player";
+    Name name = {local};
+    tecs_entity_t e = tecs_entity_new(world);
+    tecs_set(world, e, name_id, &name, sizeof(Name));
+    assert(live_names == 1);
+    assert(((Name*)tecs_get(world, e, name_id))->text != local);
+
+    /* Overwriting destroys the old value, self-assignment is a no-op */
+    Name other = {"hero"};
+    tecs_set(world, e, name_id, &other, sizeof(Name));
+    tecs_set(world, e, name_id, tecs_get(world, e, name_id), sizeof(Name));
+    assert(live_names == 1);
+    assert(strcmp(((Name*)tecs_get(world, e, name_id))->text, "hero") == 0);
+
+    /* Transitions move the value without copying it */
+    Position pos = {1.0f, 2.0f};
+    tecs_set(world, e, pos_id, &pos, sizeof(Position));
+    tecs_unset(world, e, pos_id);
+    assert(live_names == 1);
+    assert(strcmp(((Name*)tecs_get(world, e, name_id))->text, "hero") == 0);
+
+    tecs_unset(world, e, name_id);
+    assert(live_names == 0);
+
+    /* NULL data default-constructs */
+    tecs_set(world, e, name_id, NULL, sizeof(Name));
+    assert(live_names == 1 && ((Name*)tecs_get(world, e, name_id))->text[0] == '\0');
+
+    /* Deletes destroy the row and swap the last one into it */
+    tecs_entity_t entities[100];
+    for (int i = 0; i < 100; i++) {
+        char text[16];
+        snprintf(text, sizeof(text), "n%d", i);
+        Name n = {text};
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], name_id, &n, sizeof(Name));
+    }
+    assert(live_names == 101);
+    for (int i = 0; i < 100; i += 2) tecs_entity_delete(world, entities[i]);
+    assert(live_names == 51);
+    for (int i = 1; i < 100; i += 2) {
+        char text[16];
+        snprintf(text, sizeof(text), "n%d", i);
+        assert(strcmp(((Name*)tecs_get(world, entities[i], name_id))->text, text) == 0);
+    }
+
+    /* Clearing and freeing the world destroy the remaining rows */
+    tecs_world_clear(world);
+    assert(live_names == 0);
+    for (int i = 0; i < 10; i++) {
+        tecs_entity_t fresh = tecs_entity_new(world);
+        tecs_set(world, fresh, name_id, &name, sizeof(Name));
+        tecs_set(world, fresh, pos_id, &pos, sizeof(Position));
+    }
+    assert(live_names == 10);
+    tecs_world_free(world);
+    assert(live_names == 0);
+    printf("  ✓ Owning components are copied in and destroyed exactly once\n");
+}
+
+static void test_hooks_relocate(void) {
+    printf("Testing relocate hooks...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t anchor_id = tecs_register_component(world, "Anchored", sizeof(Anchored));
+
+    /* Hooks can be attached after registration */
+    int calls = 0;
+    tecs_type_hooks_t hooks = {0};
+    hooks.relocate = anchored_relocate;
+    hooks.user_data = &calls;
+    tecs_set_component_hooks(world, anchor_id, &hooks);
+
+    const int count = 300;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        set_anchored(world, entities[i], anchor_id, i);
+    }
+
+    /* Transitions relocate into the new archetype */
+    relocations = 0;
+    Position pos = {0.0f, 0.0f};
+    for (int i = 0; i < count; i += 3) tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+    assert(relocations > count / 3);
+
+    /* Swap-removes relocate the last row */
+    for (int i = 1; i < count; i += 3) tecs_entity_delete(world, entities[i]);
+    for (int i = 0; i < count; i++) {
+        if (i % 3 != 1) assert(anchored_ok(world, entities[i], anchor_id, i));
+    }
+
+    /* Hooked archetypes stay resident */
+    for (int i = 0; i < 3; i++) tecs_world_update(world);
+    assert(tecs_world_hibernate(world, 0) == 0);
+
+    /* Without the hook the bytes are moved as-is */
+    tecs_set_component_hooks(world, anchor_id, NULL);
+    calls = 0;
+    tecs_unset(world, entities[0], pos_id);
+    assert(calls == 0);
+
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Transitions and swap-removes relocate non-trivial components\n");
+}
+
+static void test_hooks_transfer(void) {
+    printf("Testing hooks across world transfers...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+    tecs_component_id_t name_id = register_name(src);
+
+    tecs_query_t* query = tecs_query_new(src);
+    tecs_query_with(query, name_id);
+    tecs_query_build(query);
+
+    for (int i = 0; i < 50; i++) {
+        Name name = {"crate"};
+        tecs_entity_t e = tecs_entity_new(src);
+        tecs_set(src, e, name_id, &name, sizeof(Name));
+    }
+    assert(live_names == 50);
+
+    /* Copies run the copy hook; the destination registers the same hooks */
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    assert(tecs_transfer_query(map, query, TECS_TRANSFER_COPY, NULL) == 50);
+    assert(live_names == 100);
+
+    tecs_world_clear(dst);
+    assert(live_names == 50);
+
+    /* Moves relocate, leaving nothing to destroy in the source */
+    assert(tecs_transfer_query(map, query, TECS_TRANSFER_MOVE, NULL) == 50);
+    assert(live_names == 50);
+    assert(tecs_world_entity_count(src) == 0);
+
+    tecs_world_map_free(map);
+    tecs_query_free(query);
+    tecs_world_free(src);
+    assert(live_names == 50);
+    tecs_world_free(dst);
+    assert(live_names == 0);
+    printf("  ✓ Copying and moving transfers keep ownership balanced\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Component Hook Tests ===\n\n");
+
+    test_hooks_lifecycle();
+    test_hooks_relocate();
+    test_hooks_transfer();
+
+    printf("\n=== All Component Hook Tests Passed ✓ ===\n");
+    return 0;
+}
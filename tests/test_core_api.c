@@ -141,6 +141,58 @@ static void test_get_component_id(void) {
     tecs_world_free(world);
 }
 
+static void test_stable_component_ids(void) {
+    printf("Testing name-derived component IDs...\n");
+
+    tecs_world_t* a = tecs_world_new();
+    tecs_world_t* b = tecs_world_new();
+
+    /* Registration order does not matter */
+    tecs_component_id_t pos_a = tecs_register_component(a, "Position", sizeof(Position));
+    tecs_component_id_t vel_a = tecs_register_component(a, "Velocity", sizeof(Velocity));
+    tecs_component_id_t vel_b = tecs_register_component(b, "Velocity", sizeof(Velocity));
+    tecs_component_id_t pos_b = tecs_register_component(b, "Position", sizeof(Position));
+    assert(pos_a == pos_b && vel_a == vel_b);
+    assert(pos_a == tecs_component_id_of("Position"));
+
+    /* Registering again returns the same ID without a second registry entry */
+    assert(tecs_register_component(a, "Position", sizeof(Position)) == pos_a);
+    assert(tecs_get_component_size(a, pos_a) == (int)sizeof(Position));
+
+    /* Enough names to grow the name index past its initial capacity */
+    for (int i = 0; i < 1500; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Generated%d", i);
+        tecs_component_id_t id = tecs_register_component(a, name, 4);
+        assert(id != 0 && id == tecs_component_id_of(name));
+    }
+    for (int i = 0; i < 1500; i += 7) {
+        char name[32];
+        snprintf(name, sizeof(name), "Generated%d", i);
+        assert(tecs_get_component_id(a, name) == tecs_component_id_of(name));
+        assert(tecs_get_component_id(b, name) == 0);
+    }
+    assert(tecs_get_component_id(a, "Velocity") == vel_a);
+
+    /* The whole name counts, not just a prefix */
+    const char* state = "game::systems::inventory::components::detail::PlayerInventoryState";
+    const char* stats = "game::systems::inventory::components::detail::PlayerInventoryStats";
+    tecs_component_id_t state_id = tecs_register_component(a, state, 4);
+    tecs_component_id_t stats_id = tecs_register_component(a, stats, 4096);
+    assert(state_id != 0 && stats_id != 0 && state_id != stats_id);
+    assert(tecs_get_component_size(a, stats_id) == 4096);
+    assert(tecs_get_component_id(a, stats) == stats_id);
+
+    /* A name keeps its first size */
+    tecs_component_id_t resized = tecs_register_component(a, "Position", sizeof(Position) * 2);
+    assert(resized == 0);
+    (void)state_id; (void)stats_id; (void)resized;
+
+    tecs_world_free(a);
+    tecs_world_free(b);
+    printf("  ✓ Same name, same ID in every world; full names hashed, sizes must match\n");
+}
+
 /* ========================================================================
  * Entity Management Tests
  * ======================================================================== */
@@ -181,6 +233,51 @@ static void test_entity_new_with_id(void) {
     tecs_world_free(world);
 }
 
+static void test_entity_reserved_id_range(void) {
+    printf("Testing tecs_world_reserve_id_range()...\n");
+    
+    tecs_world_t* world = tecs_world_new();
+    
+    /* Indices [0, 1000) belong to the server; local entities go elsewhere */
+    tecs_world_reserve_id_range(world, 0, 1000);
+    
+    tecs_entity_t local = tecs_entity_new(world);
+    assert(TECS_ENTITY_INDEX(local) >= 1000);
+    assert(!tecs_entity_id_is_reserved(world, local));
+    
+    tecs_entity_t server_id = TECS_ENTITY_MAKE(42, 3);
+    assert(tecs_entity_id_is_reserved(world, server_id));
+    
+    tecs_entity_t e = tecs_entity_new_with_id(world, server_id);
+    assert(e == server_id);
+    assert(tecs_entity_exists(world, server_id));
+    
+    /* Same ID again is idempotent, a different generation collides */
+    assert(tecs_entity_new_with_id(world, server_id) == server_id);
+    assert(tecs_entity_new_with_id(world, TECS_ENTITY_MAKE(42, 4)) == TECS_ENTITY_NULL);
+    
+    /* Deleted reserved indices are never handed out locally */
+    tecs_entity_delete(world, server_id);
+    assert(!tecs_entity_exists(world, server_id));
+    for (int i = 0; i < 100; i++) {
+        tecs_entity_t n = tecs_entity_new(world);
+        assert(TECS_ENTITY_INDEX(n) >= 1000);
+    }
+    
+    /* An explicit ID ahead of the allocator is skipped when it gets there */
+    tecs_entity_t ahead = TECS_ENTITY_MAKE(1102, 0);
+    assert(tecs_entity_new_with_id(world, ahead) == ahead);
+    for (int i = 0; i < 10; i++) {
+        tecs_entity_t n = tecs_entity_new(world);
+        assert(n != ahead);
+        assert(TECS_ENTITY_INDEX(n) != 1102);
+    }
+    
+    printf("  ✓ Reserved IDs spawn with collision checks and stay out of local allocation\n");
+    
+    tecs_world_free(world);
+}
+
 static void test_entity_delete(void) {
     printf("Testing tecs_entity_delete()...\n");
     
@@ -204,6 +301,41 @@ static void test_entity_delete(void) {
     tecs_world_free(world);
 }
 
+static void test_entity_delete_swaps_rows(void) {
+    printf("Testing row bookkeeping after swap-remove...\n");
+    
+    tecs_world_t* world = tecs_world_new();
+    
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    
+    tecs_entity_t entities[8];
+    for (int i = 0; i < 8; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {(float)i, 0.0f};
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+    }
+    
+    /* Moving and deleting entities swaps the last row into the hole */
+    Velocity vel = {1.0f, 1.0f};
+    tecs_set(world, entities[0], vel_id, &vel, sizeof(Velocity));
+    tecs_entity_delete(world, entities[3]);
+    tecs_entity_t recycled = tecs_entity_new(world);
+    assert(TECS_ENTITY_INDEX(recycled) == TECS_ENTITY_INDEX(entities[3]));
+    assert(recycled != entities[3]);
+    assert(!tecs_entity_exists(world, entities[3]));
+    
+    for (int i = 0; i < 8; i++) {
+        if (i == 3) continue;
+        Position* p = (Position*)tecs_get(world, entities[i], pos_id);
+        assert(p && p->x == (float)i);
+    }
+    
+    printf("  ✓ Swapped entities keep their component data\n");
+    
+    tecs_world_free(world);
+}
+
 static void test_entity_exists(void) {
     printf("Testing tecs_entity_exists()...\n");
     
@@ -524,6 +656,67 @@ static void test_query_entities(void) {
     tecs_world_free(world);
 }
 
+static void test_query_prefetch(void) {
+    printf("Testing tecs_query_set_prefetch()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+    tecs_component_id_t tags[6];
+    for (int t = 0; t < 6; t++) {
+        char name[16];
+        snprintf(name, sizeof(name), "Tag%d", t);
+        tags[t] = tecs_register_component(world, name, 0);
+    }
+
+    /* 64 small archetypes, a few of them emptied again */
+    for (int i = 0; i < 640; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        Position pos = {(float)i, 1.0f};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        Velocity vel = {1.0f, 0.0f};
+        if (i % 3) tecs_set(world, e, vel_id, &vel, sizeof(Velocity));
+        for (int t = 0; t < 6; t++) {
+            if ((i % 64) & (1 << t)) tecs_add_tag(world, e, tags[t]);
+        }
+        if (i % 64 == 5 || i % 64 == 17) tecs_entity_delete(world, e);
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_without(query, tags[3]);
+    tecs_query_optional(query, vel_id);
+    tecs_query_build(query);
+
+    static const int distances[] = {0, 1, 2, 3, 4, 16, 1000};
+    int expected_rows = -1;
+    double expected_sum = 0.0;
+    for (int d = 0; d < 7; d++) {
+        tecs_query_set_prefetch(query, distances[d]);
+        int rows = 0;
+        double sum = 0.0;
+        tecs_query_iter_t* iter = tecs_query_iter(query);
+        while (tecs_iter_next(iter)) {
+            int count = tecs_iter_count(iter);
+            Position* pos = (Position*)tecs_iter_column(iter, tecs_iter_column_index(iter, pos_id));
+            for (int i = 0; i < count; i++) sum += pos[i].x;
+            rows += count;
+        }
+        tecs_query_iter_free(iter);
+
+        if (expected_rows < 0) {
+            expected_rows = rows;
+            expected_sum = sum;
+        }
+        assert(rows == expected_rows && sum == expected_sum);
+    }
+    assert(expected_rows == 640 - 20 - 320);  /* Deleted rows, then Tag3 */
+    printf("  ✓ Every prefetch distance visits the same rows\n");
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+}
+
 /* ========================================================================
  * Tag Component Tests
  * ======================================================================== */
@@ -681,11 +874,14 @@ int main(void) {
     /* Component Registration */
     test_register_component();
     test_get_component_id();
+    test_stable_component_ids();
     
     /* Entity Management */
     test_entity_new();
     test_entity_new_with_id();
+    test_entity_reserved_id_range();
     test_entity_delete();
+    test_entity_delete_swaps_rows();
     test_entity_exists();
     
     /* Component Operations */
@@ -699,6 +895,7 @@ int main(void) {
     test_query_without();
     test_query_changed();
     test_query_entities();
+    test_query_prefetch();
     
     /* Tag Components */
     test_tag_components();
@@ -0,0 +1,257 @@
+/*
+ * Test: C++ API
+ * Tests typed queries, the type-keyed component registry and par_each on a task pool
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../tinyecs.hpp"
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Health {
+    int value;
+};
+
+struct Frozen {};
+
+/* Owns heap memory, so it gets lifecycle hooks */
+struct Label {
+    std::string text;
+    std::vector<int> tags;
+};
+
+/* Move-only: no copy hook, set from rvalues */
+struct Owner {
+    std::unique_ptr<int> p;
+};
+
+static void test_typed_each(void) {
+    printf("Testing tecs::query<...>::each()...\n");
+
+    tecs::world world;
+    world.reserve_entities(TECS_CHUNK_SIZE + 100);
+    world.reserve<Position, Velocity>(TECS_CHUNK_SIZE + 100);
+
+    std::vector<tecs_entity_t> entities;
+    for (int i = 0; i < TECS_CHUNK_SIZE + 100; i++) {
+        tecs_entity_t e = world.entity();
+        world.set(e, Position{(float)i, 0.0f});
+        world.set(e, Velocity{1.0f, 2.0f});
+        if (i % 10 == 0) world.add<Frozen>(e);
+        if (i % 2 == 0) world.set(e, Health{i});
+        entities.push_back(e);
+    }
+
+    /* IDs are resolved once per world */
+    assert(world.component<Position>() == world.component<Position>());
+    assert(world.component<Position>() != world.component<Velocity>());
+    assert(tecs_get_component_size(world.c_ptr(), world.component<Frozen>()) == 0);
+
+    auto movers = world.query<Position, const Velocity, tecs::Without<Frozen>>();
+    movers.each([](Position& p, const Velocity& v) {
+        p.x += v.x;
+        p.y += v.y;
+    });
+
+    for (size_t i = 0; i < entities.size(); i++) {
+        const Position* p = world.get<Position>(entities[i]);
+        float expected = (float)i + (i % 10 == 0 ? 0.0f : 1.0f);
+        assert(p->x == expected);
+    }
+
+    /* Entity parameter, tag filter and optional columns */
+    int frozen = 0;
+    world.query<tecs::With<Frozen>, Position>().each([&](tecs_entity_t e, Position& p) {
+        assert(world.has<Frozen>(e));
+        assert(p.y == 0.0f);
+        frozen++;
+    });
+    assert(frozen == (TECS_CHUNK_SIZE + 100 + 9) / 10);
+
+    int with_health = 0;
+    int total = 0;
+    world.query<const Position, tecs::Optional<Health>>().each([&](const Position& p, Health* hp) {
+        if (hp) {
+            assert(hp->value == (int)(p.x - (p.y == 0.0f ? 0.0f : 1.0f)));
+            with_health++;
+        }
+        total++;
+    });
+    assert(total == TECS_CHUNK_SIZE + 100);
+    assert(with_health == (TECS_CHUNK_SIZE + 100) / 2);
+
+    assert(world.query<Frozen>().count() == frozen);
+
+    world.unset<Frozen>(entities[0]);
+    world.destroy(entities[1]);
+    assert(!world.has<Frozen>(entities[0]));
+    assert(!world.exists(entities[1]));
+    assert(world.entity_count() == TECS_CHUNK_SIZE + 99);
+
+    printf("  ✓ Typed queries bind columns and filters at compile time\n");
+}
+
+static void test_c_interop(void) {
+    printf("Testing C/C++ component sharing...\n");
+
+    tecs_world_t* c_world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(c_world, "Position", sizeof(Position));
+
+    tecs_entity_t e = tecs_entity_new(c_world);
+    Position pos = {3.0f, 4.0f};
+    tecs_set(c_world, e, pos_id, &pos, sizeof(Position));
+
+    {
+        tecs::world world(c_world);
+        assert(world.component<Position>("Position") == pos_id);
+        assert(world.get<Position>(e)->y == 4.0f);
+        world.query<Position>().each([](Position& p) { p.y = 10.0f; });
+    }
+
+    /* The wrapper does not own the C world */
+    assert(((Position*)tecs_get(c_world, e, pos_id))->y == 10.0f);
+    tecs_world_free(c_world);
+    printf("  ✓ Wrapped worlds reuse C component IDs by name\n");
+}
+
+static void test_owning_components(void) {
+    printf("Testing non-trivial component types...\n");
+
+    tecs::world world;
+    std::vector<tecs_entity_t> entities;
+    for (int i = 0; i < 200; i++) {
+        tecs_entity_t e = world.entity();
+        world.set(e, Label{"entity with a name too long for small-string storage " + std::to_string(i), {i}});
+        entities.push_back(e);
+    }
+
+    /* Transitions and swap-removes move the strings between chunks */
+    for (int i = 0; i < 200; i += 2) world.set(entities[i], Position{0.0f, 0.0f});
+    for (int i = 0; i < 200; i += 3) world.destroy(entities[i]);
+    world.add<Label>(entities[1]);
+
+    for (int i = 2; i < 200; i++) {
+        if (i % 3 == 0) continue;
+        const Label* label = world.get<Label>(entities[i]);
+        assert(label->tags.size() == 1 && label->tags[0] == i);
+        assert(label->text.compare(label->text.size() - std::to_string(i).size(), std::string::npos,
+                                   std::to_string(i)) == 0);
+    }
+    assert(world.get<Label>(entities[1])->text.empty());
+
+    int labelled = 0;
+    world.query<const Label, tecs::Without<Position>>().each([&](const Label& label) {
+        if (!label.text.empty()) labelled++;
+    });
+    assert(labelled == 66);
+    printf("  ✓ std::string and std::vector members live inline in chunks\n");
+}
+
+static void test_move_only_components(void) {
+    printf("Testing move-only component types...\n");
+
+    tecs::world world;
+    std::vector<tecs_entity_t> entities;
+    for (int i = 0; i < 100; i++) {
+        tecs_entity_t e = world.entity();
+        world.set(e, Owner{std::make_unique<int>(i)});
+        entities.push_back(e);
+    }
+
+    /* Overwrites, transitions and swap-removes relocate the pointers */
+    world.set(entities[0], Owner{std::make_unique<int>(-1)});
+    for (int i = 0; i < 100; i += 2) world.set(entities[i], Position{0.0f, 0.0f});
+    for (int i = 1; i < 100; i += 4) world.destroy(entities[i]);
+    assert(*world.get<Owner>(entities[0])->p == -1);
+    for (int i = 2; i < 100; i++) {
+        if (i % 4 == 1) continue;
+        assert(*world.get<Owner>(entities[i])->p == i);
+    }
+
+    /* Deferred moves own the value until applied; dropped ones are destroyed */
+    Owner value{std::make_unique<int>(7)};
+    tecs_begin_deferred(world.c_ptr());
+    world.set(entities[2], std::move(value));
+    world.set(entities[3], Owner{std::make_unique<int>(8)});
+    world.destroy(entities[3]);
+    world.set(entities[3], Owner{std::make_unique<int>(9)});
+    tecs_end_deferred(world.c_ptr());
+    assert(!value.p && *world.get<Owner>(entities[2])->p == 7);
+    assert(!world.exists(entities[3]));
+
+    /* Still queued when the world is freed */
+    tecs_begin_deferred(world.c_ptr());
+    world.set(entities[4], Owner{std::make_unique<int>(10)});
+    printf("  ✓ std::unique_ptr members are moved, never copied\n");
+}
+
+static void sum_indices(void* arg, int index, int worker) {
+    (void)worker;
+    __atomic_add_fetch((long*)arg, (long)index, __ATOMIC_RELAXED);
+}
+
+static void test_task_pool_par_each(void) {
+    printf("Testing tecs_task_pool_t and par_each()...\n");
+
+    tecs_task_pool_t* pool = tecs_task_pool_new(4);
+    assert(tecs_task_pool_size(pool) >= 1);
+
+    /* Every index runs exactly once, repeatedly */
+    for (int round = 0; round < 50; round++) {
+        long sum = 0;
+        tecs_task_pool_run(pool, 1000, sum_indices, &sum);
+        assert(sum == 999L * 1000L / 2);
+    }
+
+    tecs::world world;
+    const int count = TECS_CHUNK_SIZE * 4 + 7;
+    for (int i = 0; i < count; i++) {
+        tecs_entity_t e = world.entity();
+        world.set(e, Position{(float)i, 0.0f});
+        world.set(e, Velocity{0.5f, (float)(i % 3)});
+    }
+
+    auto movers = world.query<Position, const Velocity>();
+    for (int frame = 0; frame < 4; frame++) {
+        movers.par_each(pool, [](Position& p, const Velocity& v) {
+            p.x += v.x;
+            p.y += v.y;
+        });
+    }
+
+    int checked = 0;
+    movers.each([&](tecs_entity_t e, Position& p, const Velocity& v) {
+        (void)e;
+        assert(p.y == v.y * 4.0f);
+        checked++;
+    });
+    assert(checked == count);
+
+    tecs_task_pool_free(pool);
+    printf("  ✓ par_each splits chunks across the pool\n");
+}
+
+int main(void) {
+    printf("=== TinyECS C++ API Tests ===\n\n");
+
+    test_typed_each();
+    test_c_interop();
+    test_owning_components();
+    test_move_only_components();
+    test_task_pool_par_each();
+
+    printf("\n=== All C++ API Tests Passed ✓ ===\n");
+    return 0;
+}
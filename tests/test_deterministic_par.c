@@ -0,0 +1,200 @@
+/*
+ * Test: Deterministic Parallel Execution
+ * Tests that tecs_query_par_run() gives the same world, IDs and events for any pool size
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+#define KINDS 4
+#define ENTITY_COUNT 20000
+#define FRAMES 6
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+typedef struct {
+    int frames;
+} Lifetime;
+
+enum { EVENT_EXPIRED = 1, EVENT_SPAWNED = 2 };
+
+typedef struct {
+    tecs_world_t* world;
+    tecs_component_id_t pos_id, vel_id, life_id;
+    tecs_query_t* query;
+
+    /* Resolved event log */
+    uint64_t event_hash;
+    int expired;
+    int spawned;
+} sim_t;
+
+static void sim_init(sim_t* sim) {
+    memset(sim, 0, sizeof(*sim));
+    sim->world = tecs_world_new();
+    sim->pos_id = tecs_register_component(sim->world, "Position", sizeof(Position));
+    sim->vel_id = tecs_register_component(sim->world, "Velocity", sizeof(Velocity));
+    sim->life_id = tecs_register_component(sim->world, "Lifetime", sizeof(Lifetime));
+
+    tecs_component_id_t kinds[KINDS];
+    for (int k = 0; k < KINDS; k++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Kind%d", k);
+        kinds[k] = tecs_register_component(sim->world, name, 0);
+    }
+
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        Position pos = {(float)i, 0.0f};
+        Velocity vel = {1.0f, (float)(i % 5)};
+        Lifetime life = {1 + i % 13};
+        tecs_entity_t e = tecs_entity_new(sim->world);
+        tecs_add_tag(sim->world, e, kinds[i % KINDS]);
+        tecs_set(sim->world, e, sim->pos_id, &pos, sizeof(Position));
+        tecs_set(sim->world, e, sim->vel_id, &vel, sizeof(Velocity));
+        tecs_set(sim->world, e, sim->life_id, &life, sizeof(Lifetime));
+    }
+
+    sim->query = tecs_query_new(sim->world);
+    tecs_query_with(sim->query, sim->pos_id);
+    tecs_query_with(sim->query, sim->vel_id);
+    tecs_query_with(sim->query, sim->life_id);
+    tecs_query_build(sim->query);
+}
+
+static void sim_free(sim_t* sim) {
+    tecs_query_free(sim->query);
+    tecs_world_free(sim->world);
+}
+
+static void kernel(tecs_par_ctx_t* ctx, tecs_query_iter_t* iter, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    int count = tecs_iter_count(iter);
+    tecs_entity_t* entities = tecs_iter_entities(iter);
+    Position* pos = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->pos_id));
+    Velocity* vel = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->vel_id));
+    Lifetime* life = tecs_iter_column(iter, tecs_iter_column_index(iter, sim->life_id));
+
+    for (int i = 0; i < count; i++) {
+        pos[i].x += vel[i].x;
+        pos[i].y += vel[i].y;
+
+        if (--life[i].frames == 0) {
+            tecs_par_delete(ctx, entities[i]);
+            tecs_par_emit(ctx, EVENT_EXPIRED, &entities[i], sizeof(tecs_entity_t));
+        } else if (life[i].frames == 7) {
+            /* Spawn a short-lived copy; the new ID is provisional until the merge */
+            tecs_entity_t child = tecs_par_spawn(ctx);
+            Lifetime child_life = {3};
+            tecs_par_set(ctx, child, sim->pos_id, &pos[i], sizeof(Position));
+            tecs_par_set(ctx, child, sim->vel_id, &vel[i], sizeof(Velocity));
+            tecs_par_set(ctx, child, sim->life_id, &child_life, sizeof(Lifetime));
+            tecs_par_emit(ctx, EVENT_SPAWNED, &child, sizeof(tecs_entity_t));
+        }
+    }
+}
+
+static void on_event(tecs_par_ctx_t* ctx, uint32_t type, const void* data, int size, void* user_data) {
+    sim_t* sim = (sim_t*)user_data;
+    assert(size == sizeof(tecs_entity_t));
+    tecs_entity_t entity = tecs_par_resolve(ctx, *(const tecs_entity_t*)data);
+
+    if (type == EVENT_SPAWNED) {
+        assert(!(entity & TECS_ENTITY_PROVISIONAL));
+        assert(tecs_entity_exists(sim->world, entity));
+        assert(((Lifetime*)tecs_get(sim->world, entity, sim->life_id))->frames == 3);
+        sim->spawned++;
+    } else {
+        assert(!tecs_entity_exists(sim->world, entity));
+        sim->expired++;
+    }
+    sim->event_hash = (sim->event_hash ^ (entity + type)) * 0x100000001B3ULL;
+}
+
+static void test_pool_size_independence(void) {
+    printf("Testing tecs_query_par_run() across pool sizes...\n");
+
+    const int pool_sizes[] = {0, 1, 2, 4, 8};
+    const int config_count = (int)(sizeof(pool_sizes) / sizeof(pool_sizes[0]));
+    uint64_t world_hashes[FRAMES];
+    uint64_t event_hash = 0;
+    int partitions = 0;
+
+    for (int config = 0; config < config_count; config++) {
+        sim_t sim;
+        sim_init(&sim);
+        tecs_task_pool_t* pool = pool_sizes[config] ? tecs_task_pool_new(pool_sizes[config]) : NULL;
+        tecs_par_desc_t desc = {kernel, on_event, &sim, 256};
+
+        for (int frame = 0; frame < FRAMES; frame++) {
+            int ran = tecs_query_par_run(sim.query, pool, &desc);
+            uint64_t hash = tecs_world_hash(sim.world);
+            if (config == 0) {
+                world_hashes[frame] = hash;
+                if (frame == 0) partitions = ran;
+            } else {
+                assert(hash == world_hashes[frame]);
+                if (frame == 0) assert(ran == partitions);
+            }
+        }
+
+        if (config == 0) {
+            event_hash = sim.event_hash;
+            assert(sim.expired > 0 && sim.spawned > 0);
+        } else {
+            assert(sim.event_hash == event_hash);
+        }
+
+        tecs_task_pool_free(pool);
+        sim_free(&sim);
+    }
+
+    /* 20000 rows over 4 archetypes, 256 rows per partition */
+    assert(partitions == KINDS * ((ENTITY_COUNT / KINDS + 255) / 256));
+    printf("  ✓ World hash, spawned IDs and event order match for 1 to 8 threads\n");
+}
+
+static void test_merge_with_deferred_pool(void) {
+    printf("Testing the merge through a parallel deferred apply...\n");
+
+    sim_t serial, parallel;
+    sim_init(&serial);
+    sim_init(&parallel);
+    tecs_task_pool_t* pool = tecs_task_pool_new(4);
+    tecs_set_deferred_pool(parallel.world, pool);
+
+    tecs_par_desc_t serial_desc = {kernel, on_event, &serial, 0};
+    tecs_par_desc_t parallel_desc = {kernel, on_event, &parallel, 0};
+    for (int frame = 0; frame < FRAMES; frame++) {
+        tecs_query_par_run(serial.query, NULL, &serial_desc);
+        tecs_query_par_run(parallel.query, pool, &parallel_desc);
+        assert(tecs_world_hash(serial.world) == tecs_world_hash(parallel.world));
+    }
+    assert(serial.event_hash == parallel.event_hash);
+    assert(tecs_world_entity_count(serial.world) == tecs_world_entity_count(parallel.world));
+
+    sim_free(&serial);
+    sim_free(&parallel);
+    tecs_task_pool_free(pool);
+    printf("  ✓ Recorded commands apply identically on the deferred pool\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Deterministic Parallel Execution Tests ===\n\n");
+
+    test_pool_size_independence();
+    test_merge_with_deferred_pool();
+
+    printf("\n=== All Deterministic Parallel Execution Tests Passed ✓ ===\n");
+    return 0;
+}
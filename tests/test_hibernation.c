@@ -0,0 +1,200 @@
+/*
+ * Test: Chunk Hibernation
+ * Tests in-memory compression of idle chunks and transparent wake-up
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y, z;
+} Position;
+
+typedef struct {
+    int32_t item_id;
+    int32_t stack;
+    uint32_t seed;
+} Item;
+
+static void advance(tecs_world_t* world, int ticks) {
+    for (int i = 0; i < ticks; i++) tecs_world_update(world);
+}
+
+static void test_hibernate_and_wake_on_access(void) {
+    printf("Testing tecs_world_hibernate() with transparent wake...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t item_id = tecs_register_component(world, "Item", sizeof(Item));
+
+    const int count = TECS_CHUNK_SIZE * 2 + 100;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {(float)(i / 16), 0.0f, 10.0f};
+        Item item = {1000 + i % 7, 1, 0xC0FFEEu};
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        tecs_set(world, entities[i], item_id, &item, sizeof(Item));
+    }
+
+    advance(world, 10);
+
+    /* Touch the last chunk so it stays resident */
+    assert(tecs_get(world, entities[count - 1], pos_id) != NULL);
+
+    int hibernated = tecs_world_hibernate(world, 5);
+    assert(hibernated == 2);
+
+    tecs_hibernation_stats_t stats = tecs_world_hibernation_stats(world);
+    assert(stats.chunk_count == 2);
+    assert(stats.compressed_bytes * 4 < stats.raw_bytes);
+
+    /* Reading an entity wakes its chunk with data intact */
+    Item* item = (Item*)tecs_get(world, entities[3], item_id);
+    assert(item && item->item_id == 1003 && item->seed == 0xC0FFEEu);
+    stats = tecs_world_hibernation_stats(world);
+    assert(stats.chunk_count == 1);
+
+    /* Recently touched chunks are not hibernated again */
+    assert(tecs_world_hibernate(world, 5) == 0);
+
+    assert(tecs_world_wake(world) == 1);
+    stats = tecs_world_hibernation_stats(world);
+    assert(stats.chunk_count == 0 && stats.raw_bytes == 0 && stats.compressed_bytes == 0);
+
+    for (int i = 0; i < count; i++) {
+        Position* pos = (Position*)tecs_get(world, entities[i], pos_id);
+        assert(pos && pos->x == (float)(i / 16) && pos->z == 10.0f);
+    }
+
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Idle chunks compress and wake on access\n");
+}
+
+static void test_hibernate_query_opt_in(void) {
+    printf("Testing tecs_query_skip_hibernated()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t item_id = tecs_register_component(world, "Item", sizeof(Item));
+
+    for (int i = 0; i < 100; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        Position pos = {(float)i, 0.0f, 0.0f};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+    }
+    for (int i = 0; i < 50; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        Position pos = {(float)i, 1.0f, 0.0f};
+        Item item = {i, i, 0};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_set(world, e, item_id, &item, sizeof(Item));
+    }
+
+    advance(world, 3);
+
+    /* Hibernate only the archetypes holding items */
+    tecs_query_t* items = tecs_query_new(world);
+    tecs_query_with(items, item_id);
+    assert(tecs_query_hibernate(items, 1) == 1);
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_skip_hibernated(query, true);
+    tecs_query_build(query);
+
+    int seen = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) seen += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    assert(seen == 100);
+    assert(tecs_world_hibernation_stats(world).chunk_count == 1);
+
+    /* Default iteration wakes the chunk and exposes its columns */
+    tecs_query_skip_hibernated(query, false);
+    seen = 0;
+    float sum = 0.0f;
+    iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) {
+        int column = tecs_iter_column_index(iter, pos_id);
+        Position* positions = (Position*)tecs_iter_column(iter, column);
+        for (int i = 0; i < tecs_iter_count(iter); i++) sum += positions[i].y;
+        seen += tecs_iter_count(iter);
+    }
+    tecs_query_iter_free(iter);
+    assert(seen == 150);
+    assert(sum == 50.0f);
+    assert(tecs_world_hibernation_stats(world).chunk_count == 0);
+
+    tecs_query_free(query);
+    tecs_query_free(items);
+    tecs_world_free(world);
+    printf("  ✓ Queries can leave hibernated chunks untouched\n");
+}
+
+static void test_hibernate_structural_changes(void) {
+    printf("Testing structural changes on hibernated chunks...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t item_id = tecs_register_component(world, "Item", sizeof(Item));
+
+    /* Random data exercises the incompressible path */
+    srand(42);
+    tecs_entity_t entities[64];
+    Item expected[64];
+    for (int i = 0; i < 64; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {(float)rand(), (float)rand(), (float)rand()};
+        expected[i].item_id = rand();
+        expected[i].stack = rand();
+        expected[i].seed = (uint32_t)rand();
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        tecs_set(world, entities[i], item_id, &expected[i], sizeof(Item));
+    }
+
+    advance(world, 2);
+    assert(tecs_world_hibernate(world, 1) == 1);
+    tecs_entity_delete(world, entities[0]);
+
+    assert(tecs_world_hibernate(world, 0) == 1);
+    tecs_unset(world, entities[1], pos_id);
+
+    /* The unset entity now lives in its own archetype */
+    assert(tecs_world_hibernate(world, 0) == 2);
+    tecs_entity_t added = tecs_entity_new(world);
+    Position pos = {1.0f, 2.0f, 3.0f};
+    Item item = {7, 8, 9};
+    tecs_set(world, added, pos_id, &pos, sizeof(Position));
+    tecs_set(world, added, item_id, &item, sizeof(Item));
+
+    assert(tecs_world_hibernate(world, 0) >= 1);
+    for (int i = 1; i < 64; i++) {
+        Item* current = (Item*)tecs_get(world, entities[i], item_id);
+        assert(current && memcmp(current, &expected[i], sizeof(Item)) == 0);
+    }
+    assert(!tecs_has(world, entities[1], pos_id));
+    assert(((Item*)tecs_get(world, added, item_id))->seed == 9);
+
+    /* Hibernated chunks are released with the world */
+    assert(tecs_world_hibernate(world, 0) >= 1);
+    tecs_world_free(world);
+    printf("  ✓ Delete, unset and insert wake chunks first\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Chunk Hibernation Tests ===\n\n");
+
+    test_hibernate_and_wake_on_access();
+    test_hibernate_query_opt_in();
+    test_hibernate_structural_changes();
+
+    printf("\n=== All Chunk Hibernation Tests Passed ✓ ===\n");
+    return 0;
+}
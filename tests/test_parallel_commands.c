@@ -0,0 +1,197 @@
+/*
+ * Test: Parallel Deferred Commands
+ * Tests that tecs_end_deferred() on a task pool matches a serial apply
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+#define KINDS 8
+#define PER_KIND 400
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+typedef struct {
+    int value;
+} Health;
+
+typedef struct {
+    tecs_world_t* world;
+    tecs_component_id_t pos_id, vel_id, hp_id, owned_id;
+    tecs_component_id_t kinds[KINDS];
+    tecs_entity_t entities[KINDS * PER_KIND];
+} fixture_t;
+
+static int live_owned = 0;  /* Only touched by the group holding hooked archetypes */
+
+static void owned_ctor(void* ptr, int count, void* user_data) {
+    (void)user_data;
+    memset(ptr, 0, (size_t)count * sizeof(int));
+    live_owned += count;
+}
+
+static void owned_dtor(void* ptr, int count, void* user_data) {
+    (void)ptr; (void)user_data;
+    live_owned -= count;
+}
+
+static void owned_copy(void* dst, const void* src, int count, void* user_data) {
+    (void)user_data;
+    memcpy(dst, src, (size_t)count * sizeof(int));
+    live_owned += count;
+}
+
+static void fixture_init(fixture_t* f) {
+    f->world = tecs_world_new();
+    f->pos_id = tecs_register_component(f->world, "Position", sizeof(Position));
+    f->vel_id = tecs_register_component(f->world, "Velocity", sizeof(Velocity));
+    f->hp_id = tecs_register_component(f->world, "Health", sizeof(Health));
+    tecs_type_hooks_t hooks = {owned_ctor, owned_dtor, owned_copy, NULL, NULL};
+    f->owned_id = tecs_register_component_hooks(f->world, "Owned", sizeof(int), NULL, &hooks);
+    for (int k = 0; k < KINDS; k++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Kind%d", k);
+        f->kinds[k] = tecs_register_component(f->world, name, 0);
+    }
+
+    for (int i = 0; i < KINDS * PER_KIND; i++) {
+        Position pos = {(float)i, (float)-i};
+        f->entities[i] = tecs_entity_new(f->world);
+        tecs_add_tag(f->world, f->entities[i], f->kinds[i % KINDS]);
+        tecs_set(f->world, f->entities[i], f->pos_id, &pos, sizeof(Position));
+    }
+}
+
+/* Interleaves every kind so a serial apply bounces between archetypes */
+static void queue_batch(fixture_t* f) {
+    tecs_world_t* world = f->world;
+    tecs_begin_deferred(world);
+    for (int i = 0; i < KINDS * PER_KIND; i++) {
+        tecs_entity_t e = f->entities[i];
+        Velocity vel = {(float)i, 1.0f};
+        Health hp = {i};
+        Position pos = {0.5f, (float)i};
+
+        switch (i % 7) {
+            case 0: tecs_set(world, e, f->vel_id, &vel, sizeof(Velocity)); break;
+            case 1: tecs_set(world, e, f->pos_id, &pos, sizeof(Position)); break;
+            case 2: tecs_unset(world, e, f->pos_id); tecs_set(world, e, f->hp_id, &hp, sizeof(Health)); break;
+            case 3: tecs_entity_delete(world, e); tecs_set(world, e, f->hp_id, &hp, sizeof(Health)); break;
+            case 4: tecs_set(world, e, f->hp_id, &hp, sizeof(Health)); tecs_unset(world, e, f->hp_id); break;
+            case 5: tecs_unset(world, e, f->vel_id); break;  /* Not present: no effect */
+            case 6:
+                tecs_set(world, e, f->vel_id, &vel, sizeof(Velocity));
+                tecs_set(world, e, f->hp_id, &hp, sizeof(Health));
+                tecs_entity_delete(world, e);
+                break;
+        }
+    }
+    tecs_end_deferred(world);
+}
+
+static void test_parallel_matches_serial(void) {
+    printf("Testing parallel deferred apply against serial apply...\n");
+
+    fixture_t* serial = malloc(sizeof(fixture_t));
+    fixture_t* parallel = malloc(sizeof(fixture_t));
+    fixture_init(serial);
+    fixture_init(parallel);
+    assert(tecs_world_hash(serial->world) == tecs_world_hash(parallel->world));
+
+    tecs_task_pool_t* pool = tecs_task_pool_new(4);
+    tecs_set_deferred_pool(parallel->world, pool);
+
+    /* Reads inside the batch see the world as it was */
+    tecs_begin_deferred(parallel->world);
+    tecs_unset(parallel->world, parallel->entities[0], parallel->pos_id);
+    assert(tecs_has(parallel->world, parallel->entities[0], parallel->pos_id));
+    tecs_set(parallel->world, parallel->entities[0], parallel->pos_id, &(Position){0.0f, -0.0f}, sizeof(Position));
+    tecs_end_deferred(parallel->world);  /* Below the threshold: applied serially */
+    tecs_begin_deferred(serial->world);
+    tecs_unset(serial->world, serial->entities[0], serial->pos_id);
+    tecs_set(serial->world, serial->entities[0], serial->pos_id, &(Position){0.0f, -0.0f}, sizeof(Position));
+    tecs_end_deferred(serial->world);
+
+    for (int round = 0; round < 3; round++) {
+        queue_batch(serial);
+        queue_batch(parallel);
+        assert(tecs_world_hash(serial->world) == tecs_world_hash(parallel->world));
+        assert(!tecs_world_diff(serial->world, parallel->world, NULL));
+        assert(tecs_world_archetype_count(serial->world) == tecs_world_archetype_count(parallel->world));
+        assert(tecs_world_chunk_count(serial->world) == tecs_world_chunk_count(parallel->world));
+        assert(tecs_world_entity_count(serial->world) == tecs_world_entity_count(parallel->world));
+    }
+
+    /* Deleted IDs were released in the same order, so recycling agrees too */
+    for (int i = 0; i < 100; i++) {
+        assert(tecs_entity_new(serial->world) == tecs_entity_new(parallel->world));
+    }
+
+    tecs_world_free(serial->world);
+    tecs_world_free(parallel->world);
+    tecs_task_pool_free(pool);
+    free(serial);
+    free(parallel);
+    printf("  ✓ Archetypes, rows, chunks and world hash are identical\n");
+}
+
+static void test_parallel_with_hooks(void) {
+    printf("Testing parallel deferred apply with hooked components...\n");
+
+    fixture_t* f = malloc(sizeof(fixture_t));
+    fixture_init(f);
+    tecs_task_pool_t* pool = tecs_task_pool_new(4);
+    tecs_set_deferred_pool(f->world, pool);
+
+    /* Half the kinds get a hooked component: those groups share one worker */
+    live_owned = 0;
+    int owned = 7;
+    tecs_begin_deferred(f->world);
+    for (int i = 0; i < KINDS * PER_KIND; i++) {
+        if ((i % KINDS) < KINDS / 2) tecs_set(f->world, f->entities[i], f->owned_id, &owned, sizeof(int));
+        Velocity vel = {1.0f, 2.0f};
+        tecs_set(f->world, f->entities[i], f->vel_id, &vel, sizeof(Velocity));
+    }
+    tecs_end_deferred(f->world);
+    assert(live_owned == KINDS * PER_KIND / 2);
+
+    tecs_begin_deferred(f->world);
+    for (int i = 0; i < KINDS * PER_KIND; i += 2) tecs_entity_delete(f->world, f->entities[i]);
+    tecs_end_deferred(f->world);
+    assert(live_owned == KINDS * PER_KIND / 4);
+    assert(tecs_world_entity_count(f->world) == KINDS * PER_KIND / 2);
+
+    for (int i = 1; i < KINDS * PER_KIND; i += 2) {
+        const Position* pos = tecs_get(f->world, f->entities[i], f->pos_id);
+        assert(pos && pos->x == (float)i);
+        if ((i % KINDS) < KINDS / 2) assert(*(int*)tecs_get(f->world, f->entities[i], f->owned_id) == 7);
+        else assert(!tecs_has(f->world, f->entities[i], f->owned_id));
+    }
+
+    tecs_world_free(f->world);
+    assert(live_owned == 0);
+    tecs_task_pool_free(pool);
+    free(f);
+    printf("  ✓ Hooks run once per value and stay on a single group\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Parallel Deferred Command Tests ===\n\n");
+
+    test_parallel_matches_serial();
+    test_parallel_with_hooks();
+
+    printf("\n=== All Parallel Deferred Command Tests Passed ✓ ===\n");
+    return 0;
+}
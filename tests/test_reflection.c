@@ -0,0 +1,187 @@
+/*
+ * Test: Component Reflection
+ * Tests field descriptors and the serialize, delta and diff kernels built on them
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+/* Padding between every field */
+typedef struct {
+    uint8_t flags;
+    float x;
+    uint16_t ids[3];
+    double time;
+    tecs_entity_t target;
+} Unit;
+
+static const tecs_field_t unit_fields[] = {
+    TECS_FIELD(Unit, flags, TECS_FIELD_U8),
+    TECS_FIELD(Unit, x, TECS_FIELD_F32),
+    TECS_FIELD(Unit, ids, TECS_FIELD_U16),
+    TECS_FIELD(Unit, time, TECS_FIELD_F64),
+    TECS_FIELD(Unit, target, TECS_FIELD_ENTITY),
+};
+
+#define UNIT_PACKED_SIZE (1 + 4 + 3 * 2 + 8 + 8)
+
+static Unit make_unit(int i) {
+    Unit unit;
+    memset(&unit, 0xAB, sizeof(Unit));  /* Garbage in the padding */
+    unit.flags = (uint8_t)i;
+    unit.x = (float)i * 0.5f;
+    unit.ids[0] = (uint16_t)(i + 1);
+    unit.ids[1] = (uint16_t)(i + 2);
+    unit.ids[2] = 0x1234;
+    unit.time = (double)i / 3.0;
+    unit.target = TECS_ENTITY_MAKE(i, 1);
+    return unit;
+}
+
+static bool units_equal(const Unit* a, const Unit* b) {
+    return a->flags == b->flags && a->x == b->x && memcmp(a->ids, b->ids, sizeof(a->ids)) == 0 &&
+           a->time == b->time && a->target == b->target;
+}
+
+static void test_field_registration(void) {
+    printf("Testing tecs_set_component_fields()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t unit_id = tecs_register_component(world, "Unit", sizeof(Unit));
+    tecs_component_id_t tag_id = tecs_register_component(world, "Tag", 0);
+
+    /* Undescribed components are one opaque field */
+    assert(tecs_get_component_fields(world, unit_id, NULL) == 0);
+    assert(tecs_component_packed_size(world, unit_id) == (int)sizeof(Unit));
+
+    assert(TECS_REFLECT(world, unit_id, unit_fields));
+    const tecs_field_t* fields;
+    assert(tecs_get_component_fields(world, unit_id, &fields) == 5);
+    assert(strcmp(fields[2].name, "ids") == 0 && fields[2].count == 3);
+    assert(fields[2].name != unit_fields[2].name);  /* Names are copied */
+    assert(fields[3].offset == (int)offsetof(Unit, time));
+    assert(tecs_component_packed_size(world, unit_id) == UNIT_PACKED_SIZE);
+
+    /* Descriptors must fit the component */
+    tecs_field_t bad = {"overflow", TECS_FIELD_F64, (int)sizeof(Unit) - 4, 1};
+    assert(!tecs_set_component_fields(world, unit_id, &bad, 1));
+    assert(!tecs_set_component_fields(world, tag_id, unit_fields, 1));
+    assert(tecs_get_component_fields(world, unit_id, NULL) == 5);
+
+    /* Transfers carry descriptors to components they register */
+    tecs_world_t* other = tecs_world_new();
+    tecs_world_map_t* map = tecs_world_map_new(world, other);
+    tecs_component_id_t other_id = tecs_world_map_component(map, unit_id);
+    assert(tecs_get_component_fields(other, other_id, &fields) == 5);
+    assert(strcmp(fields[4].name, "target") == 0);
+    tecs_world_map_free(map);
+    tecs_world_free(other);
+
+    tecs_world_free(world);
+    printf("  ✓ Field descriptors are validated and attached to the registry\n");
+}
+
+static void test_serialize(void) {
+    printf("Testing tecs_fields_serialize()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t unit_id = tecs_register_component(world, "Unit", sizeof(Unit));
+    TECS_REFLECT(world, unit_id, unit_fields);
+
+    Unit units[16];
+    for (int i = 0; i < 16; i++) units[i] = make_unit(i);
+
+    unsigned char packed[16 * UNIT_PACKED_SIZE];
+    assert(tecs_fields_serialize(world, unit_id, units, 16, packed) == sizeof(packed));
+
+    /* Little-endian, no padding */
+    const unsigned char* second = packed + UNIT_PACKED_SIZE;
+    assert(second[0] == 1);
+    assert(second[5] == 2 && second[6] == 0);           /* ids[0] */
+    assert(second[9] == 0x34 && second[10] == 0x12);    /* ids[2] */
+    assert(second[19] == 1 && second[23] == 1);         /* target index, generation */
+
+    Unit restored[16];
+    assert(tecs_fields_deserialize(world, unit_id, packed, 16, restored) == sizeof(packed));
+    for (int i = 0; i < 16; i++) assert(units_equal(&units[i], &restored[i]));
+
+    /* Padding comes back zeroed, so equal values serialize and compare identically */
+    assert(((unsigned char*)&restored[0])[1] == 0);
+
+    tecs_world_free(world);
+    printf("  ✓ Packed little-endian round trip skips padding\n");
+}
+
+static void test_delta_and_diff(void) {
+    printf("Testing tecs_fields_delta_encode() and tecs_fields_diff()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t unit_id = tecs_register_component(world, "Unit", sizeof(Unit));
+    TECS_REFLECT(world, unit_id, unit_fields);
+
+    enum { COUNT = 64 };
+    Unit baseline[COUNT];
+    Unit current[COUNT];
+    for (int i = 0; i < COUNT; i++) {
+        baseline[i] = make_unit(i);
+        current[i] = baseline[i];
+    }
+    for (int i = 0; i < COUNT; i += 4) current[i].x += 1.0f;
+    current[7].target = TECS_ENTITY_MAKE(99, 2);
+
+    /* Field-major layout: only the x and target blocks are non-zero */
+    unsigned char delta[COUNT * UNIT_PACKED_SIZE];
+    assert(tecs_fields_delta_encode(world, unit_id, baseline, current, COUNT, delta) == sizeof(delta));
+    size_t x_block = COUNT * 1;
+    size_t ids_block = x_block + COUNT * 4;
+    size_t target_block = ids_block + COUNT * 6 + COUNT * 8;
+    for (size_t b = 0; b < sizeof(delta); b++) {
+        bool in_x = b >= x_block && b < ids_block;
+        bool in_target = b >= target_block + 7 * 8 && b < target_block + 8 * 8;
+        if (!in_x && !in_target) assert(delta[b] == 0);
+    }
+
+    Unit decoded[COUNT];
+    assert(tecs_fields_delta_decode(world, unit_id, baseline, delta, COUNT, decoded) == sizeof(delta));
+    for (int i = 0; i < COUNT; i++) assert(units_equal(&decoded[i], &current[i]));
+
+    /* In place against the baseline, and against zeros */
+    Unit in_place[COUNT];
+    memcpy(in_place, baseline, sizeof(in_place));
+    tecs_fields_delta_decode(world, unit_id, in_place, delta, COUNT, in_place);
+    for (int i = 0; i < COUNT; i++) assert(units_equal(&in_place[i], &current[i]));
+
+    tecs_fields_delta_encode(world, unit_id, NULL, current, COUNT, delta);
+    tecs_fields_delta_decode(world, unit_id, NULL, delta, COUNT, decoded);
+    for (int i = 0; i < COUNT; i++) assert(units_equal(&decoded[i], &current[i]));
+
+    /* Field-wise diff ignores padding */
+    uint64_t masks[COUNT];
+    assert(tecs_fields_diff(world, unit_id, baseline, current, COUNT, masks) == COUNT / 4 + 1);
+    assert(masks[0] == (1u << 1));
+    assert(masks[7] == (1u << 4));
+    assert(masks[8] == (1u << 1) && masks[9] == 0);
+
+    Unit noisy = baseline[9];
+    memset((unsigned char*)&noisy + 1, 0x00, 3);  /* Padding after flags */
+    assert(tecs_fields_diff(world, unit_id, &baseline[9], &noisy, 1, masks) == 0);
+
+    tecs_world_free(world);
+    printf("  ✓ Deltas are lossless and zero where fields are unchanged\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Reflection Tests ===\n\n");
+
+    test_field_registration();
+    test_serialize();
+    test_delta_and_diff();
+
+    printf("\n=== All Reflection Tests Passed ✓ ===\n");
+    return 0;
+}
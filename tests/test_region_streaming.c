@@ -0,0 +1,209 @@
+/*
+ * Test: Region Streaming
+ * Tests unloading region chunks to disk and loading them back, sync and async
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    int value;
+} Health;
+
+static const char* REGION_FILE_A = "test_region_a.tecsrgn";
+static const char* REGION_FILE_B = "test_region_b.tecsrgn";
+
+static void test_region_unload_load(void) {
+    printf("Testing tecs_region_unload() and tecs_region_load()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+
+    const int count = TECS_CHUNK_SIZE + 500;
+    tecs_entity_t* streamed = malloc(count * sizeof(tecs_entity_t));
+    tecs_entity_t resident[10];
+
+    for (int i = 0; i < count; i++) {
+        streamed[i] = tecs_entity_new(world);
+        Position pos = {(float)i, (float)-i};
+        tecs_set(world, streamed[i], pos_id, &pos, sizeof(Position));
+        if (i % 3 == 0) {
+            Health hp = {i};
+            tecs_set(world, streamed[i], hp_id, &hp, sizeof(Health));
+        }
+        tecs_set_region(world, streamed[i], 7);
+    }
+    for (int i = 0; i < 10; i++) {
+        resident[i] = tecs_entity_new(world);
+        Position pos = {100.0f, (float)i};
+        tecs_set(world, resident[i], pos_id, &pos, sizeof(Position));
+    }
+
+    int unloaded = tecs_region_unload(world, 7, REGION_FILE_A);
+    assert(unloaded == count);
+
+    /* IDs stay alive, data is gone */
+    for (int i = 0; i < count; i++) {
+        assert(tecs_entity_exists(world, streamed[i]));
+        assert(!tecs_entity_is_resident(world, streamed[i]));
+        assert(tecs_get(world, streamed[i], pos_id) == NULL);
+    }
+
+    /* Queries only see resident entities */
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+    int seen = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) seen += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    assert(seen == 10);
+
+    /* New entities never reuse the IDs of unloaded ones */
+    tecs_entity_t fresh = tecs_entity_new(world);
+    for (int i = 0; i < count; i++) assert(fresh != streamed[i]);
+
+    /* Deleting an unloaded entity drops its row on reload */
+    tecs_entity_delete(world, streamed[5]);
+    assert(!tecs_entity_exists(world, streamed[5]));
+
+    int restored = tecs_region_load(world, REGION_FILE_A);
+    assert(restored == count - 1);
+
+    for (int i = 0; i < count; i++) {
+        if (i == 5) continue;
+        assert(tecs_entity_is_resident(world, streamed[i]));
+        Position* pos = (Position*)tecs_get(world, streamed[i], pos_id);
+        assert(pos && pos->x == (float)i && pos->y == (float)-i);
+        assert(tecs_has(world, streamed[i], hp_id) == (i % 3 == 0));
+        if (i % 3 == 0) {
+            Health* hp = (Health*)tecs_get(world, streamed[i], hp_id);
+            assert(hp && hp->value == i);
+        }
+    }
+    for (int i = 0; i < 10; i++) {
+        Position* pos = (Position*)tecs_get(world, resident[i], pos_id);
+        assert(pos && pos->y == (float)i);
+    }
+
+    /* Reloaded entities behave like any other */
+    tecs_unset(world, streamed[0], hp_id);
+    assert(!tecs_has(world, streamed[0], hp_id));
+    tecs_entity_delete(world, streamed[1]);
+    Position* pos2 = (Position*)tecs_get(world, streamed[2], pos_id);
+    assert(pos2 && pos2->x == 2.0f);
+
+    seen = 0;
+    iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) seen += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    assert(seen == count - 2 + 10);
+
+    remove(REGION_FILE_A);
+    tecs_query_free(query);
+    free(streamed);
+    tecs_world_free(world);
+    printf("  ✓ Region round-trips through disk with IDs kept\n");
+}
+
+static void test_region_async_loader(void) {
+    printf("Testing tecs_region_loader_t...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+
+    tecs_entity_t region_a[100];
+    tecs_entity_t region_b[100];
+    for (int i = 0; i < 100; i++) {
+        Position pos = {(float)i, 1.0f};
+        region_a[i] = tecs_entity_new(world);
+        tecs_set(world, region_a[i], pos_id, &pos, sizeof(Position));
+        tecs_set_region(world, region_a[i], 1);
+
+        pos.y = 2.0f;
+        region_b[i] = tecs_entity_new(world);
+        tecs_set(world, region_b[i], pos_id, &pos, sizeof(Position));
+        tecs_set_region(world, region_b[i], 2);
+    }
+
+    assert(tecs_region_unload(world, 1, REGION_FILE_A) == 100);
+    assert(tecs_region_unload(world, 2, REGION_FILE_B) == 100);
+
+    tecs_region_loader_t* loader = tecs_region_loader_new(world);
+    tecs_region_loader_request(loader, REGION_FILE_A);
+    tecs_region_loader_request(loader, REGION_FILE_B);
+    tecs_region_loader_request(loader, "missing_region.tecsrgn");
+
+    /* Chunks only appear at the sync point */
+    int restored = 0;
+    while (tecs_region_loader_pending(loader) > 0) {
+        restored += tecs_region_loader_sync(loader);
+    }
+    restored += tecs_region_loader_sync(loader);
+    assert(restored == 200);
+
+    for (int i = 0; i < 100; i++) {
+        Position* a = (Position*)tecs_get(world, region_a[i], pos_id);
+        Position* b = (Position*)tecs_get(world, region_b[i], pos_id);
+        assert(a && a->x == (float)i && a->y == 1.0f);
+        assert(b && b->x == (float)i && b->y == 2.0f);
+    }
+
+    tecs_region_loader_free(loader);
+    remove(REGION_FILE_A);
+    remove(REGION_FILE_B);
+    tecs_world_free(world);
+    printf("  ✓ Async loader restores regions at sync\n");
+}
+
+static void test_region_errors(void) {
+    printf("Testing region streaming error handling...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+
+    tecs_entity_t e = tecs_entity_new(world);
+    Position pos = {1.0f, 2.0f};
+    tecs_set(world, e, pos_id, &pos, sizeof(Position));
+    tecs_set_region(world, e, 3);
+
+    /* Unwritable path leaves the region resident */
+    assert(tecs_region_unload(world, 3, "no_such_dir/region.tecsrgn") == -1);
+    assert(tecs_entity_is_resident(world, e));
+
+    /* Bad files are rejected */
+    assert(tecs_region_load(world, "missing_region.tecsrgn") == -1);
+    FILE* file = fopen(REGION_FILE_A, "wb");
+    fputs("not a region", file);
+    fclose(file);
+    assert(tecs_region_load(world, REGION_FILE_A) == -1);
+
+    /* Empty region writes a valid file */
+    assert(tecs_region_unload(world, 99, REGION_FILE_A) == 0);
+    assert(tecs_region_load(world, REGION_FILE_A) == 0);
+
+    remove(REGION_FILE_A);
+    tecs_world_free(world);
+    printf("  ✓ I/O errors are reported without losing data\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Region Streaming Tests ===\n\n");
+
+    test_region_unload_load();
+    test_region_async_loader();
+    test_region_errors();
+
+    printf("\n=== All Region Streaming Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ * Test: Sharded Worlds
+ * Tests bulk migration, proxies and the message bus between shards
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+#define SHARDS 3
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    int value;
+} Health;
+
+static tecs_component_id_t Position_id;
+static tecs_component_id_t Health_id;
+
+/* Entities leave for the next shard once x passes 10 */
+static void move_tick(tecs_shard_set_t* set, int shard, tecs_world_t* world, void* user_data) {
+    tecs_query_t** queries = (tecs_query_t**)user_data;
+    tecs_query_iter_t iter;
+    tecs_query_iter_init(&iter, queries[shard]);
+    while (tecs_iter_next(&iter)) {
+        int count = tecs_iter_count(&iter);
+        tecs_entity_t* entities = tecs_iter_entities(&iter);
+        Position* pos = (Position*)tecs_iter_column(&iter, tecs_iter_column_index(&iter, Position_id));
+        for (int i = 0; i < count; i++) {
+            pos[i].x += 1.0f;
+            if (pos[i].x >= 10.0f && shard + 1 < tecs_shard_count(set)) {
+                pos[i].x = 0.0f;
+                tecs_shard_migrate(set, shard, entities[i], shard + 1);
+            }
+        }
+    }
+    (void)world;
+}
+
+static void test_shard_migration(void) {
+    printf("Testing tecs_shard_migrate()...\n");
+
+    tecs_shard_set_t* set = tecs_shard_set_new(SHARDS, 2);
+    Position_id = tecs_shard_register_component(set, "Position", sizeof(Position));
+    Health_id = tecs_shard_register_component(set, "Health", sizeof(Health));
+    assert(tecs_shard_count(set) == SHARDS);
+
+    tecs_query_t* queries[SHARDS];
+    for (int s = 0; s < SHARDS; s++) {
+        queries[s] = tecs_query_new(tecs_shard_world(set, s));
+        tecs_query_with(queries[s], Position_id);
+        tecs_query_build(queries[s]);
+    }
+
+    tecs_world_t* first = tecs_shard_world(set, 0);
+    tecs_entity_t entities[100];
+    for (int i = 0; i < 100; i++) {
+        entities[i] = tecs_entity_new(first);
+        Position pos = {(float)(i % 10), 0.0f};
+        Health hp = {i};
+        tecs_set(first, entities[i], Position_id, &pos, sizeof(Position));
+        tecs_set(first, entities[i], Health_id, &hp, sizeof(Health));
+    }
+
+    /* One frame moves the ten entities at x = 9 */
+    tecs_shard_set_systems(set, move_tick, NULL, queries);
+    tecs_shard_set_step(set);
+    assert(tecs_shard_set_stats(set).migrated == 10);
+    assert(tecs_world_entity_count(first) == 90);
+    assert(tecs_world_entity_count(tecs_shard_world(set, 1)) == 10);
+
+    for (int i = 9; i < 100; i += 10) {
+        int to = -1;
+        tecs_entity_t moved = tecs_shard_remapped(set, 0, entities[i], &to);
+        assert(moved != TECS_ENTITY_NULL && to == 1);
+        assert(!tecs_entity_exists(first, entities[i]));
+
+        const Health* hp = (const Health*)tecs_get_const(tecs_shard_world(set, 1), moved, Health_id);
+        assert(hp && hp->value == i);
+    }
+    assert(tecs_shard_remapped(set, 0, entities[0], NULL) == TECS_ENTITY_NULL);
+
+    /* Everyone ends up in the last shard */
+    for (int frame = 0; frame < 40; frame++) tecs_shard_set_step(set);
+    assert(tecs_world_entity_count(first) == 0);
+    assert(tecs_world_entity_count(tecs_shard_world(set, 1)) == 0);
+    assert(tecs_world_entity_count(tecs_shard_world(set, 2)) == 100);
+    assert(tecs_world_tick(first) == 41);
+
+    for (int s = 0; s < SHARDS; s++) tecs_query_free(queries[s]);
+    tecs_shard_set_free(set);
+    printf("  ✓ Entities move in bulk with their components\n");
+}
+
+typedef struct {
+    int count[SHARDS];
+    int from[SHARDS][64];
+    int payload[SHARDS][64];
+    int frame;
+} mailbox_t;
+
+static void send_tick(tecs_shard_set_t* set, int shard, tecs_world_t* world, void* user_data) {
+    mailbox_t* mail = (mailbox_t*)user_data;
+    (void)world;
+    for (int to = 0; to < SHARDS; to++) {
+        int payload = mail->frame * 100 + shard * 10 + to;
+        tecs_shard_send(set, shard, to, 1, &payload, sizeof(payload));
+    }
+}
+
+static void on_message(tecs_shard_set_t* set, int shard, int from, uint32_t type, const void* data,
+                       int size, void* user_data) {
+    mailbox_t* mail = (mailbox_t*)user_data;
+    int n = mail->count[shard]++;
+    mail->from[shard][n] = from;
+    memcpy(&mail->payload[shard][n], data, sizeof(int));
+    assert(size == sizeof(int));
+
+    /* Replies go out with the next boundary */
+    if (type == 1 && from != shard) {
+        int reply = -1;
+        tecs_shard_send(set, shard, from, 2, &reply, sizeof(reply));
+    }
+}
+
+static void test_shard_messages(void) {
+    printf("Testing tecs_shard_send()...\n");
+
+    tecs_shard_set_t* set = tecs_shard_set_new(SHARDS, 0);
+    mailbox_t mail;
+    memset(&mail, 0, sizeof(mail));
+    tecs_shard_set_systems(set, send_tick, on_message, &mail);
+
+    tecs_shard_set_step(set);
+    assert(tecs_shard_set_stats(set).messages == SHARDS * SHARDS);
+    for (int s = 0; s < SHARDS; s++) {
+        assert(mail.count[s] == SHARDS);
+        for (int i = 0; i < SHARDS; i++) {
+            assert(mail.from[s][i] == i);  /* Grouped by sender in shard order */
+            assert(mail.payload[s][i] == i * 10 + s);
+        }
+    }
+
+    /* Second frame: new sends plus the replies queued while delivering */
+    memset(&mail, 0, sizeof(mail));
+    mail.frame = 1;
+    tecs_shard_set_step(set);
+    for (int s = 0; s < SHARDS; s++) {
+        assert(mail.count[s] == SHARDS + (SHARDS - 1));
+        int replies = 0;
+        for (int i = 0; i < mail.count[s]; i++) {
+            if (mail.payload[s][i] == -1) replies++;
+        }
+        assert(replies == SHARDS - 1);
+    }
+
+    tecs_shard_set_free(set);
+    printf("  ✓ Messages arrive at the frame boundary, by sender\n");
+}
+
+static void test_shard_proxies(void) {
+    printf("Testing tecs_shard_proxy_new()...\n");
+
+    tecs_shard_set_t* set = tecs_shard_set_new(SHARDS, 2);
+    Position_id = tecs_shard_register_component(set, "Position", sizeof(Position));
+    Health_id = tecs_shard_register_component(set, "Health", sizeof(Health));
+    tecs_world_t* w0 = tecs_shard_world(set, 0);
+    tecs_world_t* w1 = tecs_shard_world(set, 1);
+    tecs_world_t* w2 = tecs_shard_world(set, 2);
+
+    tecs_entity_t boss = tecs_entity_new(w0);
+    Position pos = {3.0f, 4.0f};
+    Health hp = {500};
+    tecs_set(w0, boss, Position_id, &pos, sizeof(Position));
+    tecs_set(w0, boss, Health_id, &hp, sizeof(Health));
+
+    tecs_component_id_t mirrored[] = {Position_id, Health_id};
+    tecs_entity_t proxy = tecs_shard_proxy_new(set, 1, 0, boss, mirrored, 2);
+    assert(tecs_has(w1, proxy, tecs_shard_proxy_component(set)));
+    assert(((const Health*)tecs_get_const(w1, proxy, Health_id))->value == 0);
+
+    tecs_shard_set_step(set);
+    assert(tecs_shard_set_stats(set).proxies == 1);
+    assert(((const Health*)tecs_get_const(w1, proxy, Health_id))->value == 500);
+    assert(((const Position*)tecs_get_const(w1, proxy, Position_id))->y == 4.0f);
+
+    /* The proxy follows its entity across shards */
+    hp.value = 250;
+    tecs_set(w0, boss, Health_id, &hp, sizeof(Health));
+    tecs_shard_migrate(set, 0, boss, 2);
+    tecs_shard_set_step(set);
+
+    int remote_shard = -1;
+    tecs_entity_t remote = TECS_ENTITY_NULL;
+    assert(tecs_shard_proxy_target(set, 1, proxy, &remote_shard, &remote));
+    assert(remote_shard == 2 && remote == tecs_shard_remapped(set, 0, boss, NULL));
+    assert(((const Health*)tecs_get_const(w1, proxy, Health_id))->value == 250);
+
+    /* Once the entity is gone the proxy keeps its last values */
+    tecs_entity_delete(w2, remote);
+    tecs_shard_set_step(set);
+    assert(!tecs_shard_proxy_target(set, 1, proxy, NULL, NULL));
+    assert(((const Health*)tecs_get_const(w1, proxy, Health_id))->value == 250);
+    assert(tecs_shard_set_stats(set).proxies == 0);
+
+    tecs_shard_set_free(set);
+    printf("  ✓ Proxies mirror remote components and follow migrations\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Shard Tests ===\n\n");
+
+    test_shard_migration();
+    test_shard_messages();
+    test_shard_proxies();
+
+    printf("\n=== All Shard Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Test: Shrink-to-fit
+ * Tests returning memory after a peak with tecs_world_shrink()
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+static void test_shrink_after_peak(void) {
+    printf("Testing tecs_world_shrink() after a peak...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(world, "Velocity", sizeof(Velocity));
+
+    const int peak = TECS_CHUNK_SIZE * 5;
+    tecs_entity_t* entities = malloc(peak * sizeof(tecs_entity_t));
+    for (int i = 0; i < peak; i++) {
+        Position pos = {(float)i, 0.0f};
+        Velocity vel = {1.0f, 1.0f};
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        tecs_set(world, entities[i], vel_id, &vel, sizeof(Velocity));
+    }
+    int peak_chunks = tecs_world_chunk_count(world);
+    for (int i = 100; i < peak; i++) tecs_entity_delete(world, entities[i]);
+
+    /* Keep one spare chunk: {Position} and root are already at one chunk */
+    tecs_shrink_policy_t policy = {1, true, true, 0};
+    tecs_shrink_stats_t stats;
+    assert(tecs_world_shrink(world, &policy, &stats));
+    assert(stats.chunks_freed == 3);
+    assert(tecs_world_chunk_count(world) == peak_chunks - 3);
+    assert(stats.bytes_freed > 0);
+#ifdef MADV_DONTNEED
+    assert(stats.bytes_released > 0);
+#endif
+
+    /* Live rows are untouched; stale handles stay stale */
+    for (int i = 0; i < 100; i++) {
+        assert(((Position*)tecs_get(world, entities[i], pos_id))->x == (float)i);
+    }
+    assert(!tecs_entity_exists(world, entities[peak - 1]));
+
+    /* A second pass has nothing left to do */
+    assert(tecs_world_shrink(world, &policy, &stats));
+    assert(stats.chunks_freed == 0 && stats.bytes_released == 0);
+
+    /* Released rows are usable again */
+    for (int i = 100; i < peak; i++) {
+        Position pos = {(float)i, 0.0f};
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        tecs_set(world, entities[i], vel_id, &pos, sizeof(Velocity));
+    }
+    for (int i = 0; i < peak; i++) {
+        assert(((Position*)tecs_get(world, entities[i], pos_id))->x == (float)i);
+    }
+
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Spare chunks, index arrays and free rows are returned\n");
+}
+
+static void test_shrink_explicit_ids(void) {
+    printf("Testing tecs_world_shrink() with explicit IDs...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+
+    /* Explicit IDs never advance the allocator's next index */
+    tecs_entity_t far = tecs_entity_new_with_id(world, TECS_ENTITY_MAKE(200000, 0));
+    assert(far != 0);
+    Position pos = {7.0f, 0.0f};
+    tecs_set(world, far, pos_id, &pos, sizeof(Position));
+
+    assert(tecs_world_shrink(world, NULL, NULL));
+    assert(((Position*)tecs_get(world, far, pos_id))->x == 7.0f);
+
+    /* The generation slot survived: deleting bumps it, the old handle goes stale */
+    tecs_entity_delete(world, far);
+    assert(!tecs_entity_exists(world, far));
+    tecs_entity_t again = tecs_entity_new_with_id(world, TECS_ENTITY_MAKE(200000, 1));
+    assert(again != 0 && !tecs_entity_exists(world, far));
+    (void)again;
+
+    tecs_world_free(world);
+    printf("  ✓ Index arrays keep room for live explicit IDs\n");
+}
+
+static void test_shrink_budget(void) {
+    printf("Testing incremental tecs_world_shrink()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t kinds[200];
+    for (int i = 0; i < 200; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Kind%d", i);
+        kinds[i] = tecs_register_component(world, name, 0);
+
+        tecs_entity_t e = tecs_entity_new(world);
+        Position pos = {(float)i, 0.0f};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_add_tag(world, e, kinds[i]);
+    }
+
+    /* A tiny budget spreads the pass over several calls */
+    tecs_shrink_policy_t policy = {0, true, true, 1};
+    int calls = 1;
+    while (!tecs_world_shrink(world, &policy, NULL)) calls++;
+    assert(calls > 1 && calls <= tecs_world_archetype_count(world) + 1);
+
+    /* Then a new pass starts from the beginning */
+    policy.budget_ns = 0;
+    assert(tecs_world_shrink(world, &policy, NULL));
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+    int total = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) total += tecs_iter_count(iter);
+    tecs_query_iter_free(iter);
+    assert(total == 200);
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+    printf("  ✓ Budgeted passes resume where they stopped\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Shrink Tests ===\n\n");
+
+    test_shrink_after_peak();
+    test_shrink_explicit_ids();
+    test_shrink_budget();
+
+    printf("\n=== All Shrink Tests Passed ✓ ===\n");
+    return 0;
+}
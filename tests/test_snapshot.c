@@ -0,0 +1,249 @@
+/*
+ * Test: Snapshots
+ * Tests published read-only snapshots, chunk sharing, reader pins and concurrent reads
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    int value;
+} Health;
+
+static float snapshot_sum_x(const tecs_snapshot_t* snapshot, tecs_component_id_t pos_id, int* count) {
+    tecs_snapshot_iter_t iter;
+    tecs_snapshot_iter_init(&iter, snapshot, &pos_id, 1);
+
+    float sum = 0.0f;
+    *count = 0;
+    while (tecs_snapshot_iter_next(&iter)) {
+        const Position* positions = (const Position*)tecs_snapshot_iter_column(&iter, 0);
+        for (int i = 0; i < tecs_snapshot_iter_count(&iter); i++) sum += positions[i].x;
+        *count += tecs_snapshot_iter_count(&iter);
+    }
+    return sum;
+}
+
+static void test_snapshot_publish(void) {
+    printf("Testing tecs_snapshot_publish() and iteration...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    tecs_snapshot_component(world, pos_id);
+
+    assert(tecs_snapshot_acquire(world) == NULL);
+
+    tecs_entity_t entities[100];
+    for (int i = 0; i < 100; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {1.0f, 0.0f};
+        Health hp = {i};
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        if (i < 10) tecs_set(world, entities[i], hp_id, &hp, sizeof(Health));
+    }
+    tecs_world_update(world);
+
+    const tecs_snapshot_t* first = tecs_snapshot_acquire(world);
+    assert(first && tecs_snapshot_entity_count(first) == 100);
+    int count;
+    assert(snapshot_sum_x(first, pos_id, &count) == 100.0f && count == 100);
+
+    /* Components not marked for snapshots are not visible */
+    tecs_snapshot_iter_t iter;
+    tecs_snapshot_iter_init(&iter, first, &hp_id, 1);
+    assert(!tecs_snapshot_iter_next(&iter));
+
+    /* The pinned snapshot is immutable while the world moves on */
+    Position moved = {5.0f, 0.0f};
+    tecs_set(world, entities[50], pos_id, &moved, sizeof(Position));
+    tecs_entity_delete(world, entities[0]);
+    tecs_world_update(world);
+
+    const tecs_snapshot_t* second = tecs_snapshot_acquire(world);
+    assert(second != first);
+    assert(tecs_snapshot_tick(second) > tecs_snapshot_tick(first));
+    assert(snapshot_sum_x(first, pos_id, &count) == 100.0f && count == 100);
+    assert(snapshot_sum_x(second, pos_id, &count) == 103.0f && count == 99);
+
+    tecs_snapshot_release(world, first);
+    tecs_snapshot_release(world, second);
+    tecs_world_free(world);
+    printf("  ✓ Snapshots are published at update and stay immutable\n");
+}
+
+static const void* first_column(const tecs_snapshot_t* snapshot, tecs_component_id_t component_id) {
+    tecs_snapshot_iter_t iter;
+    tecs_snapshot_iter_init(&iter, snapshot, &component_id, 1);
+    return tecs_snapshot_iter_next(&iter) ? tecs_snapshot_iter_column(&iter, 0) : NULL;
+}
+
+static void test_snapshot_sharing_and_pins(void) {
+    printf("Testing chunk sharing and reader pins...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(world, "Health", sizeof(Health));
+    tecs_snapshot_component(world, pos_id);
+    tecs_snapshot_component(world, hp_id);
+
+    tecs_entity_t a = tecs_entity_new(world);
+    tecs_entity_t b = tecs_entity_new(world);
+    Position pos = {1.0f, 2.0f};
+    Health hp = {7};
+    tecs_set(world, a, pos_id, &pos, sizeof(Position));
+    tecs_set(world, b, hp_id, &hp, sizeof(Health));
+    tecs_world_update(world);
+
+    const tecs_snapshot_t* s1 = tecs_snapshot_acquire(world);
+
+    /* Only the changed chunk is copied again */
+    tecs_set(world, b, hp_id, &hp, sizeof(Health));
+    tecs_world_update(world);
+    const tecs_snapshot_t* s2 = tecs_snapshot_acquire(world);
+    assert(first_column(s1, pos_id) == first_column(s2, pos_id));
+    assert(first_column(s1, hp_id) != first_column(s2, hp_id));
+
+    /* Writes without a change tick are not picked up */
+    ((Position*)tecs_get(world, a, pos_id))->x = 9.0f;
+    assert(tecs_snapshot_publish(world));
+    const tecs_snapshot_t* s3 = tecs_snapshot_acquire(world);
+    assert(((const Position*)first_column(s3, pos_id))->x == 1.0f);
+
+    /* Every slot pinned: publishing is skipped until a reader lets go */
+    assert(!tecs_snapshot_publish(world));
+    tecs_snapshot_release(world, s1);
+    tecs_mark_changed(world, a, pos_id);
+    assert(tecs_snapshot_publish(world));
+    const tecs_snapshot_t* s4 = tecs_snapshot_acquire(world);
+    assert(((const Position*)first_column(s4, pos_id))->x == 9.0f);
+
+    /* Standalone publishes see writes made later in the same tick */
+    tecs_snapshot_release(world, s2);
+    tecs_snapshot_release(world, s3);
+    hp.value = 2;
+    tecs_set(world, b, hp_id, &hp, sizeof(Health));
+    assert(tecs_snapshot_publish(world));
+    const tecs_snapshot_t* s5 = tecs_snapshot_acquire(world);
+    assert(((const Health*)first_column(s5, hp_id))->value == 2);
+    tecs_snapshot_release(world, s5);
+    hp.value = 3;
+    tecs_set(world, b, hp_id, &hp, sizeof(Health));
+    assert(tecs_snapshot_publish(world));
+    const tecs_snapshot_t* s6 = tecs_snapshot_acquire(world);
+    assert(((const Health*)first_column(s6, hp_id))->value == 3);
+
+    /* A chunk written before an update is copied once, then shared */
+    tecs_world_update(world);
+    const tecs_snapshot_t* s7 = tecs_snapshot_acquire(world);
+    tecs_snapshot_release(world, s6);
+    tecs_world_update(world);
+    const tecs_snapshot_t* s8 = tecs_snapshot_acquire(world);
+    assert(first_column(s7, hp_id) == first_column(s8, hp_id));
+
+    tecs_snapshot_release(world, s4);
+    tecs_snapshot_release(world, s7);
+    tecs_snapshot_release(world, s8);
+    tecs_world_free(world);
+    printf("  ✓ Unchanged chunks are shared, same-tick writes are not, pinned slots are never reused\n");
+}
+
+typedef struct {
+    tecs_world_t* world;
+    tecs_component_id_t pos_id;
+    volatile int stop;
+    int snapshots_read;
+    int inconsistent;
+} ReaderState;
+
+static void reader_thread(void* arg) {
+    ReaderState* state = (ReaderState*)arg;
+
+    while (!__atomic_load_n(&state->stop, __ATOMIC_SEQ_CST)) {
+        const tecs_snapshot_t* snapshot = tecs_snapshot_acquire(state->world);
+        if (!snapshot) continue;
+
+        /* Every entity carries the same frame value in a consistent snapshot */
+        tecs_snapshot_iter_t iter;
+        tecs_snapshot_iter_init(&iter, snapshot, &state->pos_id, 1);
+        float expected = -1.0f;
+        int count = 0;
+        while (tecs_snapshot_iter_next(&iter)) {
+            const Position* positions = (const Position*)tecs_snapshot_iter_column(&iter, 0);
+            for (int i = 0; i < tecs_snapshot_iter_count(&iter); i++) {
+                if (expected < 0.0f) expected = positions[i].x;
+                if (positions[i].x != expected || positions[i].y != -expected) state->inconsistent++;
+            }
+            count += tecs_snapshot_iter_count(&iter);
+        }
+        if (count != tecs_snapshot_entity_count(snapshot)) state->inconsistent++;
+
+        tecs_snapshot_release(state->world, snapshot);
+        state->snapshots_read++;
+    }
+}
+
+static void test_snapshot_concurrent_readers(void) {
+    printf("Testing concurrent snapshot readers...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_snapshot_component(world, pos_id);
+
+    const int count = TECS_CHUNK_SIZE + 500;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(world);
+        Position pos = {0.0f, 0.0f};
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+    }
+    tecs_world_update(world);
+
+    ReaderState states[2];
+    tecs_thread_t* threads[2];
+    for (int t = 0; t < 2; t++) {
+        memset(&states[t], 0, sizeof(ReaderState));
+        states[t].world = world;
+        states[t].pos_id = pos_id;
+        threads[t] = tecs_thread_start(reader_thread, &states[t]);
+    }
+
+    for (int frame = 1; frame <= 200; frame++) {
+        for (int i = 0; i < count; i++) {
+            Position pos = {(float)frame, (float)-frame};
+            tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        }
+        tecs_world_update(world);
+    }
+
+    for (int t = 0; t < 2; t++) {
+        __atomic_store_n(&states[t].stop, 1, __ATOMIC_SEQ_CST);
+        tecs_thread_join(threads[t]);
+        assert(states[t].inconsistent == 0);
+        assert(states[t].snapshots_read > 0);
+    }
+
+    free(entities);
+    tecs_world_free(world);
+    printf("  ✓ Readers always see whole frames without locks\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Snapshot Tests ===\n\n");
+
+    test_snapshot_publish();
+    test_snapshot_sharing_and_pins();
+    test_snapshot_concurrent_readers();
+
+    printf("\n=== All Snapshot Tests Passed ✓ ===\n");
+    return 0;
+}
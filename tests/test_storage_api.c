@@ -393,7 +393,7 @@ static void test_large_component_swap(void) {
     printf("Testing large component swap (>256 bytes)...\n");
     
     typedef struct {
-        char data[512];  /* Larger than stack buffer */
+        char data[600];  /* Over two 256-byte swap blocks plus a partial one */
     } LargeComponent;
     
     tecs_world_t* world = tecs_world_new();
@@ -418,12 +418,208 @@ static void test_large_component_swap(void) {
     LargeComponent* l = (LargeComponent*)tecs_get(world, e2, large_id);
     assert(l != NULL);
     assert(l->data[0] == 'B');
-    
-    printf("  ✓ Large component swap works (heap allocation used)\n");
+
+    /* Native swap goes through the stack buffer block by block, tail included */
+    tecs_entity_t e3 = tecs_entity_new(world);
+    for (int i = 0; i < (int)sizeof(LargeComponent); i++) {
+        large1.data[i] = (char)(i % 251);
+        large2.data[i] = (char)(250 - i % 251);
+    }
+    tecs_set(world, e2, large_id, &large1, sizeof(LargeComponent));
+    tecs_set(world, e3, large_id, &large2, sizeof(LargeComponent));
+    tecs_entity_record_t* r2 = tecs_sparse_set_get(&world->entities, e2);
+    tecs_entity_record_t* r3 = tecs_sparse_set_get(&world->entities, e3);
+    assert(r2->archetype == r3->archetype && r2->chunk_index == r3->chunk_index);
+    tecs_column_t* column = &r2->archetype->chunks[r2->chunk_index]->columns[0];
+    column->provider->swap_data(column->provider->user_data, column->storage_data,
+                                r2->row % TECS_CHUNK_SIZE, r3->row % TECS_CHUNK_SIZE, sizeof(LargeComponent));
+    assert(memcmp(tecs_get(world, e2, large_id), &large2, sizeof(LargeComponent)) == 0);
+    assert(memcmp(tecs_get(world, e3, large_id), &large1, sizeof(LargeComponent)) == 0);
+    (void)r3;
+
+    printf("  ✓ Large component swap works (blocked through the stack buffer)\n");
     
     tecs_world_free(world);
 }
 
+static void test_query_fill_chunks(void) {
+    printf("Testing tecs_query_fill_chunks()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    test_storage_data_t custom_storage = {0};
+    tecs_storage_provider_t custom_provider = {
+        .alloc_chunk = test_alloc_chunk,
+        .free_chunk = test_free_chunk,
+        .get_ptr = test_get_ptr,
+        .set_data = test_set_data,
+        .copy_data = test_copy_data,
+        .swap_data = test_swap_data,
+        .user_data = &custom_storage,
+        .name = "test_spans"
+    };
+
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t health_id = tecs_register_component_ex(world, "Health", sizeof(Health), &custom_provider);
+    tecs_component_id_t tag_id = tecs_register_component(world, "Tag", 0);
+
+    /* 5000 entities with custom-storage Health (two chunks), 100 with Position only */
+    for (int i = 0; i < 5100; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        Position pos = {(float)i, 0.0f};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_add_tag(world, e, tag_id);
+        if (i < 5000) tecs_set(world, e, health_id, &(Health){i}, sizeof(Health));
+    }
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_optional(query, health_id);
+    tecs_query_with(query, tag_id);
+    tecs_query_build(query);
+
+    const tecs_component_id_t components[3] = {pos_id, health_id, tag_id};
+    int total = tecs_query_fill_chunks(query, components, 3, NULL, NULL, 0);
+    assert(total == 3);
+
+    tecs_chunk_span_t spans[3];
+    void* columns[3 * 3];
+    assert(tecs_query_fill_chunks(query, components, 3, spans, columns, 3) == 3);
+
+    /* Same chunks, rows and pointers as the iterator */
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    int index = 0, rows = 0;
+    while (tecs_iter_next(iter)) {
+        tecs_chunk_span_t* span = &spans[index++];
+        assert(span->columns == columns + (index - 1) * 3);
+        assert(span->count == tecs_iter_count(iter));
+        assert(span->entities == tecs_iter_entities(iter));
+        assert(span->columns[0] == tecs_iter_column(iter, tecs_iter_column_index(iter, pos_id)));
+        assert(span->columns[2] == NULL);
+        rows += span->count;
+
+        int health_column = tecs_iter_column_index(iter, health_id);
+        if (health_column < 0) {
+            assert(span->columns[1] == NULL && span->custom_mask == 0);
+        } else {
+            assert(span->custom_mask == 2u);
+            assert(span->columns[1] == tecs_iter_chunk_data(iter, health_column));
+            Position* pos = (Position*)span->columns[0];
+            Health* health = (Health*)span->columns[1];
+            for (int i = 0; i < span->count; i++) assert(health[i].value == (int)pos[i].x);
+        }
+    }
+    tecs_query_iter_free(iter);
+    assert(index == 3 && rows == 5100);
+
+    /* Writes through a span land in the world */
+    ((Position*)spans[0].columns[0])[0].y = 42.0f;
+    assert(((Position*)tecs_get(world, spans[0].entities[0], pos_id))->y == 42.0f);
+
+    /* A short buffer is filled partially; the count still covers every chunk */
+    assert(tecs_query_fill_chunks(query, components, 3, spans, columns, 1) == 3);
+    assert(spans[0].count > 0);
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+    free(custom_storage.chunks);
+    printf("  ✓ Spans match the iterator for native, custom and missing columns\n");
+}
+
+static void test_boxed_storage(void) {
+    printf("Testing tecs_register_component_boxed()...\n");
+
+    typedef struct {
+        int owner;
+        int items[255];
+    } Inventory;
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(world, "Position", sizeof(Position));
+    tecs_component_id_t inv_id = tecs_register_component_boxed(world, "Inventory", sizeof(Inventory));
+    tecs_component_id_t tag_id = tecs_register_component(world, "Looted", 0);
+    assert(tecs_register_component_boxed(world, "Inventory", sizeof(Inventory)) == inv_id);
+
+    const int count = 5000;
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        Inventory inv = {i, {0}};
+        inv.items[254] = i * 3;
+        entities[i] = tecs_entity_new(world);
+        tecs_set(world, entities[i], inv_id, &inv, sizeof(Inventory));
+    }
+
+    /* Archetype moves carry the row pointer, not the value */
+    const Inventory* before = tecs_get(world, entities[7], inv_id);
+    for (int i = 0; i < count; i++) {
+        Position pos = {(float)i, 0.0f};
+        tecs_set(world, entities[i], pos_id, &pos, sizeof(Position));
+        if (i % 2) tecs_add_tag(world, entities[i], tag_id);
+    }
+    assert(tecs_get(world, entities[7], inv_id) == before);
+
+    /* Swap-removes keep every survivor's value */
+    for (int i = 0; i < count; i += 3) tecs_entity_delete(world, entities[i]);
+    for (int i = 0; i < count; i++) {
+        const Inventory* inv = tecs_get(world, entities[i], inv_id);
+        if (i % 3 == 0) {
+            assert(!tecs_entity_exists(world, entities[i]));
+            continue;
+        }
+        assert(inv && inv->owner == i && inv->items[254] == i * 3);
+    }
+
+    /* Iteration resolves rows through tecs_iter_boxed */
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, inv_id);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+    int seen = 0;
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) {
+        int column = tecs_iter_column_index(iter, inv_id);
+        Inventory** inv = (Inventory**)tecs_iter_boxed(iter, column);
+        Position* pos = tecs_iter_column(iter, tecs_iter_column_index(iter, pos_id));
+        assert(inv && tecs_iter_column(iter, column) == NULL);
+        assert(tecs_iter_boxed(iter, tecs_iter_column_index(iter, pos_id)) == NULL);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            assert(inv[i]->owner == (int)pos[i].x);
+            inv[i]->items[0]++;
+        }
+        seen += tecs_iter_count(iter);
+    }
+    tecs_query_iter_free(iter);
+    assert(seen == tecs_world_entity_count(world));
+    assert(((const Inventory*)tecs_get(world, entities[1], inv_id))->items[0] == 1);
+
+    /* Removing the component and re-adding it reuses slots */
+    tecs_unset(world, entities[1], inv_id);
+    assert(!tecs_has(world, entities[1], inv_id));
+    tecs_set(world, entities[1], inv_id, &(Inventory){42, {0}}, sizeof(Inventory));
+    assert(((const Inventory*)tecs_get(world, entities[1], inv_id))->owner == 42);
+
+    /* Transfers give the destination world its own slab */
+    tecs_world_t* dst = tecs_world_new();
+    tecs_world_map_t* map = tecs_world_map_new(world, dst);
+    tecs_entity_remap_t* remap = tecs_entity_remap_new();
+    assert(tecs_transfer_query(map, query, TECS_TRANSFER_MOVE, remap) == seen);
+    tecs_world_map_free(map);
+    tecs_query_free(query);
+    tecs_world_free(world);
+
+    for (int i = 0; i < count; i++) {
+        if (i % 3 == 0) continue;
+        tecs_entity_t moved = tecs_entity_remap_get(remap, entities[i]);
+        const Inventory* inv = tecs_get(dst, moved, inv_id);
+        assert(inv && inv->owner == (i == 1 ? 42 : i));
+        assert(inv->items[254] == (i == 1 ? 0 : i * 3));
+    }
+
+    tecs_entity_remap_free(remap);
+    tecs_world_free(dst);
+    free(entities);
+    printf("  ✓ Boxed values survive moves, swap-removes, iteration and transfers\n");
+}
+
 int main(void) {
     printf("=== TinyECS Storage Provider API Tests ===\n\n");
     
@@ -434,6 +630,8 @@ int main(void) {
     test_component_registry_lookup_performance();
     test_get_default_storage_provider();
     test_large_component_swap();
+    test_query_fill_chunks();
+    test_boxed_storage();
     
     printf("\n=== All Storage API Tests Passed ✓ ===\n");
     return 0;
@@ -0,0 +1,187 @@
+/*
+ * Test: API Tracing
+ * Tests recording structural calls into a trace file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+#define TRACE_PATH "test_trace.tecstrace"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float x, y;
+} Velocity;
+
+static uint64_t read_varint(const unsigned char* data, size_t* pos) {
+    uint64_t value = 0;
+    int shift = 0;
+    while (data[*pos] & 0x80) {
+        value |= (uint64_t)(data[(*pos)++] & 0x7f) << shift;
+        shift += 7;
+    }
+    return value | (uint64_t)data[(*pos)++] << shift;
+}
+
+/* Reads the file back: opcode bytes in order and per opcode, operands skipped */
+static int read_ops(unsigned char* ops, int capacity, int* counts) {
+    FILE* file = fopen(TRACE_PATH, "rb");
+    assert(file);
+    (void)capacity;
+    static unsigned char data[1 << 16];
+    size_t size = fread(data, 1, sizeof(data), file);
+    fclose(file);
+    assert(size >= 8 && memcmp(data, TECS_TRACE_MAGIC, 8) == 0);
+
+    /* Operand count per opcode; REGISTER and QUERY end with a length */
+    static const int operands[] = {0, 3, 1, 1, 1, 2, 2, 2, 2, 1, 0, 0, 2, 3, 1};
+    int count = 0;
+    size_t pos = 8;
+    while (pos < size) {
+        int op = data[pos++];
+        assert(op >= TECS_TRACE_REGISTER && op <= TECS_TRACE_FRAME && count < capacity);
+        ops[count++] = (unsigned char)op;
+        counts[op]++;
+
+        uint64_t last = 0;
+        for (int v = 0; v < operands[op]; v++) last = read_varint(data, &pos);
+        if (op == TECS_TRACE_REGISTER) pos += (size_t)last;
+        for (uint64_t t = 0; op == TECS_TRACE_QUERY && t < 2 * last; t++) read_varint(data, &pos);
+    }
+    assert(pos == size);
+    return count;
+}
+
+static void test_trace_records(void) {
+    printf("Testing tecs_trace_begin()...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = TECS_REGISTER_COMPONENT(world, Position);
+    tecs_component_id_t vel_id = TECS_REGISTER_COMPONENT(world, Velocity);
+
+    /* Entities that exist before recording are written first */
+    tecs_entity_t existing = tecs_entity_new(world);
+    Position pos = {1.0f, 2.0f};
+    tecs_set(world, existing, pos_id, &pos, sizeof(Position));
+
+    bool opened = tecs_trace_begin(world, "/nonexistent-dir/trace.bin");
+    assert(!opened);
+    opened = tecs_trace_begin(world, TRACE_PATH);
+    assert(opened);
+    uint64_t snapshot = tecs_trace_record_count(world);  /* REGISTERs, SPAWN and SET */
+    assert(snapshot >= 3);
+
+    tecs_query_t* query = tecs_query_new(world);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+
+    for (int frame = 0; frame < 3; frame++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        Velocity vel = {1.0f, 0.0f};
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+        tecs_set(world, e, vel_id, &vel, sizeof(Velocity));
+
+        tecs_query_iter_t iter;
+        tecs_query_iter_init(&iter, query);
+        while (tecs_iter_next(&iter)) {}
+        tecs_world_update(world);
+    }
+
+    /* Deferred commands are recorded once, when queued */
+    tecs_begin_deferred(world);
+    tecs_unset(world, existing, pos_id);
+    tecs_entity_delete(world, existing);
+    tecs_end_deferred(world);
+
+    /* Hierarchy ops are single records, their bookkeeping is not */
+    tecs_entity_t parent = tecs_entity_new(world);
+    tecs_entity_t child = tecs_entity_new(world);
+    tecs_add_child(world, parent, child);
+    tecs_remove_child(world, parent, child);
+
+    uint64_t records = tecs_trace_record_count(world);
+    bool written = tecs_trace_end(world);
+    assert(written);
+    (void)opened; (void)written; (void)records;
+    assert(tecs_trace_record_count(world) == 0);
+
+    unsigned char ops[256];
+    int counts[TECS_TRACE_FRAME + 1] = {0};
+    int count = read_ops(ops, 256, counts);
+    (void)count;
+    assert(ops[0] == TECS_TRACE_SPAWN);
+    assert(counts[TECS_TRACE_REGISTER] >= 1);
+    assert((uint64_t)count == records);
+    for (uint64_t i = 0; i < snapshot; i++) {
+        assert(ops[i] == TECS_TRACE_REGISTER || ops[i] == TECS_TRACE_SPAWN || ops[i] == TECS_TRACE_SET);
+    }
+    assert(counts[TECS_TRACE_SPAWN] == 1 + 3 + 2);
+    assert(counts[TECS_TRACE_SET] == 1 + 6);
+    assert(counts[TECS_TRACE_UNSET] == 1);
+    assert(counts[TECS_TRACE_DELETE] == 1);
+    assert(counts[TECS_TRACE_QUERY] == 1);
+    assert(counts[TECS_TRACE_ITER] == 3);
+    assert(counts[TECS_TRACE_FRAME] == 3);
+    assert(counts[TECS_TRACE_DEFER_BEGIN] == 1);
+    assert(counts[TECS_TRACE_DEFER_END] == 1);
+    assert(counts[TECS_TRACE_ADD_CHILD] == 1);
+    assert(counts[TECS_TRACE_REMOVE_CHILD] == 1);
+
+    /* Components are announced before their first use */
+    for (int i = 0; ops[i] != TECS_TRACE_SET; i++) assert(i + 1 < count);
+    for (int i = 0; ops[i] != TECS_TRACE_REGISTER; i++) assert(ops[i] != TECS_TRACE_SET);
+
+    tecs_query_free(query);
+    tecs_world_free(world);
+    printf("  ✓ Structural calls are recorded once, in order\n");
+}
+
+static void test_trace_closed_by_world_free(void) {
+    printf("Testing trace lifetime...\n");
+
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t pos_id = TECS_REGISTER_COMPONENT(world, Position);
+    bool opened = tecs_trace_begin(world, TRACE_PATH);
+    assert(opened);
+    Position pos = {0.0f, 0.0f};
+    tecs_set(world, tecs_entity_new(world), pos_id, &pos, sizeof(Position));  /* Announces Position */
+    uint64_t start = tecs_trace_record_count(world);
+
+    /* Enough records to flush the write buffer several times */
+    for (int i = 0; i < 20000; i++) {
+        tecs_entity_t e = tecs_entity_new(world);
+        tecs_set(world, e, pos_id, &pos, sizeof(Position));
+    }
+    assert(tecs_trace_record_count(world) - start == 40000);
+    (void)opened; (void)start;
+    tecs_world_free(world);
+
+    FILE* file = fopen(TRACE_PATH, "rb");
+    assert(file);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    assert(size > 8 + 40000 * 3);
+    (void)size;
+
+    remove(TRACE_PATH);
+    printf("  ✓ tecs_world_free flushes and closes an open trace\n");
+}
+
+int main(void) {
+    printf("=== TinyECS Trace Tests ===\n\n");
+
+    test_trace_records();
+    test_trace_closed_by_world_free();
+
+    printf("\n=== All Trace Tests Passed ✓ ===\n");
+    return 0;
+}
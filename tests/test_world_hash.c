@@ -0,0 +1,218 @@
+/*
+ * Test: World Hashing
+ * Tests deterministic world checksums, chunk hash caching and desync diffing
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    int value;
+} Health;
+
+typedef struct {
+    tecs_world_t* world;
+    tecs_component_id_t pos_id;
+    tecs_component_id_t hp_id;
+    tecs_entity_t entities[300];
+} Sim;
+
+static void sim_init(Sim* sim) {
+    sim->world = tecs_world_new();
+    sim->pos_id = tecs_register_component(sim->world, "Position", sizeof(Position));
+    sim->hp_id = tecs_register_component(sim->world, "Health", sizeof(Health));
+
+    for (int i = 0; i < 300; i++) {
+        sim->entities[i] = tecs_entity_new(sim->world);
+        Position pos = {(float)i, 0.0f};
+        tecs_set(sim->world, sim->entities[i], sim->pos_id, &pos, sizeof(Position));
+        if (i % 2 == 0) {
+            Health hp = {100};
+            tecs_set(sim->world, sim->entities[i], sim->hp_id, &hp, sizeof(Health));
+        }
+    }
+}
+
+static void sim_step(Sim* sim) {
+    tecs_query_t* query = tecs_query_new(sim->world);
+    tecs_query_with(query, sim->pos_id);
+    tecs_query_build(query);
+
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    while (tecs_iter_next(iter)) {
+        int column = tecs_iter_column_index(iter, sim->pos_id);
+        Position* positions = (Position*)tecs_iter_column(iter, column);
+        tecs_entity_t* entities = tecs_iter_entities(iter);
+        for (int i = 0; i < tecs_iter_count(iter); i++) {
+            positions[i].y += 1.0f;
+            tecs_mark_changed(sim->world, entities[i], sim->pos_id);
+        }
+    }
+    tecs_query_iter_free(iter);
+    tecs_query_free(query);
+
+    tecs_world_update(sim->world);
+}
+
+static void test_world_hash_deterministic(void) {
+    printf("Testing tecs_world_hash() determinism...\n");
+
+    Sim a, b;
+    sim_init(&a);
+    sim_init(&b);
+
+    assert(tecs_world_hash(a.world) == tecs_world_hash(b.world));
+    for (int step = 0; step < 5; step++) {
+        sim_step(&a);
+        sim_step(&b);
+        assert(tecs_world_hash(a.world) == tecs_world_hash(b.world));
+    }
+
+    /* Hashing is stable when nothing changed */
+    uint64_t hash = tecs_world_hash(a.world);
+    assert(tecs_world_hash(a.world) == hash);
+
+    /* Any write marked as changed shows up */
+    Position pos = {-1.0f, -1.0f};
+    tecs_set(a.world, a.entities[42], a.pos_id, &pos, sizeof(Position));
+    assert(tecs_world_hash(a.world) != hash);
+
+    /* Structural changes show up */
+    hash = tecs_world_hash(b.world);
+    tecs_unset(b.world, b.entities[10], b.hp_id);
+    assert(tecs_world_hash(b.world) != hash);
+
+    /* An empty world still hashes consistently */
+    tecs_world_t* empty_a = tecs_world_new();
+    tecs_world_t* empty_b = tecs_world_new();
+    assert(tecs_world_hash(empty_a) == tecs_world_hash(empty_b));
+
+    tecs_world_free(empty_a);
+    tecs_world_free(empty_b);
+    tecs_world_free(a.world);
+    tecs_world_free(b.world);
+    printf("  ✓ Identical simulations produce identical hashes\n");
+}
+
+static void test_world_hash_cache(void) {
+    printf("Testing chunk hash caching...\n");
+
+    Sim sim;
+    sim_init(&sim);
+    tecs_world_update(sim.world);
+    uint64_t hash = tecs_world_hash(sim.world);
+
+    /* Writes through raw pointers without a change tick reuse the cached hash */
+    Health* hp = (Health*)tecs_get(sim.world, sim.entities[4], sim.hp_id);
+    hp->value = 1;
+    assert(tecs_world_hash(sim.world) == hash);
+
+    /* Once the write is marked changed the chunk is rehashed */
+    Health updated = {1};
+    tecs_set(sim.world, sim.entities[4], sim.hp_id, &updated, sizeof(Health));
+    uint64_t rehashed = tecs_world_hash(sim.world);
+    assert(rehashed != hash);
+
+    /* Hibernated chunks keep their cached hash */
+    tecs_world_update(sim.world);
+    tecs_world_update(sim.world);
+    rehashed = tecs_world_hash(sim.world);
+    assert(tecs_world_hibernate(sim.world, 1) > 0);
+    assert(tecs_world_hash(sim.world) == rehashed);
+    assert(tecs_world_hibernation_stats(sim.world).chunk_count > 0);
+
+    tecs_world_free(sim.world);
+    printf("  ✓ Clean chunks are not rehashed\n");
+}
+
+static void test_world_diff(void) {
+    printf("Testing tecs_world_diff()...\n");
+
+    Sim a, b;
+    sim_init(&a);
+    sim_init(&b);
+
+    tecs_world_diff_t diff;
+    assert(!tecs_world_diff(a.world, b.world, &diff));
+    assert(diff.entity == TECS_ENTITY_NULL);
+
+    /* Diverging component value */
+    Health hp = {7};
+    tecs_set(b.world, b.entities[120], b.hp_id, &hp, sizeof(Health));
+    assert(tecs_world_diff(a.world, b.world, &diff));
+    assert(diff.component_id == b.hp_id);
+    assert(diff.entity == b.entities[120]);
+
+    hp.value = 100;
+    tecs_set(b.world, b.entities[120], b.hp_id, &hp, sizeof(Health));
+    assert(!tecs_world_diff(a.world, b.world, &diff));
+
+    /* Diverging entity set */
+    tecs_entity_delete(b.world, b.entities[7]);
+    assert(tecs_world_diff(a.world, b.world, &diff));
+    assert(diff.component_id == 0);
+    assert(diff.entity == a.entities[7] || diff.entity == b.entities[299]);
+
+    /* Rows of a hibernated chunk are compared after waking it */
+    Sim c;
+    sim_init(&c);
+    tecs_world_hash(a.world);
+    tecs_world_update(a.world);
+    tecs_world_update(a.world);
+    int hibernated = tecs_world_hibernate(a.world, 1);
+    assert(hibernated > 0);
+    (void)hibernated;
+    hp.value = 9;
+    tecs_set(c.world, c.entities[40], c.hp_id, &hp, sizeof(Health));
+    assert(tecs_world_diff(a.world, c.world, &diff));
+    assert(diff.component_id == c.hp_id && diff.entity == c.entities[40]);
+
+    tecs_world_free(c.world);
+    tecs_world_free(a.world);
+    tecs_world_free(b.world);
+    printf("  ✓ Diff pinpoints the diverging component and entity\n");
+}
+
+static void test_world_hash_children(void) {
+    printf("Testing hierarchy hashing...\n");
+
+    tecs_world_t* a = tecs_world_new();
+    tecs_world_t* b = tecs_world_new();
+    tecs_world_t* worlds[2] = {a, b};
+
+    for (int w = 0; w < 2; w++) {
+        tecs_entity_t parent = tecs_entity_new(worlds[w]);
+        for (int i = 0; i < 3; i++) {
+            tecs_add_child(worlds[w], parent, tecs_entity_new(worlds[w]));
+        }
+    }
+
+    /* Children lists live at different addresses but hash by content */
+    assert(tecs_world_hash(a) == tecs_world_hash(b));
+    assert(!tecs_world_diff(a, b, NULL));
+
+    tecs_world_free(a);
+    tecs_world_free(b);
+    printf("  ✓ Children lists hash by content\n");
+}
+
+int main(void) {
+    printf("=== TinyECS World Hashing Tests ===\n\n");
+
+    test_world_hash_deterministic();
+    test_world_hash_cache();
+    test_world_diff();
+    test_world_hash_children();
+
+    printf("\n=== All World Hashing Tests Passed ✓ ===\n");
+    return 0;
+}
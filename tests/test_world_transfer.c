@@ -0,0 +1,292 @@
+/*
+ * Test: Cross-World Transfer
+ * Tests copying and moving entities between worlds with component remapping
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define TINYECS_IMPLEMENTATION
+#include "../tinyecs.h"
+
+typedef struct {
+    float x, y;
+} Position;
+
+typedef struct {
+    float dx, dy;
+} Velocity;
+
+typedef struct {
+    int value;
+} Health;
+
+static void test_transfer_query_copy(void) {
+    printf("Testing tecs_transfer_query() copy...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+
+    tecs_component_id_t pos_id = tecs_register_component(src, "Position", sizeof(Position));
+    tecs_component_id_t vel_id = tecs_register_component(src, "Velocity", sizeof(Velocity));
+    tecs_component_id_t tag_id = tecs_register_component(src, "Streamed", 0);
+
+    /* Register in a different order so IDs differ between worlds */
+    tecs_component_id_t dst_vel_id = tecs_register_component(dst, "Velocity", sizeof(Velocity));
+    tecs_register_component(dst, "Unrelated", sizeof(int));
+
+    const int count = TECS_CHUNK_SIZE + 100;  /* Spans more than one chunk */
+    tecs_entity_t* entities = malloc(count * sizeof(tecs_entity_t));
+    for (int i = 0; i < count; i++) {
+        entities[i] = tecs_entity_new(src);
+        Position pos = {(float)i, (float)(i * 2)};
+        Velocity vel = {1.0f, (float)i};
+        tecs_set(src, entities[i], pos_id, &pos, sizeof(Position));
+        tecs_set(src, entities[i], vel_id, &vel, sizeof(Velocity));
+        tecs_add_tag(src, entities[i], tag_id);
+    }
+
+    tecs_query_t* query = tecs_query_new(src);
+    tecs_query_with(query, pos_id);
+    tecs_query_build(query);
+
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    tecs_entity_remap_t* remap = tecs_entity_remap_new();
+
+    assert(tecs_world_map_component(map, vel_id) == dst_vel_id);
+
+    int transferred = tecs_transfer_query(map, query, TECS_TRANSFER_COPY, remap);
+    assert(transferred == count);
+    assert(tecs_entity_remap_count(remap) == count);
+    assert(tecs_world_entity_count(src) == count);
+    assert(tecs_world_entity_count(dst) == count);
+
+    /* Missing components were registered in the destination */
+    tecs_component_id_t dst_pos_id = tecs_get_component_id(dst, "Position");
+    tecs_component_id_t dst_tag_id = tecs_get_component_id(dst, "Streamed");
+    assert(dst_pos_id != 0 && dst_pos_id == pos_id);  /* Same name, same ID in every world */
+    assert(dst_tag_id != 0);
+
+    tecs_component_id_t dst_hp_id = tecs_register_component(dst, "Health", sizeof(Health));
+    for (int i = 0; i < count; i++) {
+        tecs_entity_t copy = tecs_entity_remap_get(remap, entities[i]);
+        assert(copy != TECS_ENTITY_NULL);
+        assert(tecs_entity_exists(dst, copy));
+        assert(tecs_has(dst, copy, dst_tag_id));
+
+        Position* pos = (Position*)tecs_get(dst, copy, dst_pos_id);
+        Velocity* vel = (Velocity*)tecs_get(dst, copy, dst_vel_id);
+        assert(pos && pos->x == (float)i && pos->y == (float)(i * 2));
+        assert(vel && vel->dy == (float)i);
+
+        /* Copies are fully functional entities */
+        Health health = {i};
+        tecs_set(dst, copy, dst_hp_id, &health, sizeof(Health));
+    }
+
+    /* Source entities are untouched */
+    Position* src_pos = (Position*)tecs_get(src, entities[10], pos_id);
+    assert(src_pos && src_pos->x == 10.0f);
+
+    tecs_entity_remap_free(remap);
+    tecs_world_map_free(map);
+    tecs_query_free(query);
+    free(entities);
+    tecs_world_free(src);
+    tecs_world_free(dst);
+    printf("  ✓ Query copy remaps components and entities\n");
+}
+
+static void test_transfer_query_move_keep_ids(void) {
+    printf("Testing tecs_transfer_query() move with kept IDs...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+
+    tecs_component_id_t pos_id = tecs_register_component(src, "Position", sizeof(Position));
+    tecs_component_id_t hp_id = tecs_register_component(src, "Health", sizeof(Health));
+
+    tecs_entity_t moved[50];
+    tecs_entity_t kept[50];
+    for (int i = 0; i < 50; i++) {
+        Position pos = {(float)i, 0.0f};
+        Health hp = {i};
+
+        moved[i] = tecs_entity_new(src);
+        tecs_set(src, moved[i], pos_id, &pos, sizeof(Position));
+        tecs_set(src, moved[i], hp_id, &hp, sizeof(Health));
+
+        kept[i] = tecs_entity_new(src);
+        tecs_set(src, kept[i], pos_id, &pos, sizeof(Position));
+    }
+
+    tecs_query_t* query = tecs_query_new(src);
+    tecs_query_with(query, hp_id);
+    tecs_query_build(query);
+
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    int transferred = tecs_transfer_query(map, query, TECS_TRANSFER_MOVE | TECS_TRANSFER_KEEP_IDS, NULL);
+    assert(transferred == 50);
+    assert(tecs_world_entity_count(src) == 50);
+    assert(tecs_world_entity_count(dst) == 50);
+
+    tecs_component_id_t dst_hp_id = tecs_world_map_component(map, hp_id);
+    for (int i = 0; i < 50; i++) {
+        assert(!tecs_entity_exists(src, moved[i]));
+        assert(tecs_entity_exists(dst, moved[i]));
+        Health* hp = (Health*)tecs_get(dst, moved[i], dst_hp_id);
+        assert(hp && hp->value == i);
+
+        Position* pos = (Position*)tecs_get(src, kept[i], pos_id);
+        assert(pos && pos->x == (float)i);
+    }
+
+    /* Source world stays usable after its rows were released */
+    tecs_entity_t fresh = tecs_entity_new(src);
+    assert(tecs_entity_exists(src, fresh));
+
+    tecs_world_map_free(map);
+    tecs_query_free(query);
+    tecs_world_free(src);
+    tecs_world_free(dst);
+    printf("  ✓ Move deletes source entities and keeps IDs\n");
+}
+
+static void test_transfer_entities_subset(void) {
+    printf("Testing tecs_transfer_entities()...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+
+    tecs_component_id_t pos_id = tecs_register_component(src, "Position", sizeof(Position));
+
+    tecs_entity_t entities[10];
+    for (int i = 0; i < 10; i++) {
+        entities[i] = tecs_entity_new(src);
+        Position pos = {(float)i, (float)i};
+        tecs_set(src, entities[i], pos_id, &pos, sizeof(Position));
+    }
+
+    /* Occupy the index of entities[2] so KEEP_IDS has to fall back to a fresh ID */
+    tecs_entity_t blocker = tecs_entity_new_with_id(dst, entities[2]);
+    assert(blocker == entities[2]);
+
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    tecs_entity_remap_t* remap = tecs_entity_remap_new();
+
+    tecs_entity_t subset[3] = {entities[0], entities[2], entities[9]};
+    int transferred = tecs_transfer_entities(map, subset, 3,
+                                             TECS_TRANSFER_MOVE | TECS_TRANSFER_KEEP_IDS, remap);
+    assert(transferred == 3);
+    assert(tecs_entity_remap_count(remap) == 3);
+    assert(tecs_entity_remap_get(remap, entities[0]) == entities[0]);
+    assert(tecs_entity_remap_get(remap, entities[2]) != entities[2]);
+    assert(tecs_entity_remap_sources(remap)[1] == entities[2]);
+
+    const float expected_x[3] = {0.0f, 2.0f, 9.0f};
+    tecs_component_id_t dst_pos_id = tecs_world_map_component(map, pos_id);
+    for (int i = 0; i < 3; i++) {
+        tecs_entity_t target = tecs_entity_remap_targets(remap)[i];
+        Position* pos = (Position*)tecs_get(dst, target, dst_pos_id);
+        assert(pos && pos->x == expected_x[i]);
+    }
+
+    /* Remaining source entities keep their values after the rows were compacted */
+    for (int i = 0; i < 10; i++) {
+        if (i == 0 || i == 2 || i == 9) {
+            assert(!tecs_entity_exists(src, entities[i]));
+            continue;
+        }
+        Position* pos = (Position*)tecs_get(src, entities[i], pos_id);
+        assert(pos && pos->x == (float)i);
+    }
+
+    /* Stale entities are skipped */
+    assert(tecs_transfer_entities(map, subset, 3, TECS_TRANSFER_COPY, NULL) == 0);
+
+    tecs_entity_remap_free(remap);
+    tecs_world_map_free(map);
+    tecs_world_free(src);
+    tecs_world_free(dst);
+    printf("  ✓ Entity subsets transfer and compact the source\n");
+}
+
+static void test_transfer_skips_hierarchy(void) {
+    printf("Testing hierarchy components are not transferred...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+
+    tecs_component_id_t pos_id = tecs_register_component(src, "Position", sizeof(Position));
+
+    tecs_entity_t parent = tecs_entity_new(src);
+    tecs_entity_t child = tecs_entity_new(src);
+    Position pos = {1.0f, 2.0f};
+    tecs_set(src, child, pos_id, &pos, sizeof(Position));
+    tecs_add_child(src, parent, child);
+
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    assert(tecs_world_map_component(map, tecs_get_parent_component_id(src)) == 0);
+
+    tecs_entity_remap_t* remap = tecs_entity_remap_new();
+    assert(tecs_transfer_entities(map, &child, 1, TECS_TRANSFER_COPY, remap) == 1);
+
+    tecs_entity_t copy = tecs_entity_remap_get(remap, child);
+    assert(!tecs_has_parent(dst, copy));
+    Position* copied = (Position*)tecs_get(dst, copy, tecs_world_map_component(map, pos_id));
+    assert(copied && copied->y == 2.0f);
+
+    tecs_entity_remap_free(remap);
+    tecs_world_map_free(map);
+    tecs_world_free(src);
+    tecs_world_free(dst);
+    printf("  ✓ Parent/children links stay in the source world\n");
+}
+
+static void test_transfer_skips_size_mismatch(void) {
+    printf("Testing components whose size differs in the destination...\n");
+
+    tecs_world_t* src = tecs_world_new();
+    tecs_world_t* dst = tecs_world_new();
+    tecs_component_id_t pos_id = tecs_register_component(src, "Position", sizeof(Position));
+    tecs_component_id_t src_hp_id = tecs_register_component(src, "Health", 8);
+    tecs_component_id_t dst_hp_id = tecs_register_component(dst, "Health", 4);
+
+    tecs_entity_t e = tecs_entity_new(src);
+    Position pos = {1.0f, 2.0f};
+    int64_t hp = 42;
+    tecs_set(src, e, pos_id, &pos, sizeof(Position));
+    tecs_set(src, e, src_hp_id, &hp, 8);
+
+    tecs_world_map_t* map = tecs_world_map_new(src, dst);
+    assert(tecs_world_map_component(map, src_hp_id) == 0);
+
+    tecs_entity_remap_t* remap = tecs_entity_remap_new();
+    assert(tecs_transfer_entities(map, &e, 1, TECS_TRANSFER_COPY, remap) == 1);
+    tecs_entity_t copy = tecs_entity_remap_get(remap, e);
+    assert(!tecs_has(dst, copy, dst_hp_id));
+    assert(tecs_get_component_size(dst, dst_hp_id) == 4);
+    assert(((Position*)tecs_get(dst, copy, tecs_world_map_component(map, pos_id)))->y == 2.0f);
+    (void)copy; (void)dst_hp_id;
+
+    tecs_entity_remap_free(remap);
+    tecs_world_map_free(map);
+    tecs_world_free(src);
+    tecs_world_free(dst);
+    printf("  ✓ The destination registry's size wins, the column is skipped\n");
+}
+
+int main(void) {
+    printf("=== TinyECS World Transfer Tests ===\n\n");
+
+    test_transfer_query_copy();
+    test_transfer_query_move_keep_ids();
+    test_transfer_entities_subset();
+    test_transfer_skips_hierarchy();
+    test_transfer_skips_size_mismatch();
+
+    printf("\n=== All World Transfer Tests Passed ✓ ===\n");
+    return 0;
+}
@@ -94,6 +94,23 @@ extern "C" {
 #define TECS_INITIAL_CHUNKS 4  /* Initial chunks per archetype */
 #endif
 
+#ifndef TECS_SNAPSHOT_SLOTS
+#define TECS_SNAPSHOT_SLOTS 3  /* Published + pinned + building snapshots */
+#endif
+
+#ifndef TECS_DEFER_PARALLEL_MIN
+#define TECS_DEFER_PARALLEL_MIN 256  /* Smaller deferred batches are applied serially */
+#endif
+
+#ifndef TECS_PREFETCH_DISTANCE
+#define TECS_PREFETCH_DISTANCE 2  /* Chunks query iteration prefetches ahead (0 = off, max 16);
+                                     column data is only prefetched from 4 */
+#endif
+
+#ifndef TECS_SHARD_PROXY_COMPONENTS
+#define TECS_SHARD_PROXY_COMPONENTS 4  /* Components a shard proxy can mirror */
+#endif
+
 /* ============================================================================
  * Type Definitions
  * ========================================================================= */
@@ -195,22 +212,138 @@ TECS_API tecs_tick_t tecs_world_tick(const tecs_world_t* world);
 TECS_API int tecs_world_entity_count(const tecs_world_t* world);
 TECS_API void tecs_world_clear(tecs_world_t* world);
 
-/* Component Registration */
+/* Component Registration
+ * A component's ID is a hash of its full name, so the same name gets the same ID in every
+ * world, translation unit and process. Registering a name again returns its existing ID,
+ * or 0 if the size differs from the first registration. */
 TECS_API tecs_component_id_t tecs_register_component(tecs_world_t* world, const char* name, int size);
 TECS_API tecs_component_id_t tecs_register_component_ex(tecs_world_t* world, const char* name, int size, 
                                                          tecs_storage_provider_t* storage_provider);
-TECS_API tecs_component_id_t tecs_get_component_id(const tecs_world_t* world, const char* name);
+TECS_API tecs_component_id_t tecs_get_component_id(const tecs_world_t* world, const char* name);  /* 0 if not registered */
+TECS_API tecs_component_id_t tecs_component_id_of(const char* name);  /* ID a name registers as; no world needed */
+TECS_API int tecs_get_component_size(const tecs_world_t* world, tecs_component_id_t component_id);  /* -1 if unknown */
 TECS_API tecs_storage_provider_t* tecs_get_default_storage_provider(void);
 
+/* Boxed Storage
+ * For large components (inventories, blackboards): values live in a per-component slab
+ * owned by the world and the chunk column holds one pointer per row, so archetype moves
+ * and swap-removes move 8 bytes instead of the value. tecs_get() returns the value as
+ * usual; during iteration tecs_iter_boxed() returns the row pointers (tecs_iter_column()
+ * is NULL for boxed columns, like any custom storage). */
+TECS_API tecs_component_id_t tecs_register_component_boxed(tecs_world_t* world, const char* name, int size);
+TECS_API void** tecs_iter_boxed(const tecs_query_iter_t* iter, int index);  /* NULL if not boxed */
+
+/* Component Type Hooks
+ * Lifecycle callbacks for components that own resources. Every hook works on
+ * `count` contiguous elements; native columns get one call per row range.
+ *   ctor:     default-construct (NULL = zero-fill), used by tecs_set with NULL data
+ *   dtor:     destroy on unset, delete, overwrite and world clear/free
+ *   copy:     copy-construct dst from src, used by tecs_set and copying transfers
+ *             (NULL = memcpy; a component with a dtor but no copy hook is move-only)
+ *   relocate: move-construct dst from src and end src's lifetime, used by tecs_set_move,
+ *             archetype transitions, swap-removes and moving transfers (NULL = memcpy)
+ * Set hooks before the component has entities. Hooked archetypes never hibernate;
+ * snapshots, region files and world hashes see the raw bytes. */
+typedef void (*tecs_xtor_fn)(void* ptr, int count, void* user_data);
+typedef void (*tecs_copy_fn)(void* dst, const void* src, int count, void* user_data);
+typedef void (*tecs_move_fn)(void* dst, void* src, int count, void* user_data);
+
+typedef struct {
+    tecs_xtor_fn ctor;
+    tecs_xtor_fn dtor;
+    tecs_copy_fn copy;
+    tecs_move_fn relocate;
+    void* user_data;
+} tecs_type_hooks_t;
+
+TECS_API tecs_component_id_t tecs_register_component_hooks(tecs_world_t* world, const char* name, int size,
+                                                            tecs_storage_provider_t* storage_provider,
+                                                            const tecs_type_hooks_t* hooks);
+TECS_API void tecs_set_component_hooks(tecs_world_t* world, tecs_component_id_t component_id,
+                                       const tecs_type_hooks_t* hooks);  /* NULL clears */
+
+/* Component Reflection
+ * Field descriptors attached to a component. Types are ordered by scalar width so
+ * TECS_FIELD can compute the element count at compile time:
+ *
+ *     static const tecs_field_t position_fields[] = {
+ *         TECS_FIELD(Position, x, TECS_FIELD_F32),
+ *         TECS_FIELD(Position, y, TECS_FIELD_F32),
+ *     };
+ *     TECS_REFLECT(world, pos_id, position_fields);
+ *
+ * Components without descriptors behave as one opaque byte field. */
+typedef enum {
+    TECS_FIELD_U8,
+    TECS_FIELD_I8,
+    TECS_FIELD_BOOL,
+    TECS_FIELD_BYTES,    /* Opaque bytes, never byte-swapped */
+    TECS_FIELD_U16,
+    TECS_FIELD_I16,
+    TECS_FIELD_U32,
+    TECS_FIELD_I32,
+    TECS_FIELD_F32,
+    TECS_FIELD_U64,
+    TECS_FIELD_I64,
+    TECS_FIELD_F64,
+    TECS_FIELD_ENTITY
+} tecs_field_type_t;
+
+typedef struct {
+    const char* name;
+    tecs_field_type_t type;
+    int offset;   /* Byte offset in the component */
+    int count;    /* Scalars in the field (> 1 for arrays) */
+} tecs_field_t;
+
+#define TECS_MAX_FIELDS 64  /* Field masks are 64-bit */
+
+#define TECS_FIELD_TYPE_SIZE(type) \
+    ((type) <= TECS_FIELD_BYTES ? 1 : (type) <= TECS_FIELD_I16 ? 2 : (type) <= TECS_FIELD_F32 ? 4 : 8)
+
+#define TECS_FIELD(T, member, type) \
+    { #member, type, (int)offsetof(T, member), (int)(sizeof(((T*)0)->member) / TECS_FIELD_TYPE_SIZE(type)) }
+
+#define TECS_REFLECT(world, component_id, fields) \
+    tecs_set_component_fields(world, component_id, fields, (int)(sizeof(fields) / sizeof((fields)[0])))
+
+TECS_API bool tecs_set_component_fields(tecs_world_t* world, tecs_component_id_t component_id,
+                                        const tecs_field_t* fields, int field_count);  /* false if invalid */
+TECS_API int tecs_get_component_fields(const tecs_world_t* world, tecs_component_id_t component_id,
+                                       const tecs_field_t** out_fields);  /* Returns field count */
+TECS_API int tecs_component_packed_size(const tecs_world_t* world, tecs_component_id_t component_id);
+
+/* Field kernels over arrays of `count` components. Encoded buffers hold
+ * count * tecs_component_packed_size() bytes: no padding, little-endian scalars. */
+TECS_API size_t tecs_fields_serialize(const tecs_world_t* world, tecs_component_id_t component_id,
+                                      const void* src, int count, void* out);
+TECS_API size_t tecs_fields_deserialize(const tecs_world_t* world, tecs_component_id_t component_id,
+                                        const void* in, int count, void* dst);
+/* Field-major deltas against a baseline (NULL = zeros): unchanged fields become
+ * runs of zero bytes that compress well. Lossless for every field type. */
+TECS_API size_t tecs_fields_delta_encode(const tecs_world_t* world, tecs_component_id_t component_id,
+                                         const void* baseline, const void* current, int count, void* out);
+TECS_API size_t tecs_fields_delta_decode(const tecs_world_t* world, tecs_component_id_t component_id,
+                                         const void* baseline, const void* in, int count, void* dst);
+/* masks[i] gets bit f set when field f differs between a[i] and b[i] (bitwise).
+ * Returns the number of components with at least one changed field. */
+TECS_API int tecs_fields_diff(const tecs_world_t* world, tecs_component_id_t component_id,
+                              const void* a, const void* b, int count, uint64_t* masks);
+
 /* Entity Operations */
 TECS_API tecs_entity_t tecs_entity_new(tecs_world_t* world);
-TECS_API tecs_entity_t tecs_entity_new_with_id(tecs_world_t* world, tecs_entity_t id);
+TECS_API tecs_entity_t tecs_entity_new_with_id(tecs_world_t* world, tecs_entity_t id);  /* Returns TECS_ENTITY_NULL on collision */
+TECS_API void tecs_world_reserve_id_range(tecs_world_t* world, uint32_t first_index, uint32_t count);
+TECS_API bool tecs_entity_id_is_reserved(const tecs_world_t* world, tecs_entity_t id);
 TECS_API void tecs_entity_delete(tecs_world_t* world, tecs_entity_t entity);
 TECS_API bool tecs_entity_exists(const tecs_world_t* world, tecs_entity_t entity);
 
 /* Component Operations */
 TECS_API void tecs_set(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
                        const void* data, int size);
+/* Like tecs_set, but relocates from data: its lifetime ends even if nothing is set */
+TECS_API void tecs_set_move(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
+                            void* data, int size);
 TECS_API void* tecs_get(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id);
 TECS_API const void* tecs_get_const(const tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id);
 TECS_API bool tecs_has(const tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id);
@@ -261,6 +394,8 @@ TECS_API void tecs_query_optional(tecs_query_t* query, tecs_component_id_t compo
 TECS_API void tecs_query_changed(tecs_query_t* query, tecs_component_id_t component_id);
 TECS_API void tecs_query_added(tecs_query_t* query, tecs_component_id_t component_id);
 TECS_API void tecs_query_build(tecs_query_t* query);
+TECS_API void tecs_query_set_prefetch(tecs_query_t* query, int distance);  /* Chunks ahead, 0 = off;
+                                                                             column data needs >= 4 */
 
 /* Query Iteration */
 TECS_API tecs_query_iter_t* tecs_query_iter(tecs_query_t* query);
@@ -277,12 +412,403 @@ TECS_API tecs_storage_provider_t* tecs_iter_storage_provider(const tecs_query_it
 TECS_API tecs_tick_t* tecs_iter_changed_ticks(const tecs_query_iter_t* iter, int index);
 TECS_API tecs_tick_t* tecs_iter_added_ticks(const tecs_query_iter_t* iter, int index);
 
-/* Deferred Operations (Thread-safe command buffers) */
+/* Resumable Iteration
+ * A cursor remembers where a budgeted walk stopped so the next frame continues there.
+ * Positions are kept by archetype ID rather than by index, so cursors stay valid when
+ * archetypes are created or removed in between; rows moved by swap-removal may be
+ * visited twice or skipped once in that pass. Zero-initialize a cursor before use. */
+typedef struct {
+    uint64_t archetype_id;  /* Archetypes are walked in ascending ID order */
+    int chunk_index;
+    int row;
+    uint32_t passes;        /* Completed walks over every matched entity */
+} tecs_query_cursor_t;
+
+/* Iterates at most max_rows rows (0 = no limit) starting at the cursor; may split chunks.
+ * Returns false at the end of a pass and rewinds the cursor. Free with tecs_query_iter_free(). */
+TECS_API tecs_query_iter_t* tecs_query_iter_resume(tecs_query_t* query, tecs_query_cursor_t* cursor,
+                                                   int max_rows);
+TECS_API int tecs_iter_offset(const tecs_query_iter_t* iter);  /* First chunk row of the current range */
+
+/* Batched Chunk Iteration
+ * Describes every non-empty matched chunk in one call, for bindings that pay per call
+ * (P/Invoke, FFI). Span i owns columns[i * component_count ..] in the order of `components`:
+ * native columns point at row 0, custom-storage columns hold the chunk's storage data (bit c
+ * of custom_mask set), absent components and tags are NULL. Only pointers and 32-bit fields,
+ * so the layout is blittable. At most 32 components. */
+typedef struct {
+    tecs_entity_t* entities;
+    void** columns;
+    int32_t count;
+    uint32_t custom_mask;
+} tecs_chunk_span_t;
+
+/* Returns the number of matched chunks and fills the first `capacity` of them (call with 0
+ * to size the buffers). Pointers stay valid until the next structural change. */
+TECS_API int tecs_query_fill_chunks(tecs_query_t* query, const tecs_component_id_t* components,
+                                    int component_count, tecs_chunk_span_t* spans,
+                                    void** columns, int capacity);
+
+/* Deferred Operations (Thread-safe command buffers)
+ * Between begin and end, tecs_set/tecs_add_tag/tecs_unset/tecs_entity_delete are queued
+ * (set copies the value bytes) and reads see the world as it was. */
 TECS_API void tecs_begin_deferred(tecs_world_t* world);
 TECS_API void tecs_end_deferred(tecs_world_t* world);
 
-/* Memory Management */
-TECS_API int tecs_remove_empty_archetypes(tecs_world_t* world);
+/* Memory Management
+ * Archetype GC unlinks graph edges and live query matches before freeing, and
+ * leaves tombstones in the archetype table. Do not collect during iteration. */
+typedef struct {
+    tecs_tick_t min_empty_ticks;  /* Only collect archetypes and chunks untouched this long (0 = at once) */
+    int keep_chunks;              /* Empty chunks kept per live archetype (-1 = keep all) */
+} tecs_archetype_gc_policy_t;
+
+TECS_API int tecs_world_gc_archetypes(tecs_world_t* world,
+                                      const tecs_archetype_gc_policy_t* policy);  /* NULL = {0, -1} */
+TECS_API int tecs_remove_empty_archetypes(tecs_world_t* world);  /* Collects every empty archetype */
+TECS_API int tecs_world_archetype_count(const tecs_world_t* world);  /* Root included */
+TECS_API int tecs_world_chunk_count(const tecs_world_t* world);
+
+/* Per-archetype numbers for monitoring. Slots index the archetype table, so a monitor
+ * can walk a few per frame; empty slots return false. Slot positions change when the
+ * table grows or archetypes are collected. */
+typedef struct {
+    uint64_t archetype_id;
+    int entity_count;
+    int chunk_count;
+    int component_count;  /* Data components and tags */
+    size_t bytes;         /* Chunk storage, including change ticks */
+} tecs_archetype_info_t;
+
+TECS_API int tecs_world_archetype_slots(const tecs_world_t* world);
+TECS_API bool tecs_world_archetype_info(const tecs_world_t* world, int slot, tecs_archetype_info_t* out);
+
+/* Shrink-to-fit. Each call continues where the previous one stopped, so a pass
+ * can be spread over idle frames. Free rows are returned to the OS with madvise
+ * where the platform exposes it; strict -std=c99 builds on glibc need a feature
+ * macro such as -D_DEFAULT_SOURCE (the Makefile passes it). */
+typedef struct {
+    int keep_chunks;      /* Empty chunks kept per archetype for reuse (-1 = keep all) */
+    bool trim_indices;    /* Shrink entity arrays and the command buffer to their high-water marks */
+    bool release_pages;   /* Return pages of free rows to the OS */
+    uint64_t budget_ns;   /* Stop once exceeded and resume on the next call (0 = whole pass) */
+} tecs_shrink_policy_t;
+
+typedef struct {
+    int chunks_freed;
+    size_t bytes_freed;     /* Heap bytes freed or given back by realloc */
+    size_t bytes_released;  /* Bytes of free rows passed to madvise */
+} tecs_shrink_stats_t;
+
+/* NULL policy = {0, true, true, 0}; stats may be NULL. True once a full pass completes */
+TECS_API bool tecs_world_shrink(tecs_world_t* world, const tecs_shrink_policy_t* policy,
+                                tecs_shrink_stats_t* stats);
+
+/* Capacity Planning
+ * Reserve storage ahead of a spawn wave so entity creation does not hit growth
+ * events (ID arrays, chunk lists, archetype table rehash, query rematching).
+ * Paths are walked from the root in the given component order, creating the
+ * intermediate archetypes and graph edges a real entity would take. Reserved
+ * chunks are empty, so a GC policy with keep_chunks >= 0 may trim them. */
+typedef struct {
+    const tecs_component_id_t* components;  /* In the order they will be added */
+    int component_count;
+    int rows;                               /* Rows to reserve in the final archetype */
+} tecs_archetype_desc_t;
+
+TECS_API void tecs_world_reserve_entities(tecs_world_t* world, int count);  /* On top of live entities */
+TECS_API void tecs_world_reserve_archetypes(tecs_world_t* world, int count);
+TECS_API int tecs_world_reserve_rows(tecs_world_t* world, const tecs_component_id_t* components,
+                                     int component_count, int rows);  /* Chunks added, -1 if unregistered */
+TECS_API int tecs_world_warm_up(tecs_world_t* world, const tecs_archetype_desc_t* descs,
+                                int desc_count);  /* Returns archetypes warmed */
+
+/* Cross-World Transfer
+ * A world map pairs two worlds and resolves component IDs by name once; components
+ * missing in the destination are registered there on first use. Hierarchy components
+ * reference world-owned storage and are not transferred, nor are components the
+ * destination registered under the same name with a different size. */
+typedef struct tecs_world_map_s tecs_world_map_t;
+typedef struct tecs_entity_remap_s tecs_entity_remap_t;
+
+typedef enum {
+    TECS_TRANSFER_COPY = 0,          /* Leave source entities in place */
+    TECS_TRANSFER_MOVE = 1 << 0,     /* Delete source entities after the copy */
+    TECS_TRANSFER_KEEP_IDS = 1 << 1  /* Reuse source IDs in the destination when free */
+} tecs_transfer_flags_t;
+
+TECS_API tecs_world_map_t* tecs_world_map_new(tecs_world_t* src, tecs_world_t* dst);
+TECS_API void tecs_world_map_free(tecs_world_map_t* map);
+TECS_API tecs_component_id_t tecs_world_map_component(tecs_world_map_t* map, tecs_component_id_t src_id);
+TECS_API int tecs_transfer_query(tecs_world_map_t* map, tecs_query_t* src_query, int flags,
+                                 tecs_entity_remap_t* remap);
+TECS_API int tecs_transfer_entities(tecs_world_map_t* map, const tecs_entity_t* entities, int count,
+                                    int flags, tecs_entity_remap_t* remap);
+
+/* Entity remap table (source ID -> destination ID), filled by transfers */
+TECS_API tecs_entity_remap_t* tecs_entity_remap_new(void);
+TECS_API void tecs_entity_remap_free(tecs_entity_remap_t* remap);
+TECS_API void tecs_entity_remap_clear(tecs_entity_remap_t* remap);
+TECS_API int tecs_entity_remap_count(const tecs_entity_remap_t* remap);
+TECS_API tecs_entity_t tecs_entity_remap_get(const tecs_entity_remap_t* remap, tecs_entity_t src);
+TECS_API const tecs_entity_t* tecs_entity_remap_sources(const tecs_entity_remap_t* remap);
+TECS_API const tecs_entity_t* tecs_entity_remap_targets(const tecs_entity_remap_t* remap);
+
+/* Chunk Hibernation
+ * Chunks that were not read or written for a number of ticks can be compressed in place
+ * (column delta encoding + LZ). Any access through the regular API decompresses them
+ * transparently; queries can opt out of waking them. Only native-storage chunks hibernate. */
+typedef struct {
+    int chunk_count;          /* Chunks currently hibernated */
+    size_t raw_bytes;         /* Column bytes those chunks hold when resident */
+    size_t compressed_bytes;  /* Bytes held while hibernated */
+} tecs_hibernation_stats_t;
+
+TECS_API int tecs_world_hibernate(tecs_world_t* world, tecs_tick_t idle_ticks);  /* Returns chunks hibernated */
+TECS_API int tecs_query_hibernate(tecs_query_t* query, tecs_tick_t idle_ticks);  /* Limited to the query's archetypes */
+TECS_API int tecs_world_wake(tecs_world_t* world);  /* Returns chunks decompressed */
+TECS_API void tecs_query_skip_hibernated(tecs_query_t* query, bool skip);
+TECS_API tecs_hibernation_stats_t tecs_world_hibernation_stats(const tecs_world_t* world);
+
+/* World Hashing
+ * Deterministic 64-bit checksum of all entities and component data, for lockstep and
+ * replay desync detection. Column hashes are cached per chunk and only recomputed when
+ * rows were added/removed or a change tick is newer than the cached hash, so writes made
+ * through raw column pointers must be marked changed. Archetypes are combined in
+ * ascending archetype ID order, chunks in storage order. Component bytes are hashed as
+ * stored, including any struct padding. */
+typedef struct {
+    uint64_t archetype_id;             /* Archetype where the worlds diverge */
+    tecs_component_id_t component_id;  /* Diverging component, 0 if the entity sets differ */
+    tecs_entity_t entity;              /* First diverging entity, TECS_ENTITY_NULL if none */
+    int chunk_index;
+    int row;
+} tecs_world_diff_t;
+
+TECS_API uint64_t tecs_world_hash(tecs_world_t* world);
+TECS_API bool tecs_world_diff(tecs_world_t* a, tecs_world_t* b, tecs_world_diff_t* out);  /* Returns true if the worlds differ */
+
+/* Snapshots
+ * Components marked with tecs_snapshot_component() are published at every
+ * tecs_world_update() into an immutable snapshot that other threads can read without
+ * locks while the owning thread keeps mutating the world. Only chunks whose rows or
+ * change ticks moved since the last publish are copied; unchanged chunk copies are
+ * shared between snapshots. Readers pin a snapshot with tecs_snapshot_acquire() and
+ * must release it; while all other slots are pinned, publishing is skipped. */
+typedef struct tecs_snapshot_s tecs_snapshot_t;
+
+typedef struct {
+    const tecs_snapshot_t* snapshot;
+    tecs_component_id_t terms[TECS_MAX_QUERY_TERMS];
+    int term_count;
+    int archetype_index;
+    int chunk_index;
+    int columns[TECS_MAX_QUERY_TERMS];  /* Column per term in the current archetype */
+} tecs_snapshot_iter_t;
+
+TECS_API void tecs_snapshot_component(tecs_world_t* world, tecs_component_id_t component_id);
+TECS_API bool tecs_snapshot_publish(tecs_world_t* world);  /* Also called by tecs_world_update() */
+TECS_API const tecs_snapshot_t* tecs_snapshot_acquire(tecs_world_t* world);  /* Any thread, NULL before the first publish */
+TECS_API void tecs_snapshot_release(tecs_world_t* world, const tecs_snapshot_t* snapshot);
+TECS_API tecs_tick_t tecs_snapshot_tick(const tecs_snapshot_t* snapshot);
+TECS_API int tecs_snapshot_entity_count(const tecs_snapshot_t* snapshot);
+
+/* Read-only iteration over snapshot chunks holding all `terms` */
+TECS_API void tecs_snapshot_iter_init(tecs_snapshot_iter_t* iter, const tecs_snapshot_t* snapshot,
+                                      const tecs_component_id_t* terms, int term_count);
+TECS_API bool tecs_snapshot_iter_next(tecs_snapshot_iter_t* iter);
+TECS_API int tecs_snapshot_iter_count(const tecs_snapshot_iter_t* iter);
+TECS_API const tecs_entity_t* tecs_snapshot_iter_entities(const tecs_snapshot_iter_t* iter);
+TECS_API const void* tecs_snapshot_iter_column(const tecs_snapshot_iter_t* iter, int term);
+
+/* Threading
+ * Thin wrappers over Win32 threads and pthreads for the asynchronous facilities. */
+typedef struct tecs_thread_s tecs_thread_t;
+typedef struct tecs_mutex_s tecs_mutex_t;
+typedef struct tecs_cond_s tecs_cond_t;
+typedef void (*tecs_thread_fn)(void* arg);
+
+TECS_API tecs_thread_t* tecs_thread_start(tecs_thread_fn fn, void* arg);
+TECS_API void tecs_thread_join(tecs_thread_t* thread);  /* Also frees the handle */
+TECS_API tecs_mutex_t* tecs_mutex_new(void);
+TECS_API void tecs_mutex_free(tecs_mutex_t* mutex);
+TECS_API void tecs_mutex_lock(tecs_mutex_t* mutex);
+TECS_API void tecs_mutex_unlock(tecs_mutex_t* mutex);
+TECS_API tecs_cond_t* tecs_cond_new(void);
+TECS_API void tecs_cond_free(tecs_cond_t* cond);
+TECS_API void tecs_cond_wait(tecs_cond_t* cond, tecs_mutex_t* mutex);
+TECS_API void tecs_cond_signal(tecs_cond_t* cond);
+TECS_API void tecs_cond_broadcast(tecs_cond_t* cond);
+TECS_API int tecs_cpu_count(void);
+TECS_API uint64_t tecs_time_ns(void);  /* Timestamp for budgets and profiling */
+
+/* Task Pool
+ * Persistent worker threads for index-parallel jobs. The calling thread takes part as
+ * worker 0 and tecs_task_pool_run() returns once every index has run. Not reentrant. */
+typedef struct tecs_task_pool_s tecs_task_pool_t;
+typedef void (*tecs_task_fn)(void* arg, int index, int worker);
+
+TECS_API tecs_task_pool_t* tecs_task_pool_new(int worker_count);  /* Includes the caller; 0 = CPU count */
+TECS_API void tecs_task_pool_free(tecs_task_pool_t* pool);
+TECS_API int tecs_task_pool_size(const tecs_task_pool_t* pool);
+TECS_API void tecs_task_pool_run(tecs_task_pool_t* pool, int count, tecs_task_fn fn, void* arg);
+
+/* Parallel deferred apply: tecs_end_deferred() groups queued commands by the archetypes
+ * their entities move between and applies disjoint groups on the pool. Archetypes,
+ * edges and chunks are created up front in command order, so the world ends up
+ * identical to a serial apply (same archetype IDs, rows and world hash). Commands
+ * touching hooked or custom-storage components run in one group. NULL = serial. */
+TECS_API void tecs_set_deferred_pool(tecs_world_t* world, tecs_task_pool_t* pool);
+
+/* Deterministic Parallel Execution
+ * tecs_query_par_run() splits the query's rows into partitions of at most
+ * partition_rows rows, walking archetypes in ID order and chunks in storage order, so
+ * partitions never depend on the pool size or on scheduling. Kernels may write the
+ * columns of their own rows and read other components; everything else goes through
+ * the ctx and is recorded per partition. Once all partitions ran, the calling thread
+ * merges the buffers in partition order: spawns first, then commands as one deferred
+ * batch, then events. Spawns return provisional IDs (TECS_ENTITY_PROVISIONAL set,
+ * partition and spawn index encoded) that commands of the same run may target;
+ * tecs_par_resolve() maps them to the real IDs once spawns were applied, e.g. in the
+ * event callback. Entity arguments of commands are resolved, component data is not.
+ * A NULL pool runs the partitions on the caller with the same result. */
+#define TECS_ENTITY_PROVISIONAL (1ULL << 63)
+
+typedef struct tecs_par_ctx_s tecs_par_ctx_t;
+typedef void (*tecs_par_kernel_fn)(tecs_par_ctx_t* ctx, tecs_query_iter_t* iter, void* user_data);
+typedef void (*tecs_par_event_fn)(tecs_par_ctx_t* ctx, uint32_t type, const void* data, int size,
+                                  void* user_data);
+
+typedef struct {
+    tecs_par_kernel_fn kernel;
+    tecs_par_event_fn on_event;  /* Called on the calling thread; NULL drops events */
+    void* user_data;
+    int partition_rows;          /* 0 = one partition per chunk */
+} tecs_par_desc_t;
+
+TECS_API int tecs_query_par_run(tecs_query_t* query, tecs_task_pool_t* pool, const tecs_par_desc_t* desc);  /* Returns partitions run */
+TECS_API int tecs_par_partition(const tecs_par_ctx_t* ctx);
+TECS_API tecs_entity_t tecs_par_spawn(tecs_par_ctx_t* ctx);
+TECS_API void tecs_par_set(tecs_par_ctx_t* ctx, tecs_entity_t entity, tecs_component_id_t component_id,
+                           const void* data, int size);
+TECS_API void tecs_par_unset(tecs_par_ctx_t* ctx, tecs_entity_t entity, tecs_component_id_t component_id);
+TECS_API void tecs_par_delete(tecs_par_ctx_t* ctx, tecs_entity_t entity);
+TECS_API void tecs_par_emit(tecs_par_ctx_t* ctx, uint32_t type, const void* data, int size);
+TECS_API tecs_entity_t tecs_par_resolve(const tecs_par_ctx_t* ctx, tecs_entity_t entity);
+
+/* Region Streaming
+ * Entities tagged with a region can be written to a chunk file and evicted. Unloaded
+ * entities keep their IDs (tecs_entity_exists() stays true) but have no components
+ * until the region is loaded again. Region files store component IDs and raw column
+ * bytes, so they are only valid for the world (and process) that wrote them. */
+typedef struct tecs_region_loader_s tecs_region_loader_t;
+
+TECS_API tecs_component_id_t tecs_region_tag(tecs_world_t* world, uint32_t region);
+TECS_API void tecs_set_region(tecs_world_t* world, tecs_entity_t entity, uint32_t region);
+TECS_API bool tecs_entity_is_resident(const tecs_world_t* world, tecs_entity_t entity);
+TECS_API int tecs_region_unload(tecs_world_t* world, uint32_t region, const char* path);  /* Returns entities unloaded, -1 on I/O error */
+TECS_API int tecs_region_load(tecs_world_t* world, const char* path);  /* Returns entities restored, -1 on error */
+
+/* Asynchronous loading: files are read and parsed on a worker thread, chunks are
+ * built on the calling thread in tecs_region_loader_sync() */
+TECS_API tecs_region_loader_t* tecs_region_loader_new(tecs_world_t* world);
+TECS_API void tecs_region_loader_free(tecs_region_loader_t* loader);
+TECS_API void tecs_region_loader_request(tecs_region_loader_t* loader, const char* path);
+TECS_API int tecs_region_loader_pending(tecs_region_loader_t* loader);
+TECS_API int tecs_region_loader_sync(tecs_region_loader_t* loader);  /* Returns entities restored */
+
+/* Sharded Worlds
+ * A shard set splits a map into K worlds that tick concurrently on the set's task pool,
+ * each shard on one worker per step. During a tick a shard only touches its own world;
+ * everything that crosses a border is queued by the sending shard and applied by
+ * tecs_shard_set_step() at the frame boundary:
+ * 1. Migrations queued with tecs_shard_migrate() move in bulk, one world map per shard
+ *    pair, in shard order. tecs_shard_remapped() reports new IDs until the next step.
+ * 2. Proxies, local entities standing in for a remote one, follow migrations and copy
+ *    their mirrored components from the remote entity (skipped while its chunk is
+ *    hibernated). Proxies of proxies are not supported.
+ * 3. Messages sent with tecs_shard_send() reach the receiver's callback, by sender in
+ *    shard order. Sends made while delivering go out at the next boundary.
+ * Queues and outboxes belong to their sending shard and outboxes are double-buffered,
+ * so nothing takes a lock. Components must be registered with
+ * tecs_shard_register_component() (same ID in every shard) before they migrate. */
+typedef struct tecs_shard_set_s tecs_shard_set_t;
+typedef void (*tecs_shard_tick_fn)(tecs_shard_set_t* set, int shard, tecs_world_t* world,
+                                   void* user_data);
+typedef void (*tecs_shard_message_fn)(tecs_shard_set_t* set, int shard, int from, uint32_t type,
+                                      const void* data, int size, void* user_data);
+
+/* Component of proxy entities */
+typedef struct {
+    int shard;             /* Shard of the remote entity, -1 once it is gone */
+    tecs_entity_t entity;  /* Remote entity in that shard */
+    tecs_component_id_t components[TECS_SHARD_PROXY_COMPONENTS];  /* Mirrored components */
+    int component_count;
+} tecs_shard_proxy_t;
+
+typedef struct {
+    uint64_t frames;
+    int migrated;        /* Entities moved at the last boundary */
+    int messages;        /* Messages delivered at the last boundary */
+    int proxies;         /* Proxies refreshed at the last boundary */
+    double tick_ms;      /* Last step: concurrent shard ticks */
+    double boundary_ms;  /* Last step: migrations, proxies and delivery */
+} tecs_shard_stats_t;
+
+TECS_API tecs_shard_set_t* tecs_shard_set_new(int shard_count, int thread_count);  /* 0 threads = one per shard */
+TECS_API void tecs_shard_set_free(tecs_shard_set_t* set);
+TECS_API int tecs_shard_count(const tecs_shard_set_t* set);
+TECS_API tecs_world_t* tecs_shard_world(const tecs_shard_set_t* set, int shard);
+TECS_API tecs_component_id_t tecs_shard_register_component(tecs_shard_set_t* set, const char* name, int size);
+TECS_API void tecs_shard_set_systems(tecs_shard_set_t* set, tecs_shard_tick_fn tick,
+                                     tecs_shard_message_fn on_message, void* user_data);
+TECS_API void tecs_shard_set_step(tecs_shard_set_t* set);  /* Ticks every shard, then the boundary */
+TECS_API void tecs_shard_migrate(tecs_shard_set_t* set, int from, tecs_entity_t entity, int to);
+TECS_API tecs_entity_t tecs_shard_remapped(const tecs_shard_set_t* set, int from, tecs_entity_t entity,
+                                           int* to);  /* Moved at the last boundary, else NULL */
+TECS_API void tecs_shard_send(tecs_shard_set_t* set, int from, int to, uint32_t type,
+                              const void* data, int size);
+TECS_API tecs_entity_t tecs_shard_proxy_new(tecs_shard_set_t* set, int shard, int remote_shard,
+                                            tecs_entity_t remote, const tecs_component_id_t* components,
+                                            int component_count);  /* Mirrors start zeroed */
+TECS_API bool tecs_shard_proxy_target(const tecs_shard_set_t* set, int shard, tecs_entity_t proxy,
+                                      int* remote_shard, tecs_entity_t* remote);  /* False once gone */
+TECS_API tecs_component_id_t tecs_shard_proxy_component(const tecs_shard_set_t* set);
+TECS_API tecs_shard_stats_t tecs_shard_set_stats(const tecs_shard_set_t* set);
+
+/* API Tracing
+ * While a trace is open, structural API calls are appended to a compact binary file:
+ * spawns, deletes, set/unset signatures (component only, never data), child ops,
+ * deferred brackets, query definitions, finished iteration passes and frames
+ * (tecs_world_update). Live entities are written first, so a replay starts from the same
+ * archetypes. tools/tecs_replay re-executes a trace against any build and times it.
+ *
+ * File: TECS_TRACE_MAGIC, then records of one opcode byte and LEB128 varints. Components
+ * are referenced by registry index; a REGISTER record announces each index before its
+ * first use. Calls made by the library itself (deferred apply, hierarchy bookkeeping)
+ * are not recorded. */
+#define TECS_TRACE_MAGIC "TECSTRC1"
+
+typedef enum {
+    TECS_TRACE_REGISTER = 1,     /* size, flags (1 = boxed), name length, name bytes */
+    TECS_TRACE_SPAWN,            /* entity */
+    TECS_TRACE_SPAWN_ID,         /* entity (tecs_entity_new_with_id) */
+    TECS_TRACE_DELETE,           /* entity */
+    TECS_TRACE_SET,              /* entity, component */
+    TECS_TRACE_UNSET,            /* entity, component */
+    TECS_TRACE_ADD_CHILD,        /* parent, child */
+    TECS_TRACE_REMOVE_CHILD,     /* parent, child */
+    TECS_TRACE_REMOVE_CHILDREN,  /* parent */
+    TECS_TRACE_DEFER_BEGIN,
+    TECS_TRACE_DEFER_END,
+    TECS_TRACE_QUERY,            /* query, term count, {term type, component}* */
+    TECS_TRACE_ITER,             /* query, chunks, rows */
+    TECS_TRACE_FRAME             /* nanoseconds since the previous frame */
+} tecs_trace_op_t;
+
+TECS_API bool tecs_trace_begin(tecs_world_t* world, const char* path);  /* False if the file cannot be created */
+TECS_API bool tecs_trace_end(tecs_world_t* world);  /* False if a write failed; also run by tecs_world_free */
+TECS_API uint64_t tecs_trace_record_count(const tecs_world_t* world);
 
 /* Helper Macros */
 #define TECS_REGISTER_COMPONENT(world, T) \
@@ -300,11 +826,21 @@ TECS_API int tecs_remove_empty_archetypes(tecs_world_t* world);
 #define TECS_UNSET(world, entity, T) \
     tecs_unset(world, entity, T##_id)
 
-/* Component Declaration & Registration Macros */
+/* Component Declaration & Registration Macros
+ * TECS_DECLARE_COMPONENT gives each translation unit its own ID variable. For components
+ * shared across files, put TECS_COMPONENT_EXTERN in a header and TECS_COMPONENT_DEFINE in
+ * one source file; IDs are name hashes, so one registration serves every world. */
 #define TECS_DECLARE_COMPONENT(Name) \
     typedef struct Name Name; \
     static tecs_component_id_t Name##_id = 0
 
+#define TECS_COMPONENT_EXTERN(Name) \
+    typedef struct Name Name; \
+    extern tecs_component_id_t Name##_id
+
+#define TECS_COMPONENT_DEFINE(Name) \
+    tecs_component_id_t Name##_id = 0
+
 #define TECS_COMPONENT_REGISTER(world, Name) \
     (Name##_id = tecs_register_component(world, #Name, sizeof(Name)))
 
@@ -363,6 +899,7 @@ TECS_API int tecs_remove_empty_archetypes(tecs_world_t* world);
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <stdio.h>
 
 /* Memory allocation wrappers (can be overridden) */
 #ifndef TECS_MALLOC
@@ -381,6 +918,317 @@ TECS_API int tecs_remove_empty_archetypes(tecs_world_t* world);
 #define TECS_FREE(ptr) free(ptr)
 #endif
 
+/* ============================================================================
+ * Threading
+ * ========================================================================= */
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+struct tecs_thread_s { HANDLE handle; tecs_thread_fn fn; void* arg; };
+struct tecs_mutex_s { CRITICAL_SECTION cs; };
+struct tecs_cond_s { CONDITION_VARIABLE cv; };
+
+static DWORD WINAPI tecs_thread_entry(LPVOID param) {
+    tecs_thread_t* thread = (tecs_thread_t*)param;
+    thread->fn(thread->arg);
+    return 0;
+}
+
+tecs_thread_t* tecs_thread_start(tecs_thread_fn fn, void* arg) {
+    tecs_thread_t* thread = TECS_MALLOC(sizeof(tecs_thread_t));
+    thread->fn = fn;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, tecs_thread_entry, thread, 0, NULL);
+    if (!thread->handle) {
+        TECS_FREE(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void tecs_thread_join(tecs_thread_t* thread) {
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    TECS_FREE(thread);
+}
+
+tecs_mutex_t* tecs_mutex_new(void) {
+    tecs_mutex_t* mutex = TECS_MALLOC(sizeof(tecs_mutex_t));
+    InitializeCriticalSection(&mutex->cs);
+    return mutex;
+}
+
+void tecs_mutex_free(tecs_mutex_t* mutex) {
+    DeleteCriticalSection(&mutex->cs);
+    TECS_FREE(mutex);
+}
+
+void tecs_mutex_lock(tecs_mutex_t* mutex) { EnterCriticalSection(&mutex->cs); }
+void tecs_mutex_unlock(tecs_mutex_t* mutex) { LeaveCriticalSection(&mutex->cs); }
+
+tecs_cond_t* tecs_cond_new(void) {
+    tecs_cond_t* cond = TECS_MALLOC(sizeof(tecs_cond_t));
+    InitializeConditionVariable(&cond->cv);
+    return cond;
+}
+
+void tecs_cond_free(tecs_cond_t* cond) { TECS_FREE(cond); }
+void tecs_cond_wait(tecs_cond_t* cond, tecs_mutex_t* mutex) {
+    SleepConditionVariableCS(&cond->cv, &mutex->cs, INFINITE);
+}
+void tecs_cond_signal(tecs_cond_t* cond) { WakeConditionVariable(&cond->cv); }
+void tecs_cond_broadcast(tecs_cond_t* cond) { WakeAllConditionVariable(&cond->cv); }
+
+int tecs_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+
+uint64_t tecs_time_ns(void) {
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+}
+
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/mman.h>
+
+struct tecs_thread_s { pthread_t handle; tecs_thread_fn fn; void* arg; };
+struct tecs_mutex_s { pthread_mutex_t mutex; };
+struct tecs_cond_s { pthread_cond_t cond; };
+
+static void* tecs_thread_entry(void* param) {
+    tecs_thread_t* thread = (tecs_thread_t*)param;
+    thread->fn(thread->arg);
+    return NULL;
+}
+
+tecs_thread_t* tecs_thread_start(tecs_thread_fn fn, void* arg) {
+    tecs_thread_t* thread = TECS_MALLOC(sizeof(tecs_thread_t));
+    thread->fn = fn;
+    thread->arg = arg;
+    if (pthread_create(&thread->handle, NULL, tecs_thread_entry, thread) != 0) {
+        TECS_FREE(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void tecs_thread_join(tecs_thread_t* thread) {
+    pthread_join(thread->handle, NULL);
+    TECS_FREE(thread);
+}
+
+tecs_mutex_t* tecs_mutex_new(void) {
+    tecs_mutex_t* mutex = TECS_MALLOC(sizeof(tecs_mutex_t));
+    pthread_mutex_init(&mutex->mutex, NULL);
+    return mutex;
+}
+
+void tecs_mutex_free(tecs_mutex_t* mutex) {
+    pthread_mutex_destroy(&mutex->mutex);
+    TECS_FREE(mutex);
+}
+
+void tecs_mutex_lock(tecs_mutex_t* mutex) { pthread_mutex_lock(&mutex->mutex); }
+void tecs_mutex_unlock(tecs_mutex_t* mutex) { pthread_mutex_unlock(&mutex->mutex); }
+
+tecs_cond_t* tecs_cond_new(void) {
+    tecs_cond_t* cond = TECS_MALLOC(sizeof(tecs_cond_t));
+    pthread_cond_init(&cond->cond, NULL);
+    return cond;
+}
+
+void tecs_cond_free(tecs_cond_t* cond) {
+    pthread_cond_destroy(&cond->cond);
+    TECS_FREE(cond);
+}
+
+void tecs_cond_wait(tecs_cond_t* cond, tecs_mutex_t* mutex) {
+    pthread_cond_wait(&cond->cond, &mutex->mutex);
+}
+void tecs_cond_signal(tecs_cond_t* cond) { pthread_cond_signal(&cond->cond); }
+void tecs_cond_broadcast(tecs_cond_t* cond) { pthread_cond_broadcast(&cond->cond); }
+
+int tecs_cpu_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+/* CLOCK_MONOTONIC needs a POSIX feature macro under strict -std=c99 (the Makefile
+ * passes -D_DEFAULT_SOURCE); without one the fallback is gettimeofday(), which
+ * jumps when the wall clock is adjusted */
+uint64_t tecs_time_ns(void) {
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000000000ULL + (uint64_t)tv.tv_usec * 1000ULL;
+#endif
+}
+#endif
+
+/* Sequentially consistent 32-bit atomics */
+#if defined(_MSC_VER)
+static int32_t tecs_atomic_load(volatile int32_t* ptr) { return (int32_t)_InterlockedOr((volatile long*)ptr, 0); }
+static void tecs_atomic_store(volatile int32_t* ptr, int32_t value) { _InterlockedExchange((volatile long*)ptr, value); }
+static int32_t tecs_atomic_add(volatile int32_t* ptr, int32_t delta) { return (int32_t)_InterlockedExchangeAdd((volatile long*)ptr, delta) + delta; }
+#else
+static int32_t tecs_atomic_load(volatile int32_t* ptr) { return __atomic_load_n(ptr, __ATOMIC_SEQ_CST); }
+static void tecs_atomic_store(volatile int32_t* ptr, int32_t value) { __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST); }
+static int32_t tecs_atomic_add(volatile int32_t* ptr, int32_t delta) { return __atomic_add_fetch(ptr, delta, __ATOMIC_SEQ_CST); }
+#endif
+
+/* Software prefetch hint into all cache levels; never faults */
+#if defined(__GNUC__) || defined(__clang__)
+#define TECS_PREFETCH(addr) __builtin_prefetch((const void*)(addr), 0, 3)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define TECS_PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+#define TECS_PREFETCH(addr) ((void)(addr))
+#endif
+
+/* ============================================================================
+ * Task Pool
+ * ========================================================================= */
+
+typedef struct {
+    tecs_task_pool_t* pool;
+    int worker;
+} tecs_task_worker_t;
+
+struct tecs_task_pool_s {
+    tecs_thread_t** threads;
+    tecs_task_worker_t* workers;
+    int thread_count;  /* Background threads; the caller is worker 0 */
+
+    tecs_mutex_t* mutex;
+    tecs_cond_t* wake;
+    tecs_cond_t* done;
+    uint32_t generation;
+    int active;  /* Background threads still inside the current job */
+    bool stopping;
+
+    /* Current job */
+    tecs_task_fn fn;
+    void* arg;
+    int count;
+    volatile int32_t next;
+};
+
+static void tecs_task_pool_drain(tecs_task_pool_t* pool, int worker) {
+    for (;;) {
+        int index = tecs_atomic_add(&pool->next, 1) - 1;
+        if (index >= pool->count) break;
+        pool->fn(pool->arg, index, worker);
+    }
+}
+
+static void tecs_task_pool_thread(void* param) {
+    tecs_task_worker_t* worker = (tecs_task_worker_t*)param;
+    tecs_task_pool_t* pool = worker->pool;
+    uint32_t seen = 0;
+
+    tecs_mutex_lock(pool->mutex);
+    for (;;) {
+        while (!pool->stopping && pool->generation == seen) {
+            tecs_cond_wait(pool->wake, pool->mutex);
+        }
+        if (pool->stopping) break;
+        seen = pool->generation;
+
+        tecs_mutex_unlock(pool->mutex);
+        tecs_task_pool_drain(pool, worker->worker);
+        tecs_mutex_lock(pool->mutex);
+
+        if (--pool->active == 0) tecs_cond_signal(pool->done);
+    }
+    tecs_mutex_unlock(pool->mutex);
+}
+
+tecs_task_pool_t* tecs_task_pool_new(int worker_count) {
+    if (worker_count <= 0) worker_count = tecs_cpu_count();
+
+    tecs_task_pool_t* pool = TECS_CALLOC(1, sizeof(tecs_task_pool_t));
+    pool->mutex = tecs_mutex_new();
+    pool->wake = tecs_cond_new();
+    pool->done = tecs_cond_new();
+    pool->threads = TECS_CALLOC(worker_count, sizeof(tecs_thread_t*));
+    pool->workers = TECS_CALLOC(worker_count, sizeof(tecs_task_worker_t));
+
+    for (int i = 1; i < worker_count; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].worker = i;
+        pool->threads[pool->thread_count] = tecs_thread_start(tecs_task_pool_thread, &pool->workers[i]);
+        if (!pool->threads[pool->thread_count]) break;
+        pool->thread_count++;
+    }
+    return pool;
+}
+
+void tecs_task_pool_free(tecs_task_pool_t* pool) {
+    if (!pool) return;
+
+    tecs_mutex_lock(pool->mutex);
+    pool->stopping = true;
+    tecs_cond_broadcast(pool->wake);
+    tecs_mutex_unlock(pool->mutex);
+
+    for (int i = 0; i < pool->thread_count; i++) tecs_thread_join(pool->threads[i]);
+
+    tecs_cond_free(pool->done);
+    tecs_cond_free(pool->wake);
+    tecs_mutex_free(pool->mutex);
+    TECS_FREE(pool->workers);
+    TECS_FREE(pool->threads);
+    TECS_FREE(pool);
+}
+
+int tecs_task_pool_size(const tecs_task_pool_t* pool) {
+    return pool->thread_count + 1;
+}
+
+void tecs_task_pool_run(tecs_task_pool_t* pool, int count, tecs_task_fn fn, void* arg) {
+    if (count <= 0) return;
+
+    /* Not worth waking anyone */
+    if (pool->thread_count == 0 || count == 1) {
+        for (int i = 0; i < count; i++) fn(arg, i, 0);
+        return;
+    }
+
+    tecs_mutex_lock(pool->mutex);
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->count = count;
+    tecs_atomic_store(&pool->next, 0);
+    pool->active = pool->thread_count;
+    pool->generation++;
+    tecs_cond_broadcast(pool->wake);
+    tecs_mutex_unlock(pool->mutex);
+
+    tecs_task_pool_drain(pool, 0);
+
+    tecs_mutex_lock(pool->mutex);
+    while (pool->active > 0) tecs_cond_wait(pool->done, pool->mutex);
+    tecs_mutex_unlock(pool->mutex);
+}
+
 /* ============================================================================
  * Default Native Storage Provider
  * ========================================================================= */
@@ -433,22 +1281,13 @@ static void tecs_native_swap_data(void* user_data, void* chunk_data,
     void* ptr_a = tecs_native_get_ptr(user_data, chunk_data, idx_a, size);
     void* ptr_b = tecs_native_get_ptr(user_data, chunk_data, idx_b, size);
     
-    /* Swap using temporary buffer on stack (assuming reasonable component sizes) */
+    /* Swap through a stack buffer, 256 bytes at a time */
     char temp[256];
-    char* heap_temp = NULL;
-    void* swap_temp = temp;
-    
-    if (size > 256) {
-        heap_temp = TECS_MALLOC(size);
-        swap_temp = heap_temp;
-    }
-    
-    memcpy(swap_temp, ptr_a, size);
-    memcpy(ptr_a, ptr_b, size);
-    memcpy(ptr_b, swap_temp, size);
-    
-    if (heap_temp) {
-        TECS_FREE(heap_temp);
+    for (int offset = 0; offset < size; offset += (int)sizeof(temp)) {
+        int n = size - offset < (int)sizeof(temp) ? size - offset : (int)sizeof(temp);
+        memcpy(temp, (char*)ptr_a + offset, n);
+        memcpy((char*)ptr_a + offset, (char*)ptr_b + offset, n);
+        memcpy((char*)ptr_b + offset, temp, n);
     }
 }
 
@@ -467,6 +1306,135 @@ tecs_storage_provider_t* tecs_get_default_storage_provider(void) {
     return &tecs_default_storage;
 }
 
+/* ============================================================================
+ * Boxed Storage Provider
+ * ========================================================================= */
+
+/* Values live in slab pages; the column is an array of row pointers. copy_data exchanges
+ * the two rows' pointers: the core only copies through a provider when the source row dies
+ * right after (archetype moves, swap-removes), so the dead row's slot stays with the chunk
+ * and is reused by the next row written there. Slots go back to the slab when their chunk
+ * is freed. */
+#define TECS_BOX_PAGE_BYTES (64 * 1024)
+
+typedef struct tecs_box_slot_s {
+    struct tecs_box_slot_s* next;
+} tecs_box_slot_t;
+
+typedef struct {
+    tecs_storage_provider_t provider;  /* First member: chunks point here */
+    int slot_size;
+    int slots_per_page;
+    char** pages;
+    int page_count;
+    int page_capacity;
+    int page_used;                     /* Slots carved from the newest page */
+    tecs_box_slot_t* free_list;
+    tecs_mutex_t* mutex;               /* Commands may be applied on several threads */
+} tecs_box_storage_t;
+
+static void* tecs_box_slot_new(tecs_box_storage_t* box) {
+    tecs_mutex_lock(box->mutex);
+    void* slot = box->free_list;
+    if (slot) {
+        box->free_list = box->free_list->next;
+    } else {
+        if (box->page_count == 0 || box->page_used == box->slots_per_page) {
+            if (box->page_count == box->page_capacity) {
+                box->page_capacity = box->page_capacity ? box->page_capacity * 2 : 8;
+                box->pages = TECS_REALLOC(box->pages, box->page_capacity * sizeof(char*));
+            }
+            box->pages[box->page_count++] = TECS_MALLOC((size_t)box->slot_size * box->slots_per_page);
+            box->page_used = 0;
+        }
+        slot = box->pages[box->page_count - 1] + (size_t)box->page_used++ * box->slot_size;
+    }
+    tecs_mutex_unlock(box->mutex);
+    memset(slot, 0, box->slot_size);
+    return slot;
+}
+
+static void* tecs_box_alloc_chunk(void* user_data, int component_size, int capacity) {
+    (void)user_data; (void)component_size;
+    /* Capacity sits in front of the row pointers for free_chunk */
+    void** block = TECS_CALLOC((size_t)capacity + 1, sizeof(void*));
+    block[0] = (void*)(intptr_t)capacity;
+    return block + 1;
+}
+
+static void tecs_box_free_chunk(void* user_data, void* chunk_data) {
+    if (!chunk_data) return;
+    tecs_box_storage_t* box = (tecs_box_storage_t*)user_data;
+    void** rows = (void**)chunk_data;
+    int capacity = (int)(intptr_t)rows[-1];
+
+    tecs_mutex_lock(box->mutex);
+    for (int i = 0; i < capacity; i++) {
+        if (!rows[i]) continue;
+        tecs_box_slot_t* slot = (tecs_box_slot_t*)rows[i];
+        slot->next = box->free_list;
+        box->free_list = slot;
+    }
+    tecs_mutex_unlock(box->mutex);
+    TECS_FREE(rows - 1);
+}
+
+static void* tecs_box_get_ptr(void* user_data, void* chunk_data, int index, int size) {
+    (void)size;
+    void** rows = (void**)chunk_data;
+    if (!rows[index]) rows[index] = tecs_box_slot_new((tecs_box_storage_t*)user_data);
+    return rows[index];
+}
+
+static void tecs_box_set_data(void* user_data, void* chunk_data, int index,
+                              const void* data, int size) {
+    memcpy(tecs_box_get_ptr(user_data, chunk_data, index, size), data, size);
+}
+
+static void tecs_box_copy_data(void* user_data, void* src_chunk, int src_idx,
+                               void* dst_chunk, int dst_idx, int size) {
+    (void)user_data; (void)size;
+    void** src = (void**)src_chunk;
+    void** dst = (void**)dst_chunk;
+    void* slot = dst[dst_idx];
+    dst[dst_idx] = src[src_idx];
+    src[src_idx] = slot;
+}
+
+static void tecs_box_swap_data(void* user_data, void* chunk_data, int idx_a, int idx_b, int size) {
+    tecs_box_copy_data(user_data, chunk_data, idx_a, chunk_data, idx_b, size);
+}
+
+static bool tecs_storage_is_boxed(const tecs_storage_provider_t* provider) {
+    return provider && provider->alloc_chunk == tecs_box_alloc_chunk;
+}
+
+static tecs_box_storage_t* tecs_box_storage_new(int size) {
+    tecs_box_storage_t* box = TECS_CALLOC(1, sizeof(tecs_box_storage_t));
+    box->provider.alloc_chunk = tecs_box_alloc_chunk;
+    box->provider.free_chunk = tecs_box_free_chunk;
+    box->provider.get_ptr = tecs_box_get_ptr;
+    box->provider.set_data = tecs_box_set_data;
+    box->provider.copy_data = tecs_box_copy_data;
+    box->provider.swap_data = tecs_box_swap_data;
+    box->provider.user_data = box;
+    box->provider.name = "boxed";
+
+    /* 16-byte aligned slots, at least 16 per page */
+    box->slot_size = (size + 15) & ~15;
+    box->slots_per_page = TECS_BOX_PAGE_BYTES / box->slot_size;
+    if (box->slots_per_page < 16) box->slots_per_page = 16;
+    box->mutex = tecs_mutex_new();
+    return box;
+}
+
+static void tecs_box_storage_free(tecs_box_storage_t* box) {
+    for (int i = 0; i < box->page_count; i++) TECS_FREE(box->pages[i]);
+    TECS_FREE(box->pages);
+    tecs_mutex_free(box->mutex);
+    TECS_FREE(box);
+}
+
 /* ============================================================================
  * Internal Data Structures
  * ========================================================================= */
@@ -478,20 +1446,40 @@ typedef struct {
     bool is_native_storage;         /* Fast path optimization flag */
     tecs_tick_t* changed_ticks;     /* Per-entity change ticks */
     tecs_tick_t* added_ticks;       /* Per-entity added ticks */
+    tecs_tick_t changed_max;        /* Newest tick ever stored in changed_ticks */
+    uint64_t hash;                  /* Cached hash of the column's used rows */
+    uint32_t hash_version;          /* Chunk version the hash was taken at, 0 = none */
+    tecs_tick_t hash_tick;          /* World tick the hash was taken at */
 } tecs_column_t;
 
+#define TECS_TICK_MAX(max, tick) do { if ((tick) > (max)) (max) = (tick); } while (0)
+
 /* Archetype chunk: stores up to TECS_CHUNK_SIZE entities */
 typedef struct {
     tecs_entity_t entities[TECS_CHUNK_SIZE];  /* Entity IDs */
     tecs_column_t* columns;                    /* One column per component */
     int count;                                 /* Active entity count */
     int capacity;                              /* Always TECS_CHUNK_SIZE */
+    tecs_tick_t last_access;                   /* World tick of the last read or write */
+    uint32_t version;                          /* Bumped whenever rows are added or removed */
+    uint32_t entity_hash_version;              /* Version of `entity_hash`, 0 = none */
+    uint64_t entity_hash;                      /* Cached hash of the entity IDs */
+    unsigned char* hibernated;                 /* Compressed columns, NULL while resident */
+    uint32_t hibernated_size;                  /* Bytes in `hibernated` */
+    uint32_t hibernated_raw_size;              /* Bytes after decompression */
+    struct tecs_snapshot_chunk_s* snapshot;    /* Last published copy, NULL if none */
+    uint32_t snapshot_version;                 /* Chunk version of `snapshot` */
+    tecs_tick_t snapshot_tick;                 /* First tick whose writes `snapshot` may miss */
+    uint32_t released_version;                 /* Version whose free rows were returned to the OS */
 } tecs_chunk_t;
 
-/* Archetype graph edge for fast component add/remove transitions */
+/* Archetype graph edge for fast component add/remove transitions, stored in the
+ * world's edge table */
 typedef struct {
+    tecs_archetype_t* source;  /* NULL = free slot */
     tecs_component_id_t component_id;
     tecs_archetype_t* target;
+    bool is_add;
 } tecs_archetype_edge_t;
 
 /* Simple hash map entry for component lookups */
@@ -507,24 +1495,15 @@ typedef struct {
     int capacity;
 } tecs_component_map_t;
 
-/* Simple hash map for O(1) edge lookups */
-typedef struct {
-    tecs_component_id_t key;
-    tecs_archetype_t* value;
-    bool occupied;
-} tecs_edge_map_entry_t;
-
-typedef struct {
-    tecs_edge_map_entry_t* entries;
-    int capacity;
-} tecs_edge_map_t;
-
-/* Archetype: collection of entities with identical component sets */
+/* Archetype: collection of entities with identical component sets. The struct and
+ * its component arrays share one allocation; graph edges live in the world. */
 struct tecs_archetype_s {
     uint64_t id;                              /* Hash of component set */
-    tecs_component_info_t* components;        /* All components (data + tags) */
+    tecs_component_info_t* components;        /* All components (data + tags), sorted by ID */
+    tecs_component_id_t* component_ids;       /* IDs of `components`, searched on lookups */
     int component_count;
-    tecs_component_info_t* data_components;   /* Only data components (size > 0) */
+    tecs_component_info_t* data_components;   /* Only data components (size > 0), sorted by ID */
+    tecs_component_id_t* data_component_ids;  /* IDs of `data_components`: position = column index */
     int data_component_count;
     tecs_component_info_t* tags;              /* Only tags (size == 0) */
     int tag_count;
@@ -534,26 +1513,18 @@ struct tecs_archetype_s {
     int chunk_capacity;
     int entity_count;                         /* Total entities across all chunks */
 
-    tecs_archetype_edge_t* add_edges;         /* Edges for adding components */
-    int add_edge_count;
-    int add_edge_capacity;
-
-    tecs_archetype_edge_t* remove_edges;      /* Edges for removing components */
-    int remove_edge_count;
-    int remove_edge_capacity;
-
-    /* Hash maps for O(1) lookups */
-    tecs_component_map_t component_map;       /* component_id -> index in components array */
-    tecs_component_map_t data_component_map;  /* component_id -> column index (data components only) */
-    tecs_edge_map_t add_edge_map;             /* component_id -> target archetype */
-    tecs_edge_map_t remove_edge_map;          /* component_id -> target archetype */
+    tecs_tick_t created_tick;                 /* GC age of archetypes that never held chunks */
+    tecs_type_hooks_t* hooks;                 /* Per data column, NULL when no column has hooks */
+    bool gc_marked;                           /* Being collected by tecs_world_gc_archetypes */
+    int defer_node;                           /* Scratch slot while planning a parallel deferred apply */
 };
 
 /* Entity record: maps entity ID to archetype location */
 typedef struct {
+    tecs_entity_t entity;  /* Owning entity ID (index + generation) */
     tecs_archetype_t* archetype;
     int chunk_index;
-    int row;  /* Global row index across all chunks */
+    int row;  /* Row index within the chunk */
 } tecs_entity_record_t;
 
 /* Sparse set for entity storage with O(1) lookup */
@@ -568,6 +1539,9 @@ typedef struct {
     int recycled_capacity;
     uint16_t* generations;   /* Generation counter per entity index */
     size_t generation_capacity;
+    uint32_t next_index;     /* Next never-used index for automatic allocation */
+    uint32_t reserved_begin; /* Index range [begin, end) owned by explicit IDs */
+    uint32_t reserved_end;
 } tecs_entity_sparse_set_t;
 
 /* Deferred command types */
@@ -584,20 +1558,25 @@ typedef struct {
     tecs_component_id_t component_id;
     void* data;
     int size;
+    bool move;  /* data holds a live value for tecs_set_move */
 } tecs_command_t;
 
 /* Component registry entry */
 typedef struct {
     tecs_component_id_t id;
-    char name[64];
+    char* name;                                 /* Full name, owned by the registry */
     int size;
     tecs_storage_provider_t* storage_provider;  /* NULL = use default native storage */
+    tecs_type_hooks_t hooks;                    /* All NULL = plain bytes */
+    tecs_field_t* fields;                       /* Reflection, names stored after the array */
+    int field_count;
 } tecs_component_registry_entry_t;
 
 /* Archetype hash table entry */
 typedef struct {
     uint64_t hash;
     tecs_archetype_t* archetype;
+    bool deleted;  /* Tombstone: keeps probe chains intact after a removal */
 } tecs_archetype_table_entry_t;
 
 /* World: main ECS container */
@@ -608,20 +1587,51 @@ struct tecs_world_s {
     tecs_archetype_table_entry_t* archetype_table;
     int archetype_table_size;
     int archetype_table_capacity;
+    int archetype_table_tombstones;
+
+    /* Live queries, so archetype removal can unlink itself from their matches */
+    tecs_query_t** queries;
+    int query_count;
+    int query_capacity;
 
     tecs_component_registry_entry_t* component_registry;
     int component_count;
     int component_capacity;
     tecs_component_map_t component_registry_map;  /* component_id -> registry index for O(1) lookup */
 
+    /* Slabs of boxed components, freed with the world */
+    tecs_box_storage_t** boxes;
+    int box_count;
+    int box_capacity;
+
     tecs_tick_t tick;
     uint64_t structural_change_version;
 
+    /* Chunk hibernation totals */
+    tecs_hibernation_stats_t hibernation;
+
+    /* Published snapshots; pins and current slot are shared with reader threads */
+    tecs_component_id_t* snapshot_components;
+    int snapshot_component_count;
+    int snapshot_component_capacity;
+    tecs_snapshot_t* snapshot_slots[TECS_SNAPSHOT_SLOTS];
+    volatile int32_t snapshot_pins[TECS_SNAPSHOT_SLOTS];
+    volatile int32_t snapshot_current;  /* Slot index, -1 before the first publish */
+
     /* Deferred command buffer */
     tecs_command_t* command_buffer;
     int command_count;
     int command_capacity;
     bool in_deferred;
+    tecs_task_pool_t* deferred_pool;  /* Not owned */
+
+    /* Next archetype table slot for tecs_world_shrink */
+    int shrink_cursor;
+
+    /* Archetype graph: (source, component, direction) -> target, open addressing */
+    tecs_archetype_edge_t* edges;
+    int edge_count;
+    int edge_capacity;
 
     /* Hierarchy: entity children storage (maps entity_id -> tecs_children_t*) */
     struct {
@@ -634,6 +1644,8 @@ struct tecs_world_s {
     /* Hierarchy component IDs */
     tecs_component_id_t parent_component_id;
     tecs_component_id_t children_component_id;
+
+    struct tecs_trace_s* trace;  /* Open API trace, NULL when not recording */
 };
 
 /* Query iterator (defined before query for embedding) */
@@ -643,6 +1655,14 @@ struct tecs_query_iter_s {
     int chunk_index;
     tecs_chunk_t* current_chunk;
     tecs_archetype_t* current_archetype;
+
+    /* Row range within current_chunk; row_end < 0 means up to the chunk's count */
+    int row_start;
+    int row_end;
+
+    /* Resumable iteration */
+    tecs_query_cursor_t* cursor;
+    int rows_left;  /* -1 = unlimited */
 };
 
 /* Query structure */
@@ -657,6 +1677,10 @@ struct tecs_query_s {
 
     uint64_t last_structural_version;
     bool built;
+    bool skip_hibernated;  /* Leave hibernated chunks compressed and out of iteration */
+    int prefetch_distance; /* Chunks tecs_iter_next prefetches ahead, 0 = off */
+    uint32_t trace_id;     /* Query number in the world's trace, 0 = not written yet */
+    int trace_terms;       /* Term count when it was written */
 
     /* Cached iterator for zero-allocation iteration */
     tecs_query_iter_t cached_iter;
@@ -666,6 +1690,40 @@ struct tecs_query_s {
  * Hashing and Utilities
  * ========================================================================= */
 
+/* 64-bit finalizer (murmur3 fmix64) */
+static uint64_t tecs_hash_u64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/* Fast 64-bit hash of a byte range, 8 bytes per step */
+static uint64_t tecs_hash_bytes(const void* data, size_t length, uint64_t seed) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t hash = seed ^ (length * 0x9E3779B97F4A7C15ULL);
+
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        hash ^= tecs_hash_u64(word);
+        hash = ((hash << 27) | (hash >> 37)) * 0x9E3779B97F4A7C15ULL + 0x165667B19E3779F9ULL;
+        p += 8;
+        length -= 8;
+    }
+
+    uint64_t tail = 0;
+    memcpy(&tail, p, length);
+    hash ^= tecs_hash_u64(tail ^ ((uint64_t)length << 56));
+    return tecs_hash_u64(hash);
+}
+
+static uint64_t tecs_hash_combine(uint64_t hash, uint64_t value) {
+    return tecs_hash_u64(hash ^ (value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2)));
+}
+
 /* FNV-1a hash for component ID arrays (unordered set hash) */
 static uint64_t tecs_hash_component_set(const tecs_component_id_t* ids, int count) {
     uint64_t hash = 14695981039346656037ULL;
@@ -719,6 +1777,9 @@ static void tecs_sparse_set_init(tecs_entity_sparse_set_t* set) {
     set->recycled_capacity = 64;
     set->generations = TECS_CALLOC(1024, sizeof(uint16_t));
     set->generation_capacity = 1024;
+    set->next_index = 1;  /* Index 0 generation 0 is TECS_ENTITY_NULL */
+    set->reserved_begin = 0;
+    set->reserved_end = 0;
 }
 
 static void tecs_sparse_set_free(tecs_entity_sparse_set_t* set) {
@@ -748,19 +1809,20 @@ static void tecs_sparse_set_ensure_capacity(tecs_entity_sparse_set_t* set, uint3
     }
 }
 
-static tecs_entity_t tecs_sparse_set_create(tecs_entity_sparse_set_t* set) {
-    uint32_t index;
-    uint16_t generation;
+static bool tecs_sparse_set_is_reserved(const tecs_entity_sparse_set_t* set, uint32_t index) {
+    return index >= set->reserved_begin && index < set->reserved_end;
+}
 
-    /* Try to reuse recycled entity */
-    if (set->recycled_count > 0) {
-        index = set->recycled[--set->recycled_count];
-        generation = ++set->generations[index];
-    } else {
-        index = set->dense_count;
-        generation = 0;
-    }
+/* O(1) check whether any generation of this index is currently alive */
+static bool tecs_sparse_set_index_alive(const tecs_entity_sparse_set_t* set, uint32_t index) {
+    if (index >= set->sparse_capacity) return false;
+    uint32_t dense_index = set->sparse[index];
+    if (dense_index >= (uint32_t)set->dense_count) return false;
+    return TECS_ENTITY_INDEX(set->dense[dense_index].entity) == index;
+}
 
+static tecs_entity_t tecs_sparse_set_insert(tecs_entity_sparse_set_t* set,
+                                            uint32_t index, uint16_t generation) {
     tecs_sparse_set_ensure_capacity(set, index);
 
     /* Expand dense array if needed */
@@ -769,45 +1831,79 @@ static tecs_entity_t tecs_sparse_set_create(tecs_entity_sparse_set_t* set) {
         set->dense = TECS_REALLOC(set->dense, set->dense_capacity * sizeof(tecs_entity_record_t));
     }
 
+    tecs_entity_t entity = TECS_ENTITY_MAKE(index, generation);
+    set->generations[index] = generation;
     set->sparse[index] = set->dense_count;
+    set->dense[set->dense_count].entity = entity;
     set->dense[set->dense_count].archetype = NULL;
     set->dense[set->dense_count].chunk_index = -1;
     set->dense[set->dense_count].row = -1;
     set->dense_count++;
 
-    return TECS_ENTITY_MAKE(index, generation);
+    return entity;
+}
+
+static tecs_entity_t tecs_sparse_set_create(tecs_entity_sparse_set_t* set) {
+    /* Try to reuse recycled entity. Entries may have been claimed by an explicit
+     * ID or fallen into a reserved range since they were pushed; skip those. */
+    while (set->recycled_count > 0) {
+        uint32_t index = set->recycled[--set->recycled_count];
+        if (tecs_sparse_set_is_reserved(set, index) || tecs_sparse_set_index_alive(set, index))
+            continue;
+        return tecs_sparse_set_insert(set, index, set->generations[index]);
+    }
+
+    /* Fresh index: skip the reserved range and indices claimed by explicit IDs */
+    uint32_t index;
+    for (;;) {
+        index = set->next_index++;
+        if (tecs_sparse_set_is_reserved(set, index)) {
+            set->next_index = set->reserved_end;
+            continue;
+        }
+        if (!tecs_sparse_set_index_alive(set, index)) break;
+    }
+
+    tecs_sparse_set_ensure_capacity(set, index);
+    return tecs_sparse_set_insert(set, index, set->generations[index]);
 }
 
 static tecs_entity_record_t* tecs_sparse_set_get(const tecs_entity_sparse_set_t* set,
                                                    tecs_entity_t entity) {
     uint32_t index = TECS_ENTITY_INDEX(entity);
-    uint16_t generation = TECS_ENTITY_GENERATION(entity);
 
     if (index >= set->sparse_capacity) return NULL;
-    if (set->generations[index] != generation) return NULL;
 
     uint32_t dense_index = set->sparse[index];
     if (dense_index >= (uint32_t)set->dense_count) return NULL;
 
+    /* Full ID compare rejects stale generations and unused sparse slots */
+    if (set->dense[dense_index].entity != entity) return NULL;
+
     return &set->dense[dense_index];
 }
 
 static void tecs_sparse_set_remove(tecs_entity_sparse_set_t* set, tecs_entity_t entity) {
-    uint32_t index = TECS_ENTITY_INDEX(entity);
-    if (index >= set->sparse_capacity) return;
+    if (!tecs_sparse_set_get(set, entity)) return;
 
+    uint32_t index = TECS_ENTITY_INDEX(entity);
     uint32_t dense_index = set->sparse[index];
-    if (dense_index >= (uint32_t)set->dense_count) return;
 
     /* Swap with last element in dense array */
-    if (dense_index < (uint32_t)(set->dense_count - 1)) {
-        set->dense[dense_index] = set->dense[set->dense_count - 1];
-        /* Update sparse index for swapped entity */
-        /* Note: We'd need to track entity IDs in dense array to do this properly */
+    uint32_t last = (uint32_t)(set->dense_count - 1);
+    if (dense_index < last) {
+        set->dense[dense_index] = set->dense[last];
+        set->sparse[TECS_ENTITY_INDEX(set->dense[dense_index].entity)] = dense_index;
     }
     set->dense_count--;
 
-    /* Add to recycle list */
+    /* Invalidate outstanding handles */
+    set->generations[index]++;
+
+    /* Reserved indices belong to their remote owner and indices beyond next_index
+     * will be reached by the allocator anyway; neither goes on the recycle list. */
+    if (tecs_sparse_set_is_reserved(set, index) || index >= set->next_index) return;
+
     if (set->recycled_count >= set->recycled_capacity) {
         set->recycled_capacity *= 2;
         set->recycled = TECS_REALLOC(set->recycled, set->recycled_capacity * sizeof(uint32_t));
@@ -863,85 +1959,64 @@ static void tecs_component_map_set(tecs_component_map_t* map,
 }
 
 /* ============================================================================
- * Edge Hash Map Implementation
+ * Archetype Management
  * ========================================================================= */
 
-static void tecs_edge_map_init(tecs_edge_map_t* map, int capacity) {
-    map->capacity = capacity;
-    map->entries = TECS_CALLOC(capacity, sizeof(tecs_edge_map_entry_t));
-}
-
-static void tecs_edge_map_free(tecs_edge_map_t* map) {
-    TECS_FREE(map->entries);
-    map->entries = NULL;
-    map->capacity = 0;
+/* Index of `id` in an ascending ID array, -1 if absent. Archetypes rarely have
+ * more than a handful of components, so the search ends in a short linear scan. */
+static int tecs_sorted_ids_find(const tecs_component_id_t* ids, int count, tecs_component_id_t id) {
+    int low = 0;
+    int high = count;
+    while (high - low > 8) {
+        int mid = low + (high - low) / 2;
+        if (ids[mid] > id) high = mid;
+        else low = mid;
+    }
+    for (int i = low; i < high; i++) {
+        if (ids[i] >= id) return ids[i] == id ? i : -1;
+    }
+    return -1;
 }
 
-static tecs_archetype_t* tecs_edge_map_get(const tecs_edge_map_t* map,
-                                            tecs_component_id_t component_id) {
-    if (map->capacity == 0) return NULL;
+static tecs_archetype_t* tecs_archetype_new(const tecs_component_info_t* components,
+                                             int component_count) {
+    int data_count = 0;
+    for (int i = 0; i < component_count; i++) {
+        if (components[i].size > 0) data_count++;
+    }
+    int tag_count = component_count - data_count;
+
+    /* One block: struct, components, data components, tags, then the ID arrays */
+    size_t header = (sizeof(tecs_archetype_t) + 7) & ~(size_t)7;
+    size_t infos = (size_t)(component_count + data_count + tag_count) * sizeof(tecs_component_info_t);
+    size_t ids = (size_t)(component_count + data_count) * sizeof(tecs_component_id_t);
+    unsigned char* block = TECS_CALLOC(1, header + infos + ids);
+
+    tecs_archetype_t* arch = (tecs_archetype_t*)block;
+    arch->components = (tecs_component_info_t*)(block + header);
+    arch->data_components = arch->components + component_count;
+    arch->tags = arch->data_components + data_count;
+    arch->component_ids = (tecs_component_id_t*)(arch->tags + tag_count);
+    arch->data_component_ids = arch->component_ids + component_count;
+    arch->component_count = component_count;
+    arch->data_component_count = data_count;
+    arch->tag_count = tag_count;
 
-    size_t index = component_id % map->capacity;
-    size_t start = index;
-
-    do {
-        if (!map->entries[index].occupied)
-            return NULL;
-        if (map->entries[index].key == component_id)
-            return map->entries[index].value;
-        index = (index + 1) % map->capacity;
-    } while (index != start);
-
-    return NULL;
-}
-
-static void tecs_edge_map_set(tecs_edge_map_t* map,
-                               tecs_component_id_t component_id,
-                               tecs_archetype_t* target) {
-    if (map->capacity == 0) return;
-
-    size_t index = component_id % map->capacity;
-
-    while (map->entries[index].occupied && map->entries[index].key != component_id)
-        index = (index + 1) % map->capacity;
-
-    map->entries[index].key = component_id;
-    map->entries[index].value = target;
-    map->entries[index].occupied = true;
-}
-
-/* ============================================================================
- * Archetype Management
- * ========================================================================= */
-
-static tecs_archetype_t* tecs_archetype_new(const tecs_component_info_t* components,
-                                             int component_count) {
-    tecs_archetype_t* arch = TECS_CALLOC(1, sizeof(tecs_archetype_t));
-
-    arch->component_count = component_count;
-    arch->components = TECS_MALLOC(component_count * sizeof(tecs_component_info_t));
-    memcpy(arch->components, components, component_count * sizeof(tecs_component_info_t));
-
-    /* Sort components by ID */
-    qsort(arch->components, component_count, sizeof(tecs_component_info_t),
-          tecs_compare_component_info);
+    /* Sort components by ID */
+    if (component_count > 0) {
+        memcpy(arch->components, components, component_count * sizeof(tecs_component_info_t));
+        qsort(arch->components, component_count, sizeof(tecs_component_info_t),
+              tecs_compare_component_info);
+    }
 
     /* Separate data components and tags */
-    arch->data_component_count = 0;
-    arch->tag_count = 0;
-    for (int i = 0; i < component_count; i++) {
-        if (components[i].size > 0) arch->data_component_count++;
-        else arch->tag_count++;
-    }
-
-    arch->data_components = TECS_MALLOC(arch->data_component_count * sizeof(tecs_component_info_t));
-    arch->tags = TECS_MALLOC(arch->tag_count * sizeof(tecs_component_info_t));
-
     int data_idx = 0, tag_idx = 0;
     for (int i = 0; i < component_count; i++) {
+        arch->component_ids[i] = arch->components[i].id;
         if (arch->components[i].size > 0) {
             arch->data_components[data_idx] = arch->components[i];
             arch->data_components[data_idx].column_index = data_idx;
+            arch->data_component_ids[data_idx] = arch->components[i].id;
             data_idx++;
         } else {
             arch->tags[tag_idx++] = arch->components[i];
@@ -949,12 +2024,7 @@ static tecs_archetype_t* tecs_archetype_new(const tecs_component_info_t* compone
     }
 
     /* Compute archetype hash */
-    tecs_component_id_t* ids = TECS_MALLOC(component_count * sizeof(tecs_component_id_t));
-    for (int i = 0; i < component_count; i++) {
-        ids[i] = components[i].id;
-    }
-    arch->id = tecs_hash_component_set(ids, component_count);
-    TECS_FREE(ids);
+    arch->id = tecs_hash_component_set(arch->component_ids, component_count);
 
     /* Initialize chunk storage */
     arch->chunk_capacity = TECS_INITIAL_CHUNKS;
@@ -962,44 +2032,173 @@ static tecs_archetype_t* tecs_archetype_new(const tecs_component_info_t* compone
     arch->chunk_count = 0;
     arch->entity_count = 0;
 
-    /* Initialize graph edges */
-    arch->add_edge_capacity = 8;
-    arch->add_edges = TECS_MALLOC(arch->add_edge_capacity * sizeof(tecs_archetype_edge_t));
-    arch->add_edge_count = 0;
+    return arch;
+}
 
-    arch->remove_edge_capacity = 8;
-    arch->remove_edges = TECS_MALLOC(arch->remove_edge_capacity * sizeof(tecs_archetype_edge_t));
-    arch->remove_edge_count = 0;
+/* ============================================================================
+ * Component Type Hooks
+ * ========================================================================= */
 
-    /* Initialize hash maps for O(1) lookups */
-    /* Use next power of 2 >= count * 2 for good load factor */
-    int map_capacity = component_count * 2;
-    if (map_capacity < 8) map_capacity = 8;
+static bool tecs_hooks_empty(const tecs_type_hooks_t* hooks) {
+    return !hooks->ctor && !hooks->dtor && !hooks->copy && !hooks->relocate;
+}
 
-    tecs_component_map_init(&arch->component_map, map_capacity);
-    
-    /* Initialize data component map for O(1) column lookups */
-    int data_map_capacity = arch->data_component_count * 2;
-    if (data_map_capacity < 8) data_map_capacity = 8;
-    tecs_component_map_init(&arch->data_component_map, data_map_capacity);
-    
-    tecs_edge_map_init(&arch->add_edge_map, 16);
-    tecs_edge_map_init(&arch->remove_edge_map, 16);
+/* Hooks of a data column, NULL for plain bytes */
+static const tecs_type_hooks_t* tecs_column_hooks(const tecs_archetype_t* arch, int column) {
+    if (!arch->hooks || tecs_hooks_empty(&arch->hooks[column])) return NULL;
+    return &arch->hooks[column];
+}
 
-    /* Populate component map */
-    for (int i = 0; i < component_count; i++) {
-        tecs_component_map_set(&arch->component_map, arch->components[i].id, i);
+static void* tecs_column_ptr(const tecs_column_t* column, int row, int size) {
+    return column->provider->get_ptr(column->provider->user_data, column->storage_data, row, size);
+}
+
+/* Default-construct rows [row, row + count) */
+static void tecs_column_construct(const tecs_type_hooks_t* hooks, tecs_column_t* column,
+                                  int row, int count, int size) {
+    if (column->is_native_storage) {
+        void* ptr = tecs_column_ptr(column, row, size);
+        if (hooks && hooks->ctor) hooks->ctor(ptr, count, hooks->user_data);
+        else memset(ptr, 0, (size_t)count * size);
+        return;
     }
-    
-    /* Populate data component map (component_id -> column index) */
+    for (int r = 0; r < count; r++) {
+        void* ptr = tecs_column_ptr(column, row + r, size);
+        if (hooks && hooks->ctor) hooks->ctor(ptr, 1, hooks->user_data);
+        else memset(ptr, 0, (size_t)size);
+    }
+}
+
+static void tecs_column_destruct(const tecs_type_hooks_t* hooks, tecs_column_t* column,
+                                 int row, int count, int size) {
+    if (!hooks || !hooks->dtor || count <= 0) return;
+    if (column->is_native_storage) {
+        hooks->dtor(tecs_column_ptr(column, row, size), count, hooks->user_data);
+        return;
+    }
+    for (int r = 0; r < count; r++) {
+        hooks->dtor(tecs_column_ptr(column, row + r, size), 1, hooks->user_data);
+    }
+}
+
+static void tecs_column_copy_rows(tecs_column_t* src, int src_row,
+                                  tecs_column_t* dst, int dst_row, int count, int size);
+
+/* Copy-construct dst rows from src rows; plain bytes are copied as-is */
+static void tecs_column_copy_construct(const tecs_type_hooks_t* hooks,
+                                       tecs_column_t* src, int src_row,
+                                       tecs_column_t* dst, int dst_row, int count, int size) {
+    if (!hooks || !hooks->copy) {
+        assert((!hooks || !hooks->dtor) && "move-only component cannot be copied");
+        tecs_column_copy_rows(src, src_row, dst, dst_row, count, size);
+    } else if (src->is_native_storage && dst->is_native_storage) {
+        hooks->copy(tecs_column_ptr(dst, dst_row, size), tecs_column_ptr(src, src_row, size),
+                    count, hooks->user_data);
+    } else {
+        for (int r = 0; r < count; r++) {
+            hooks->copy(tecs_column_ptr(dst, dst_row + r, size),
+                        tecs_column_ptr(src, src_row + r, size), 1, hooks->user_data);
+        }
+    }
+}
+
+/* Move rows to non-overlapping dst rows, leaving the src rows dead. Without a
+ * relocate hook this is the plain byte copy. */
+static void tecs_column_relocate(const tecs_type_hooks_t* hooks,
+                                 tecs_column_t* src, int src_row,
+                                 tecs_column_t* dst, int dst_row, int count, int size) {
+    if (!hooks || !hooks->relocate) {
+        tecs_column_copy_rows(src, src_row, dst, dst_row, count, size);
+    } else if (src->is_native_storage && dst->is_native_storage) {
+        hooks->relocate(tecs_column_ptr(dst, dst_row, size), tecs_column_ptr(src, src_row, size),
+                        count, hooks->user_data);
+    } else {
+        for (int r = 0; r < count; r++) {
+            hooks->relocate(tecs_column_ptr(dst, dst_row + r, size),
+                            tecs_column_ptr(src, src_row + r, size), 1, hooks->user_data);
+        }
+    }
+}
+
+/* Initialize a fresh row from data (copied, or relocated when move is set), or
+ * default-construct it when data is NULL */
+static void tecs_column_init(const tecs_type_hooks_t* hooks, tecs_column_t* column, int row,
+                             void* data, int size, bool move) {
+    if (!data) {
+        tecs_column_construct(hooks, column, row, 1, size);
+    } else if (move && hooks && hooks->relocate) {
+        hooks->relocate(tecs_column_ptr(column, row, size), data, 1, hooks->user_data);
+    } else if (!move && hooks && hooks->copy) {
+        hooks->copy(tecs_column_ptr(column, row, size), data, 1, hooks->user_data);
+    } else {
+        assert((move || !hooks || !hooks->dtor) && "move-only component: use tecs_set_move");
+        column->provider->set_data(column->provider->user_data, column->storage_data, row, data, size);
+    }
+}
+
+/* Overwrite a live row: destroy the old value, then initialize from data */
+static void tecs_column_assign(const tecs_type_hooks_t* hooks, tecs_column_t* column, int row,
+                               void* data, int size, bool move) {
+    if (data == tecs_column_ptr(column, row, size)) return;  /* Self-assignment */
+    tecs_column_destruct(hooks, column, row, 1, size);
+    tecs_column_init(hooks, column, row, data, size, move);
+}
+
+/* Run destructors for rows [first, first + count) of every hooked column */
+static void tecs_chunk_destruct_rows(tecs_archetype_t* arch, tecs_chunk_t* chunk, int first, int count) {
+    if (!arch->hooks) return;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        tecs_column_destruct(tecs_column_hooks(arch, i), &chunk->columns[i], first, count,
+                             arch->data_components[i].size);
+    }
+}
+
+/* Copy component hooks from the registry; called when an archetype joins a world */
+static void tecs_archetype_bind_hooks(tecs_world_t* world, tecs_archetype_t* arch) {
+    TECS_FREE(arch->hooks);
+    arch->hooks = NULL;
     for (int i = 0; i < arch->data_component_count; i++) {
-        tecs_component_map_set(&arch->data_component_map, arch->data_components[i].id, i);
+        int registry_index = tecs_component_map_get(&world->component_registry_map,
+                                                    arch->data_components[i].id);
+        if (registry_index < 0) continue;
+        const tecs_type_hooks_t* hooks = &world->component_registry[registry_index].hooks;
+        if (tecs_hooks_empty(hooks)) continue;
+        if (!arch->hooks) {
+            arch->hooks = TECS_CALLOC(arch->data_component_count, sizeof(tecs_type_hooks_t));
+        }
+        arch->hooks[i] = *hooks;
     }
+}
 
-    return arch;
+/* Registry hooks of a component, NULL for plain bytes */
+static const tecs_type_hooks_t* tecs_component_hooks(const tecs_world_t* world, tecs_component_id_t id) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, id);
+    if (registry_index < 0 || tecs_hooks_empty(&world->component_registry[registry_index].hooks)) return NULL;
+    return &world->component_registry[registry_index].hooks;
+}
+
+/* End the lifetime of a value handed to tecs_set_move that was never stored */
+static void tecs_value_destroy(const tecs_world_t* world, tecs_component_id_t id, void* data) {
+    const tecs_type_hooks_t* hooks = tecs_component_hooks(world, id);
+    if (data && hooks && hooks->dtor) hooks->dtor(data, 1, hooks->user_data);
 }
 
+/* Free a command's value; moved values that were never applied are destroyed */
+static void tecs_command_release(const tecs_world_t* world, tecs_command_t* cmd) {
+    if (cmd->move) tecs_value_destroy(world, cmd->component_id, cmd->data);
+    TECS_FREE(cmd->data);
+}
+
+static void tecs_snapshot_chunk_release(struct tecs_snapshot_chunk_s* snapshot_chunk);
+static void tecs_snapshot_free(tecs_snapshot_t* snapshot);
+
 static void tecs_chunk_free(tecs_chunk_t* chunk, int column_count) {
+    tecs_snapshot_chunk_release(chunk->snapshot);
+    if (chunk->hibernated) {
+        /* Column storage was released when the chunk hibernated */
+        TECS_FREE(chunk->hibernated);
+        column_count = 0;
+    }
     for (int i = 0; i < column_count; i++) {
         /* Free storage using provider */
         if (chunk->columns[i].provider && chunk->columns[i].provider->free_chunk) {
@@ -1017,22 +2216,15 @@ static void tecs_chunk_free(tecs_chunk_t* chunk, int column_count) {
 
 static void tecs_archetype_free(tecs_archetype_t* arch) {
     for (int i = 0; i < arch->chunk_count; i++) {
+        /* Hooked archetypes never hibernate, so their rows are resident */
+        if (!arch->chunks[i]->hibernated) {
+            tecs_chunk_destruct_rows(arch, arch->chunks[i], 0, arch->chunks[i]->count);
+        }
         tecs_chunk_free(arch->chunks[i], arch->data_component_count);
     }
+    TECS_FREE(arch->hooks);
     TECS_FREE(arch->chunks);
-    TECS_FREE(arch->components);
-    TECS_FREE(arch->data_components);
-    TECS_FREE(arch->tags);
-    TECS_FREE(arch->add_edges);
-    TECS_FREE(arch->remove_edges);
-
-    /* Free hash maps */
-    tecs_component_map_free(&arch->component_map);
-    tecs_component_map_free(&arch->data_component_map);
-    tecs_edge_map_free(&arch->add_edge_map);
-    tecs_edge_map_free(&arch->remove_edge_map);
-
-    TECS_FREE(arch);
+    TECS_FREE(arch);  /* Component arrays share the allocation */
 }
 
 static tecs_chunk_t* tecs_chunk_new(tecs_world_t* world,
@@ -1041,6 +2233,17 @@ static tecs_chunk_t* tecs_chunk_new(tecs_world_t* world,
     tecs_chunk_t* chunk = TECS_MALLOC(sizeof(tecs_chunk_t));
     chunk->count = 0;
     chunk->capacity = TECS_CHUNK_SIZE;
+    chunk->last_access = world->tick;
+    chunk->version = 1;
+    chunk->entity_hash_version = 0;
+    chunk->entity_hash = 0;
+    chunk->hibernated = NULL;
+    chunk->hibernated_size = 0;
+    chunk->hibernated_raw_size = 0;
+    chunk->snapshot = NULL;
+    chunk->snapshot_version = 0;
+    chunk->snapshot_tick = 0;
+    chunk->released_version = 0;
     chunk->columns = TECS_MALLOC(data_component_count * sizeof(tecs_column_t));
 
     for (int i = 0; i < data_component_count; i++) {
@@ -1068,72 +2271,351 @@ static tecs_chunk_t* tecs_chunk_new(tecs_world_t* world,
         chunk->columns[i].is_native_storage = (provider == &tecs_default_storage);
         chunk->columns[i].changed_ticks = TECS_CALLOC(TECS_CHUNK_SIZE, sizeof(tecs_tick_t));
         chunk->columns[i].added_ticks = TECS_CALLOC(TECS_CHUNK_SIZE, sizeof(tecs_tick_t));
+        chunk->columns[i].changed_max = 0;
+        chunk->columns[i].hash = 0;
+        chunk->columns[i].hash_version = 0;
+        chunk->columns[i].hash_tick = 0;
     }
 
     return chunk;
 }
 
-static void tecs_archetype_add_entity(tecs_world_t* world, tecs_archetype_t* arch, tecs_entity_t entity,
-                                      tecs_entity_record_t* record, tecs_tick_t tick) {
-    /* Find or create chunk with space */
-    tecs_chunk_t* chunk = NULL;
-    int chunk_idx = -1;
+/* ============================================================================
+ * Chunk Hibernation
+ * ========================================================================= */
 
-    for (int i = 0; i < arch->chunk_count; i++) {
-        if (arch->chunks[i]->count < TECS_CHUNK_SIZE) {
-            chunk = arch->chunks[i];
-            chunk_idx = i;
-            break;
+/* Byte-wise delta against the same byte of the previous element. Columns of
+ * slowly varying structs turn into runs of small values that compress well. */
+static void tecs_delta_encode(unsigned char* data, size_t length, size_t stride) {
+    for (size_t i = length; i-- > stride;) {
+        data[i] = (unsigned char)(data[i] - data[i - stride]);
+    }
+}
+
+static void tecs_delta_decode(unsigned char* data, size_t length, size_t stride) {
+    for (size_t i = stride; i < length; i++) {
+        data[i] = (unsigned char)(data[i] + data[i - stride]);
+    }
+}
+
+/* Minimal LZ77 block codec (LZ4-style sequences: token, literals, 16-bit offset,
+ * extended lengths). Favors speed over ratio. */
+#define TECS_LZ_HASH_BITS 12
+#define TECS_LZ_MIN_MATCH 4
+
+static size_t tecs_lz_bound(size_t length) {
+    return length + length / 255 + 16;
+}
+
+static unsigned char* tecs_lz_write_length(unsigned char* op, size_t length) {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (unsigned char)length;
+    return op;
+}
+
+static unsigned char* tecs_lz_emit(unsigned char* op, const unsigned char* literals,
+                                   size_t literal_count, size_t offset, size_t match_length) {
+    unsigned char* token = op++;
+    size_t match_code = match_length ? match_length - TECS_LZ_MIN_MATCH : 0;
+
+    *token = (unsigned char)(((literal_count < 15 ? literal_count : 15) << 4) |
+                             (match_code < 15 ? match_code : 15));
+    if (literal_count >= 15) op = tecs_lz_write_length(op, literal_count - 15);
+    memcpy(op, literals, literal_count);
+    op += literal_count;
+
+    if (match_length) {
+        *op++ = (unsigned char)(offset & 0xFF);
+        *op++ = (unsigned char)(offset >> 8);
+        if (match_code >= 15) op = tecs_lz_write_length(op, match_code - 15);
+    }
+    return op;
+}
+
+static size_t tecs_lz_compress(const unsigned char* src, size_t length, unsigned char* dst) {
+    uint32_t table[1 << TECS_LZ_HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    unsigned char* op = dst;
+    size_t anchor = 0;
+    size_t ip = 0;
+
+    if (length > 12) {
+        size_t limit = length - TECS_LZ_MIN_MATCH;
+        while (ip < limit) {
+            uint32_t sequence;
+            memcpy(&sequence, src + ip, sizeof(sequence));
+            uint32_t hash = (sequence * 2654435761u) >> (32 - TECS_LZ_HASH_BITS);
+            size_t candidate = table[hash];
+            table[hash] = (uint32_t)(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > 0xFFFF ||
+                memcmp(src + candidate - 1, src + ip, TECS_LZ_MIN_MATCH) != 0) {
+                ip++;
+                continue;
+            }
+
+            size_t match = candidate - 1;
+            size_t match_length = TECS_LZ_MIN_MATCH;
+            while (ip + match_length < length && src[match + match_length] == src[ip + match_length]) {
+                match_length++;
+            }
+
+            op = tecs_lz_emit(op, src + anchor, ip - anchor, ip - match, match_length);
+            ip += match_length;
+            anchor = ip;
         }
     }
 
-    if (!chunk) {
-        /* Allocate new chunk */
-        if (arch->chunk_count >= arch->chunk_capacity) {
-            arch->chunk_capacity *= 2;
-            arch->chunks = TECS_REALLOC(arch->chunks,
-                                        arch->chunk_capacity * sizeof(tecs_chunk_t*));
+    /* Trailing literals; a sequence without a match ends the block */
+    op = tecs_lz_emit(op, src + anchor, length - anchor, 0, 0);
+    return (size_t)(op - dst);
+}
+
+static bool tecs_lz_read_length(const unsigned char** ip, const unsigned char* end, size_t* length) {
+    unsigned char byte;
+    do {
+        if (*ip >= end) return false;
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+/* Returns false on malformed input or if the output would not be exactly `length` bytes */
+static bool tecs_lz_decompress(const unsigned char* src, size_t src_length,
+                               unsigned char* dst, size_t length) {
+    const unsigned char* ip = src;
+    const unsigned char* end = src + src_length;
+    size_t op = 0;
+
+    while (ip < end) {
+        unsigned char token = *ip++;
+        size_t literal_count = token >> 4;
+        if (literal_count == 15 && !tecs_lz_read_length(&ip, end, &literal_count)) return false;
+        if ((size_t)(end - ip) < literal_count || length - op < literal_count) return false;
+        memcpy(dst + op, ip, literal_count);
+        ip += literal_count;
+        op += literal_count;
+
+        if (ip == end) break;  /* Final literal-only sequence */
+
+        if (end - ip < 2) return false;
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        size_t match_length = token & 0x0F;
+        if (match_length == 15 && !tecs_lz_read_length(&ip, end, &match_length)) return false;
+        match_length += TECS_LZ_MIN_MATCH;
+        if (offset == 0 || offset > op || length - op < match_length) return false;
+
+        /* Byte copy: matches may overlap their own output */
+        for (size_t i = 0; i < match_length; i++, op++) {
+            dst[op] = dst[op - offset];
         }
+    }
 
-        chunk = tecs_chunk_new(world, arch->data_component_count, arch->data_components);
-        arch->chunks[arch->chunk_count] = chunk;
-        chunk_idx = arch->chunk_count;
-        arch->chunk_count++;
+    return op == length;
+}
+
+/* Pack columns (data, changed ticks, added ticks) of the used rows, delta + LZ
+ * encode them and release the column storage */
+static bool tecs_chunk_hibernate(tecs_world_t* world, tecs_archetype_t* arch, tecs_chunk_t* chunk) {
+    if (chunk->hibernated || chunk->count == 0 || arch->data_component_count == 0) return false;
+    if (arch->hooks) return false;  /* Owned resources must keep their addresses */
+    for (int i = 0; i < arch->data_component_count; i++) {
+        if (!chunk->columns[i].is_native_storage) return false;
+    }
+
+    size_t count = (size_t)chunk->count;
+    size_t raw_size = 0;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        raw_size += count * ((size_t)arch->data_components[i].size + 2 * sizeof(tecs_tick_t));
+    }
+    if (raw_size > UINT32_MAX) return false;
+
+    unsigned char* raw = TECS_MALLOC(raw_size);
+    unsigned char* cursor = raw;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        tecs_column_t* column = &chunk->columns[i];
+        size_t size = (size_t)arch->data_components[i].size;
+
+        memcpy(cursor, ((tecs_native_storage_t*)column->storage_data)->data, count * size);
+        tecs_delta_encode(cursor, count * size, size);
+        cursor += count * size;
+
+        memcpy(cursor, column->changed_ticks, count * sizeof(tecs_tick_t));
+        tecs_delta_encode(cursor, count * sizeof(tecs_tick_t), sizeof(tecs_tick_t));
+        cursor += count * sizeof(tecs_tick_t);
+
+        memcpy(cursor, column->added_ticks, count * sizeof(tecs_tick_t));
+        tecs_delta_encode(cursor, count * sizeof(tecs_tick_t), sizeof(tecs_tick_t));
+        cursor += count * sizeof(tecs_tick_t);
+    }
+
+    unsigned char* packed = TECS_MALLOC(tecs_lz_bound(raw_size));
+    size_t packed_size = tecs_lz_compress(raw, raw_size, packed);
+    if (packed_size < raw_size) {
+        TECS_FREE(raw);
+        chunk->hibernated = TECS_REALLOC(packed, packed_size);
+    } else {
+        /* Incompressible: keep the delta-encoded bytes as they are */
+        TECS_FREE(packed);
+        chunk->hibernated = raw;
+        packed_size = raw_size;
+    }
+    chunk->hibernated_size = (uint32_t)packed_size;
+    chunk->hibernated_raw_size = (uint32_t)raw_size;
+
+    for (int i = 0; i < arch->data_component_count; i++) {
+        tecs_column_t* column = &chunk->columns[i];
+        column->provider->free_chunk(column->provider->user_data, column->storage_data);
+        TECS_FREE(column->changed_ticks);
+        TECS_FREE(column->added_ticks);
+        column->storage_data = NULL;
+        column->changed_ticks = NULL;
+        column->added_ticks = NULL;
+    }
+
+    world->hibernation.chunk_count++;
+    world->hibernation.raw_bytes += raw_size;
+    world->hibernation.compressed_bytes += packed_size;
+    return true;
+}
+
+static void tecs_chunk_thaw(tecs_world_t* world, tecs_archetype_t* arch, tecs_chunk_t* chunk) {
+    size_t raw_size = chunk->hibernated_raw_size;
+    unsigned char* raw = chunk->hibernated;
+    if (chunk->hibernated_size != raw_size) {
+        raw = TECS_MALLOC(raw_size);
+        bool ok = tecs_lz_decompress(chunk->hibernated, chunk->hibernated_size, raw, raw_size);
+        assert(ok && "corrupt hibernated chunk");
+        (void)ok;
+    }
+
+    size_t count = (size_t)chunk->count;
+    unsigned char* cursor = raw;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        tecs_column_t* column = &chunk->columns[i];
+        size_t size = (size_t)arch->data_components[i].size;
+
+        column->storage_data = column->provider->alloc_chunk(column->provider->user_data,
+                                                             (int)size, TECS_CHUNK_SIZE);
+        column->changed_ticks = TECS_CALLOC(TECS_CHUNK_SIZE, sizeof(tecs_tick_t));
+        column->added_ticks = TECS_CALLOC(TECS_CHUNK_SIZE, sizeof(tecs_tick_t));
+
+        tecs_delta_decode(cursor, count * size, size);
+        memcpy(((tecs_native_storage_t*)column->storage_data)->data, cursor, count * size);
+        cursor += count * size;
+
+        tecs_delta_decode(cursor, count * sizeof(tecs_tick_t), sizeof(tecs_tick_t));
+        memcpy(column->changed_ticks, cursor, count * sizeof(tecs_tick_t));
+        cursor += count * sizeof(tecs_tick_t);
+
+        tecs_delta_decode(cursor, count * sizeof(tecs_tick_t), sizeof(tecs_tick_t));
+        memcpy(column->added_ticks, cursor, count * sizeof(tecs_tick_t));
+        cursor += count * sizeof(tecs_tick_t);
+    }
+
+    if (raw != chunk->hibernated) TECS_FREE(raw);
+    TECS_FREE(chunk->hibernated);
+
+    world->hibernation.chunk_count--;
+    world->hibernation.raw_bytes -= raw_size;
+    world->hibernation.compressed_bytes -= chunk->hibernated_size;
+
+    chunk->hibernated = NULL;
+    chunk->hibernated_size = 0;
+    chunk->hibernated_raw_size = 0;
+}
+
+/* Every path that reads or writes chunk columns goes through here */
+static void tecs_chunk_access(tecs_world_t* world, tecs_archetype_t* arch, tecs_chunk_t* chunk) {
+    /* Systems running in parallel stamp the same tick: store once, atomically */
+    volatile int32_t* stamp = (volatile int32_t*)&chunk->last_access;
+    if ((tecs_tick_t)tecs_atomic_load(stamp) != world->tick) tecs_atomic_store(stamp, (int32_t)world->tick);
+    if (chunk->hibernated) tecs_chunk_thaw(world, arch, chunk);
+}
+
+/* Allocate an empty chunk at the end of the archetype's chunk list */
+static int tecs_archetype_append_chunk(tecs_world_t* world, tecs_archetype_t* arch) {
+    if (arch->chunk_count >= arch->chunk_capacity) {
+        arch->chunk_capacity *= 2;
+        arch->chunks = TECS_REALLOC(arch->chunks,
+                                    arch->chunk_capacity * sizeof(tecs_chunk_t*));
+    }
+
+    arch->chunks[arch->chunk_count] = tecs_chunk_new(world, arch->data_component_count,
+                                                     arch->data_components);
+    return arch->chunk_count++;
+}
+
+/* Find a chunk with free rows, allocating a new one if all are full */
+static int tecs_archetype_chunk_with_space(tecs_world_t* world, tecs_archetype_t* arch) {
+    for (int i = 0; i < arch->chunk_count; i++) {
+        if (arch->chunks[i]->count < TECS_CHUNK_SIZE) {
+            tecs_chunk_access(world, arch, arch->chunks[i]);
+            return i;
+        }
     }
 
+    return tecs_archetype_append_chunk(world, arch);
+}
+
+static void tecs_archetype_add_entity(tecs_world_t* world, tecs_archetype_t* arch, tecs_entity_t entity,
+                                      tecs_entity_record_t* record, tecs_tick_t tick) {
+    int chunk_idx = tecs_archetype_chunk_with_space(world, arch);
+    tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+
     /* Add entity to chunk */
     int row = chunk->count;
     chunk->entities[row] = entity;
     chunk->count++;
+    chunk->version++;
     arch->entity_count++;
 
     /* Initialize ticks */
     for (int i = 0; i < arch->data_component_count; i++) {
         chunk->columns[i].added_ticks[row] = tick;
         chunk->columns[i].changed_ticks[row] = tick;
+        TECS_TICK_MAX(chunk->columns[i].changed_max, tick);
     }
 
     /* Update entity record */
     record->archetype = arch;
     record->chunk_index = chunk_idx;
-    record->row = arch->entity_count - 1;  /* Global row index */
+    record->row = row;
 }
 
-static void tecs_archetype_remove_entity(tecs_archetype_t* arch, int chunk_idx, int row) {
+/* Swap-remove a row. Hooked components of the row must already be destroyed
+ * or relocated out. */
+static void tecs_archetype_remove_entity(tecs_world_t* world, tecs_archetype_t* arch,
+                                         int chunk_idx, int row) {
     tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+    tecs_chunk_access(world, arch, chunk);
 
     /* Swap with last entity in chunk */
     int last_row = chunk->count - 1;
     if (row != last_row) {
         chunk->entities[row] = chunk->entities[last_row];
 
+        /* The swapped-in entity now lives at `row` */
+        tecs_entity_record_t* moved = tecs_sparse_set_get(&world->entities, chunk->entities[row]);
+        if (moved) moved->row = row;
+
         /* Swap component data using storage provider */
         for (int i = 0; i < arch->data_component_count; i++) {
             tecs_column_t* column = &chunk->columns[i];
             int size = arch->data_components[i].size;
+            const tecs_type_hooks_t* hooks = tecs_column_hooks(arch, i);
             
             /* Use provider's swap or copy operation */
-            if (column->provider->swap_data) {
+            if (hooks && hooks->relocate) {
+                /* The removed row is already dead: move the last row into it */
+                tecs_column_relocate(hooks, column, last_row, column, row, 1, size);
+            } else if (column->provider->swap_data) {
                 /* Optimized swap if available */
                 column->provider->swap_data(
                     column->provider->user_data,
@@ -1160,13 +2642,18 @@ static void tecs_archetype_remove_entity(tecs_archetype_t* arch, int chunk_idx,
     }
 
     chunk->count--;
+    chunk->version++;
     arch->entity_count--;
 }
 
 static int tecs_archetype_find_component(const tecs_archetype_t* arch,
                                          tecs_component_id_t component_id) {
-    /* Use hash map for O(1) lookup */
-    return tecs_component_map_get(&arch->component_map, component_id);
+    return tecs_sorted_ids_find(arch->component_ids, arch->component_count, component_id);
+}
+
+/* Column index of a data component, -1 for tags and missing components */
+static int tecs_archetype_column_index(const tecs_archetype_t* arch, tecs_component_id_t component_id) {
+    return tecs_sorted_ids_find(arch->data_component_ids, arch->data_component_count, component_id);
 }
 
 static bool tecs_archetype_has_component(const tecs_archetype_t* arch,
@@ -1174,107 +2661,404 @@ static bool tecs_archetype_has_component(const tecs_archetype_t* arch,
     return tecs_archetype_find_component(arch, component_id) >= 0;
 }
 
-static void tecs_archetype_add_edge(tecs_archetype_t* arch, tecs_component_id_t component_id,
-                                    tecs_archetype_t* target, bool is_add) {
-    tecs_archetype_edge_t** edges = is_add ? &arch->add_edges : &arch->remove_edges;
-    int* count = is_add ? &arch->add_edge_count : &arch->remove_edge_count;
-    int* capacity = is_add ? &arch->add_edge_capacity : &arch->remove_edge_capacity;
-    tecs_edge_map_t* edge_map = is_add ? &arch->add_edge_map : &arch->remove_edge_map;
+/* ============================================================================
+ * Archetype Edge Table
+ * ========================================================================= */
+
+static size_t tecs_edge_slot(const tecs_archetype_t* source, tecs_component_id_t component_id,
+                             bool is_add, int capacity) {
+    uint64_t hash = source->id ^ (component_id * 0x9E3779B97F4A7C15ULL) ^ (is_add ? 1u : 0u);
+    hash ^= hash >> 31;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 29;
+    return (size_t)(hash & (uint64_t)(capacity - 1));
+}
 
-    if (*count >= *capacity) {
-        *capacity *= 2;
-        *edges = TECS_REALLOC(*edges, *capacity * sizeof(tecs_archetype_edge_t));
+/* Rebuild the edge table at `capacity` (a power of two), dropping edges from or
+ * to archetypes marked for collection */
+static void tecs_world_rehash_edges(tecs_world_t* world, int capacity) {
+    tecs_archetype_edge_t* old_edges = world->edges;
+    int old_capacity = world->edge_capacity;
+
+    world->edges = TECS_CALLOC(capacity, sizeof(tecs_archetype_edge_t));
+    world->edge_capacity = capacity;
+    world->edge_count = 0;
+
+    for (int i = 0; i < old_capacity; i++) {
+        tecs_archetype_edge_t* edge = &old_edges[i];
+        if (!edge->source || edge->source->gc_marked || edge->target->gc_marked) continue;
+        size_t slot = tecs_edge_slot(edge->source, edge->component_id, edge->is_add, capacity);
+        while (world->edges[slot].source) slot = (slot + 1) & (size_t)(capacity - 1);
+        world->edges[slot] = *edge;
+        world->edge_count++;
     }
+    TECS_FREE(old_edges);
+}
 
-    (*edges)[*count].component_id = component_id;
-    (*edges)[*count].target = target;
-    (*count)++;
+/* Make room for `count` more edges below the 0.7 load factor */
+static void tecs_world_reserve_edges(tecs_world_t* world, int count) {
+    int capacity = world->edge_capacity ? world->edge_capacity : 64;
+    while ((world->edge_count + count) * 10 > capacity * 7) capacity *= 2;
+    if (capacity != world->edge_capacity) tecs_world_rehash_edges(world, capacity);
+}
+
+static void tecs_archetype_add_edge(tecs_world_t* world, tecs_archetype_t* arch,
+                                    tecs_component_id_t component_id, tecs_archetype_t* target,
+                                    bool is_add) {
+    tecs_world_reserve_edges(world, 1);
+
+    size_t mask = (size_t)(world->edge_capacity - 1);
+    size_t slot = tecs_edge_slot(arch, component_id, is_add, world->edge_capacity);
+    while (world->edges[slot].source &&
+           (world->edges[slot].source != arch || world->edges[slot].component_id != component_id ||
+            world->edges[slot].is_add != is_add)) {
+        slot = (slot + 1) & mask;
+    }
 
-    /* Also add to hash map for O(1) lookup */
-    tecs_edge_map_set(edge_map, component_id, target);
+    if (!world->edges[slot].source) world->edge_count++;
+    world->edges[slot].source = arch;
+    world->edges[slot].component_id = component_id;
+    world->edges[slot].target = target;
+    world->edges[slot].is_add = is_add;
 }
 
-static tecs_archetype_t* tecs_archetype_find_edge(const tecs_archetype_t* arch,
-                                                   tecs_component_id_t component_id,
-                                                   bool is_add) {
-    /* Use hash map for O(1) lookup */
-    const tecs_edge_map_t* edge_map = is_add ? &arch->add_edge_map : &arch->remove_edge_map;
-    return tecs_edge_map_get(edge_map, component_id);
+static tecs_archetype_t* tecs_archetype_find_edge(const tecs_world_t* world, const tecs_archetype_t* arch,
+                                                   tecs_component_id_t component_id, bool is_add) {
+    if (world->edge_count == 0) return NULL;
+
+    size_t mask = (size_t)(world->edge_capacity - 1);
+    size_t slot = tecs_edge_slot(arch, component_id, is_add, world->edge_capacity);
+    while (world->edges[slot].source) {
+        const tecs_archetype_edge_t* edge = &world->edges[slot];
+        if (edge->source == arch && edge->component_id == component_id && edge->is_add == is_add) {
+            return edge->target;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
 }
 
 /* ============================================================================
- * World Management
+ * API Tracing
  * ========================================================================= */
 
-tecs_world_t* tecs_world_new(void) {
-    tecs_world_t* world = TECS_CALLOC(1, sizeof(tecs_world_t));
-
-    tecs_sparse_set_init(&world->entities);
+#define TECS_TRACE_BUFFER (64 * 1024)
+#define TECS_TRACE_MAX_RECORD (64 + TECS_MAX_QUERY_TERMS * 22)  /* Names excluded */
 
-    /* Create root archetype (empty) */
-    world->root_archetype = tecs_archetype_new(NULL, 0);
+typedef struct tecs_trace_s {
+    FILE* file;
+    unsigned char* buffer;
+    int size;
+    int mute;               /* > 0 while the library calls its own traced functions */
+    int announced;          /* Registry entries written so far */
+    uint32_t query_count;
+    uint64_t records;
+    uint64_t frame_ns;
+    bool failed;
+} tecs_trace_t;
+
+static void tecs_trace_flush(tecs_trace_t* trace) {
+    if (trace->size > 0 && fwrite(trace->buffer, 1, (size_t)trace->size, trace->file) != (size_t)trace->size) {
+        trace->failed = true;
+    }
+    trace->size = 0;
+}
 
-    /* Initialize archetype hash table */
-    world->archetype_table_capacity = TECS_INITIAL_ARCHETYPES;
-    world->archetype_table = TECS_CALLOC(world->archetype_table_capacity,
-                                         sizeof(tecs_archetype_table_entry_t));
-    world->archetype_table_size = 0;
-    
-    /* Insert root archetype using hash table logic */
-    size_t index = world->root_archetype->id % world->archetype_table_capacity;
-    world->archetype_table[index].hash = world->root_archetype->id;
-    world->archetype_table[index].archetype = world->root_archetype;
-    world->archetype_table_size = 1;
+static void tecs_trace_u64(tecs_trace_t* trace, uint64_t value) {
+    while (value >= 0x80) {
+        trace->buffer[trace->size++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    trace->buffer[trace->size++] = (unsigned char)value;
+}
 
-    /* Initialize component registry */
-    world->component_capacity = TECS_MAX_COMPONENTS;
-    world->component_registry = TECS_MALLOC(world->component_capacity *
-                                            sizeof(tecs_component_registry_entry_t));
-    world->component_count = 0;
-    tecs_component_map_init(&world->component_registry_map, TECS_MAX_COMPONENTS);
+/* Start a record; NULL when not recording */
+static tecs_trace_t* tecs_trace_open(tecs_world_t* world, tecs_trace_op_t op) {
+    tecs_trace_t* trace = world->trace;
+    if (!trace || trace->mute > 0) return NULL;
+    if (trace->size > TECS_TRACE_BUFFER - TECS_TRACE_MAX_RECORD) tecs_trace_flush(trace);
+    trace->buffer[trace->size++] = (unsigned char)op;
+    trace->records++;
+    return trace;
+}
 
-    /* Initialize deferred command buffer */
-    world->command_capacity = 256;
-    world->command_buffer = TECS_MALLOC(world->command_capacity * sizeof(tecs_command_t));
-    world->command_count = 0;
-    world->in_deferred = false;
+/* Registry index of a traced component, announcing new registry entries first.
+ * -1 for unknown and hierarchy components, which only change through child ops. */
+static int tecs_trace_component(tecs_world_t* world, tecs_component_id_t component_id) {
+    if (component_id == world->parent_component_id || component_id == world->children_component_id) {
+        return -1;
+    }
+    int index = tecs_component_map_get(&world->component_registry_map, component_id);
+    if (index < 0) return -1;
+
+    tecs_trace_t* trace = world->trace;
+    while (trace->announced <= index) {
+        const tecs_component_registry_entry_t* entry = &world->component_registry[trace->announced++];
+        int length = (int)strlen(entry->name);
+        if (tecs_trace_open(world, TECS_TRACE_REGISTER)) {
+            tecs_trace_u64(trace, (uint64_t)entry->size);
+            tecs_trace_u64(trace, tecs_storage_is_boxed(entry->storage_provider) ? 1 : 0);
+            tecs_trace_u64(trace, (uint64_t)length);
+            if (length > TECS_TRACE_BUFFER - trace->size) {
+                /* Long names bypass the buffer */
+                tecs_trace_flush(trace);
+                if (fwrite(entry->name, 1, (size_t)length, trace->file) != (size_t)length) trace->failed = true;
+            } else {
+                memcpy(trace->buffer + trace->size, entry->name, (size_t)length);
+                trace->size += length;
+            }
+        }
+    }
+    return index;
+}
 
-    world->tick = 0;
-    world->structural_change_version = 0;
+static void tecs_trace_entity(tecs_world_t* world, tecs_trace_op_t op, tecs_entity_t entity) {
+    tecs_trace_t* trace = tecs_trace_open(world, op);
+    if (trace) tecs_trace_u64(trace, entity);
+}
 
-    /* Initialize entity children hashmap */
-    world->entity_children.capacity = 32;
-    world->entity_children.keys = TECS_MALLOC(world->entity_children.capacity * sizeof(tecs_entity_t));
-    world->entity_children.values = TECS_MALLOC(world->entity_children.capacity * sizeof(tecs_children_t*));
-    world->entity_children.count = 0;
+static void tecs_trace_pair(tecs_world_t* world, tecs_trace_op_t op, tecs_entity_t a, tecs_entity_t b) {
+    tecs_trace_t* trace = tecs_trace_open(world, op);
+    if (!trace) return;
+    tecs_trace_u64(trace, a);
+    tecs_trace_u64(trace, b);
+}
 
-    /* Auto-register hierarchy components (stored in world, not globals) */
-    world->parent_component_id = tecs_register_component(world, "tecs_parent_t", sizeof(tecs_parent_t));
-    world->children_component_id = tecs_register_component(world, "tecs_children_t", sizeof(tecs_children_t));
+static void tecs_trace_component_op(tecs_world_t* world, tecs_trace_op_t op, tecs_entity_t entity,
+                                    tecs_component_id_t component_id) {
+    if (world->trace->mute > 0) return;
+    int index = tecs_trace_component(world, component_id);
+    if (index < 0) return;
 
-    return world;
+    tecs_trace_t* trace = tecs_trace_open(world, op);
+    tecs_trace_u64(trace, entity);
+    tecs_trace_u64(trace, (uint64_t)index);
 }
 
-void tecs_world_free(tecs_world_t* world) {
-    if (!world) return;
+/* Number of the query in the trace, written again whenever terms were added */
+static uint32_t tecs_trace_query(tecs_world_t* world, tecs_query_t* query) {
+    tecs_trace_t* trace = world->trace;
+    if (query->trace_id != 0 && query->trace_terms == query->term_count) return query->trace_id;
+    if (trace->mute > 0) return 0;
 
-    /* Free all archetypes - iterate through hash table capacity */
-    for (int i = 0; i < world->archetype_table_capacity; i++) {
-        if (world->archetype_table[i].archetype) {
-            tecs_archetype_free(world->archetype_table[i].archetype);
-        }
+    int indices[TECS_MAX_QUERY_TERMS];
+    int count = 0;
+    for (int i = 0; i < query->term_count; i++) {
+        indices[i] = tecs_trace_component(world, query->terms[i].component_id);
+        if (indices[i] >= 0) count++;
+    }
+
+    if (query->trace_id == 0) query->trace_id = ++trace->query_count;
+    query->trace_terms = query->term_count;
+
+    tecs_trace_open(world, TECS_TRACE_QUERY);
+    tecs_trace_u64(trace, query->trace_id);
+    tecs_trace_u64(trace, (uint64_t)count);
+    for (int i = 0; i < query->term_count; i++) {
+        if (indices[i] < 0) continue;
+        tecs_trace_u64(trace, (uint64_t)query->terms[i].type);
+        tecs_trace_u64(trace, (uint64_t)indices[i]);
+    }
+    return query->trace_id;
+}
+
+/* Called when a full pass over the query ended */
+static void tecs_trace_iter(tecs_world_t* world, tecs_query_t* query) {
+    uint32_t id = tecs_trace_query(world, query);
+    if (id == 0) return;
+
+    uint64_t chunks = 0, rows = 0;
+    for (int a = 0; a < query->matched_count; a++) {
+        const tecs_archetype_t* arch = query->matched_archetypes[a];
+        for (int c = 0; c < arch->chunk_count; c++) {
+            const tecs_chunk_t* chunk = arch->chunks[c];
+            if (chunk->count == 0 || (chunk->hibernated && query->skip_hibernated)) continue;
+            chunks++;
+            rows += (uint64_t)chunk->count;
+        }
+    }
+
+    tecs_trace_t* trace = tecs_trace_open(world, TECS_TRACE_ITER);
+    if (!trace) return;
+    tecs_trace_u64(trace, id);
+    tecs_trace_u64(trace, chunks);
+    tecs_trace_u64(trace, rows);
+}
+
+static void tecs_trace_frame(tecs_world_t* world) {
+    uint64_t now = tecs_time_ns();
+    tecs_trace_t* trace = tecs_trace_open(world, TECS_TRACE_FRAME);
+    if (!trace) return;
+    tecs_trace_u64(trace, now - trace->frame_ns);
+    trace->frame_ns = now;
+}
+
+/* Spawn records for the live entities of one archetype */
+static void tecs_trace_write_archetype(tecs_world_t* world, const tecs_archetype_t* arch) {
+    for (int c = 0; c < arch->chunk_count; c++) {
+        const tecs_chunk_t* chunk = arch->chunks[c];
+        for (int r = 0; r < chunk->count; r++) {
+            tecs_trace_entity(world, TECS_TRACE_SPAWN, chunk->entities[r]);
+            for (int i = 0; i < arch->component_count; i++) {
+                tecs_trace_component_op(world, TECS_TRACE_SET, chunk->entities[r], arch->components[i].id);
+            }
+        }
+    }
+}
+
+bool tecs_trace_begin(tecs_world_t* world, const char* path) {
+    if (world->trace) tecs_trace_end(world);
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    tecs_trace_t* trace = TECS_CALLOC(1, sizeof(tecs_trace_t));
+    trace->file = file;
+    trace->buffer = TECS_MALLOC(TECS_TRACE_BUFFER);
+    memcpy(trace->buffer, TECS_TRACE_MAGIC, 8);
+    trace->size = 8;
+    trace->frame_ns = tecs_time_ns();
+    world->trace = trace;
+
+    for (int i = 0; i < world->query_count; i++) world->queries[i]->trace_id = 0;
+
+    /* Live entities first, then the hierarchy between them */
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (arch) tecs_trace_write_archetype(world, arch);
+    }
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch) continue;
+        int column = tecs_archetype_column_index(arch, world->parent_component_id);
+        if (column < 0) continue;
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_chunk_t* chunk = arch->chunks[c];
+            for (int r = 0; r < chunk->count; r++) {
+                const tecs_parent_t* parent = (const tecs_parent_t*)tecs_get(world, chunk->entities[r],
+                                                                             world->parent_component_id);
+                if (parent) tecs_trace_pair(world, TECS_TRACE_ADD_CHILD, parent->parent, chunk->entities[r]);
+            }
+        }
+    }
+    return true;
+}
+
+bool tecs_trace_end(tecs_world_t* world) {
+    tecs_trace_t* trace = world->trace;
+    if (!trace) return false;
+
+    tecs_trace_flush(trace);
+    bool ok = !trace->failed;
+    if (fclose(trace->file) != 0) ok = false;
+    TECS_FREE(trace->buffer);
+    TECS_FREE(trace);
+    world->trace = NULL;
+    return ok;
+}
+
+uint64_t tecs_trace_record_count(const tecs_world_t* world) {
+    return world->trace ? world->trace->records : 0;
+}
+
+/* ============================================================================
+ * World Management
+ * ========================================================================= */
+
+tecs_world_t* tecs_world_new(void) {
+    tecs_world_t* world = TECS_CALLOC(1, sizeof(tecs_world_t));
+
+    tecs_sparse_set_init(&world->entities);
+    world->snapshot_current = -1;
+
+    /* Create root archetype (empty) */
+    world->root_archetype = tecs_archetype_new(NULL, 0);
+
+    /* Initialize archetype hash table */
+    world->archetype_table_capacity = TECS_INITIAL_ARCHETYPES;
+    world->archetype_table = TECS_CALLOC(world->archetype_table_capacity,
+                                         sizeof(tecs_archetype_table_entry_t));
+    world->archetype_table_size = 0;
+    
+    /* Insert root archetype using hash table logic */
+    size_t index = world->root_archetype->id % world->archetype_table_capacity;
+    world->archetype_table[index].hash = world->root_archetype->id;
+    world->archetype_table[index].archetype = world->root_archetype;
+    world->archetype_table_size = 1;
+
+    /* Initialize component registry */
+    world->component_capacity = TECS_MAX_COMPONENTS;
+    world->component_registry = TECS_MALLOC(world->component_capacity *
+                                            sizeof(tecs_component_registry_entry_t));
+    world->component_count = 0;
+    tecs_component_map_init(&world->component_registry_map, TECS_MAX_COMPONENTS);
+
+    /* Initialize deferred command buffer */
+    world->command_capacity = 256;
+    world->command_buffer = TECS_MALLOC(world->command_capacity * sizeof(tecs_command_t));
+    world->command_count = 0;
+    world->in_deferred = false;
+    world->deferred_pool = NULL;
+
+    world->tick = 0;
+    world->structural_change_version = 0;
+
+    /* Initialize entity children hashmap */
+    world->entity_children.capacity = 32;
+    world->entity_children.keys = TECS_MALLOC(world->entity_children.capacity * sizeof(tecs_entity_t));
+    world->entity_children.values = TECS_MALLOC(world->entity_children.capacity * sizeof(tecs_children_t*));
+    world->entity_children.count = 0;
+
+    /* Auto-register hierarchy components (stored in world, not globals) */
+    world->parent_component_id = tecs_register_component(world, "tecs_parent_t", sizeof(tecs_parent_t));
+    world->children_component_id = tecs_register_component(world, "tecs_children_t", sizeof(tecs_children_t));
+
+    return world;
+}
+
+void tecs_world_free(tecs_world_t* world) {
+    if (!world) return;
+    if (world->trace) tecs_trace_end(world);
+
+    /* Free all archetypes - iterate through hash table capacity */
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        if (world->archetype_table[i].archetype) {
+            tecs_archetype_free(world->archetype_table[i].archetype);
+        }
     }
 
     TECS_FREE(world->archetype_table);
+    TECS_FREE(world->edges);
+
+    /* Every chunk has returned its boxed slots */
+    for (int i = 0; i < world->box_count; i++) tecs_box_storage_free(world->boxes[i]);
+    TECS_FREE(world->boxes);
+
+    /* Queries may outlive the world; they stop tracking it */
+    for (int i = 0; i < world->query_count; i++) {
+        world->queries[i]->world = NULL;
+        world->queries[i]->matched_count = 0;
+    }
+    TECS_FREE(world->queries);
+
+    /* Free command buffer; moved values need the registry hooks */
+    for (int i = 0; i < world->command_count; i++) {
+        tecs_command_release(world, &world->command_buffer[i]);
+    }
+
+    for (int i = 0; i < world->component_count; i++) {
+        TECS_FREE(world->component_registry[i].name);
+        TECS_FREE(world->component_registry[i].fields);
+    }
     TECS_FREE(world->component_registry);
     tecs_component_map_free(&world->component_registry_map);
 
-    /* Free command buffer */
-    for (int i = 0; i < world->command_count; i++) {
-        if (world->command_buffer[i].data) {
-            TECS_FREE(world->command_buffer[i].data);
-        }
+    /* Readers must have released their snapshots by now */
+    for (int i = 0; i < TECS_SNAPSHOT_SLOTS; i++) {
+        tecs_snapshot_free(world->snapshot_slots[i]);
     }
+    TECS_FREE(world->snapshot_components);
+
     TECS_FREE(world->command_buffer);
 
     /* Free entity children hashmap */
@@ -1291,7 +3075,12 @@ void tecs_world_free(tecs_world_t* world) {
     TECS_FREE(world);
 }
 
+static bool tecs_snapshot_publish_ex(tecs_world_t* world, tecs_tick_t complete);
+
 void tecs_world_update(tecs_world_t* world) {
+    if (world->trace) tecs_trace_frame(world);
+    if (world->snapshot_component_count > 0)
+        tecs_snapshot_publish_ex(world, world->tick + 1);  /* The tick ends here */
     world->tick++;
 }
 
@@ -1303,10 +3092,13 @@ int tecs_world_entity_count(const tecs_world_t* world) {
     return world->entities.dense_count;
 }
 
+static void tecs_world_add_archetype(tecs_world_t* world, tecs_archetype_t* arch);
+
 void tecs_world_clear(tecs_world_t* world) {
     /* Clear all entities and reset to root archetype */
     world->entities.dense_count = 0;
     world->entities.recycled_count = 0;
+    world->entities.next_index = 1;
     world->tick = 0;
     world->structural_change_version++;
 
@@ -1315,17 +3107,29 @@ void tecs_world_clear(tecs_world_t* world) {
         if (world->archetype_table[i].archetype && 
             world->archetype_table[i].archetype != world->root_archetype) {
             tecs_archetype_free(world->archetype_table[i].archetype);
-            world->archetype_table[i].archetype = NULL;
-            world->archetype_table[i].hash = 0;
         }
     }
-    world->archetype_table_size = 1;  /* Only root remains */
+    memset(&world->hibernation, 0, sizeof(world->hibernation));
+
+    /* Only root remains: reinsert it into an empty table, without probe holes */
+    memset(world->archetype_table, 0, world->archetype_table_capacity * sizeof(tecs_archetype_table_entry_t));
+    world->archetype_table_size = 0;
+    world->archetype_table_tombstones = 0;
+    tecs_world_add_archetype(world, world->root_archetype);
+    for (int i = 0; i < world->query_count; i++) {
+        world->queries[i]->matched_count = 0;
+        world->queries[i]->built = false;
+    }
 
     /* Clear root archetype chunks */
     for (int i = 0; i < world->root_archetype->chunk_count; i++) {
         world->root_archetype->chunks[i]->count = 0;
     }
     world->root_archetype->entity_count = 0;
+
+    /* Every edge involved a freed archetype */
+    if (world->edges) memset(world->edges, 0, world->edge_capacity * sizeof(tecs_archetype_edge_t));
+    world->edge_count = 0;
 }
 
 /* ============================================================================
@@ -1334,21 +3138,77 @@ void tecs_world_clear(tecs_world_t* world) {
 
 tecs_component_id_t tecs_register_component_ex(tecs_world_t* world, const char* name, int size,
                                                 tecs_storage_provider_t* storage_provider) {
+    return tecs_register_component_hooks(world, name, size, storage_provider, NULL);
+}
+
+tecs_component_id_t tecs_component_id_of(const char* name) {
+    /* FNV-1a over the whole name, then mixed; 0 stays reserved */
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; name && name[i]; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 0x100000001b3ULL;
+    }
+    hash = tecs_hash_u64(hash);
+    return hash ? hash : 1;
+}
+
+/* Registry index of a registered name, -1 if absent. On a hash collision the later name
+ * was moved to the rehashed ID, so keep probing along that chain. */
+static int tecs_component_find_name(const tecs_world_t* world, const char* name,
+                                    tecs_component_id_t* out_id) {
+    tecs_component_id_t id = tecs_component_id_of(name);
+    for (;;) {
+        int registry_index = tecs_component_map_get(&world->component_registry_map, id);
+        if (out_id) *out_id = id;
+        if (registry_index < 0) return -1;
+        if (strcmp(world->component_registry[registry_index].name, name ? name : "") == 0) {
+            return registry_index;
+        }
+        id = tecs_hash_u64(id) | 1;
+    }
+}
+
+static void tecs_component_map_grow(tecs_component_map_t* map) {
+    tecs_component_map_t grown;
+    tecs_component_map_init(&grown, map->capacity * 2);
+    for (int i = 0; i < map->capacity; i++) {
+        if (map->entries[i].occupied) {
+            tecs_component_map_set(&grown, map->entries[i].key, map->entries[i].value);
+        }
+    }
+    tecs_component_map_free(map);
+    *map = grown;
+}
+
+tecs_component_id_t tecs_register_component_hooks(tecs_world_t* world, const char* name, int size,
+                                                   tecs_storage_provider_t* storage_provider,
+                                                   const tecs_type_hooks_t* hooks) {
+    tecs_component_id_t id;
+    int existing = tecs_component_find_name(world, name, &id);
+    if (existing >= 0) return world->component_registry[existing].size == size ? id : 0;
+
     if (world->component_count >= world->component_capacity) {
         world->component_capacity *= 2;
         world->component_registry = TECS_REALLOC(world->component_registry,
                                                  world->component_capacity *
                                                  sizeof(tecs_component_registry_entry_t));
     }
-
-    tecs_component_id_t id = world->component_count + 1;  /* Start at 1, 0 is reserved */
+    if ((world->component_count + 1) * 2 > world->component_registry_map.capacity) {
+        tecs_component_map_grow(&world->component_registry_map);
+    }
 
     int registry_index = world->component_count;
     world->component_registry[registry_index].id = id;
-    strncpy(world->component_registry[registry_index].name, name, 63);
-    world->component_registry[registry_index].name[63] = '\0';
+    size_t name_length = name ? strlen(name) : 0;
+    world->component_registry[registry_index].name = TECS_MALLOC(name_length + 1);
+    memcpy(world->component_registry[registry_index].name, name ? name : "", name_length);
+    world->component_registry[registry_index].name[name_length] = '\0';
     world->component_registry[registry_index].size = size;
     world->component_registry[registry_index].storage_provider = storage_provider;
+    memset(&world->component_registry[registry_index].hooks, 0, sizeof(tecs_type_hooks_t));
+    if (hooks && size > 0) world->component_registry[registry_index].hooks = *hooks;
+    world->component_registry[registry_index].fields = NULL;
+    world->component_registry[registry_index].field_count = 0;
     world->component_count++;
     
     /* Add to hashmap for O(1) lookup */
@@ -1357,22 +3217,322 @@ tecs_component_id_t tecs_register_component_ex(tecs_world_t* world, const char*
     return id;
 }
 
+void tecs_set_component_hooks(tecs_world_t* world, tecs_component_id_t component_id,
+                              const tecs_type_hooks_t* hooks) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, component_id);
+    if (registry_index < 0 || world->component_registry[registry_index].size <= 0) return;
+
+    tecs_type_hooks_t* entry = &world->component_registry[registry_index].hooks;
+    if (hooks) *entry = *hooks;
+    else memset(entry, 0, sizeof(tecs_type_hooks_t));
+
+    /* Rebind archetypes that already store the component */
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch || tecs_archetype_column_index(arch, component_id) < 0) continue;
+        for (int c = 0; c < arch->chunk_count; c++) {
+            if (arch->chunks[c]->hibernated) tecs_chunk_access(world, arch, arch->chunks[c]);
+        }
+        tecs_archetype_bind_hooks(world, arch);
+    }
+}
+
 tecs_component_id_t tecs_register_component(tecs_world_t* world, const char* name, int size) {
     return tecs_register_component_ex(world, name, size, NULL);
 }
 
+tecs_component_id_t tecs_register_component_boxed(tecs_world_t* world, const char* name, int size) {
+    tecs_component_id_t id;
+    if (size <= 0 || tecs_component_find_name(world, name, &id) >= 0) {
+        return tecs_register_component(world, name, size);
+    }
+
+    if (world->box_count == world->box_capacity) {
+        world->box_capacity = world->box_capacity ? world->box_capacity * 2 : 4;
+        world->boxes = TECS_REALLOC(world->boxes, world->box_capacity * sizeof(tecs_box_storage_t*));
+    }
+    tecs_box_storage_t* box = tecs_box_storage_new(size);
+    world->boxes[world->box_count++] = box;
+    return tecs_register_component_ex(world, name, size, &box->provider);
+}
+
 tecs_component_id_t tecs_get_component_id(const tecs_world_t* world, const char* name) {
     if (!world || !name) {
         return 0;
     }
 
-    for (int i = 0; i < world->component_count; i++) {
-        if (strcmp(world->component_registry[i].name, name) == 0) {
-            return world->component_registry[i].id;
+    tecs_component_id_t id;
+    return tecs_component_find_name(world, name, &id) >= 0 ? id : 0;
+}
+
+int tecs_get_component_size(const tecs_world_t* world, tecs_component_id_t component_id) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, component_id);
+    return registry_index >= 0 ? world->component_registry[registry_index].size : -1;
+}
+
+/* ============================================================================
+ * Component Reflection
+ * ========================================================================= */
+
+bool tecs_set_component_fields(tecs_world_t* world, tecs_component_id_t component_id,
+                               const tecs_field_t* fields, int field_count) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, component_id);
+    if (registry_index < 0) return false;
+    tecs_component_registry_entry_t* entry = &world->component_registry[registry_index];
+    if (field_count < 0 || field_count > TECS_MAX_FIELDS || (field_count > 0 && entry->size <= 0)) {
+        return false;
+    }
+
+    size_t names_size = 0;
+    for (int i = 0; i < field_count; i++) {
+        const tecs_field_t* field = &fields[i];
+        if ((int)field->type < (int)TECS_FIELD_U8 || (int)field->type > (int)TECS_FIELD_ENTITY ||
+            field->count < 1 ||
+            field->offset < 0 ||
+            field->offset + field->count * TECS_FIELD_TYPE_SIZE(field->type) > entry->size) {
+            return false;
+        }
+        names_size += (field->name ? strlen(field->name) : 0) + 1;
+    }
+
+    /* One block: descriptors followed by their names */
+    tecs_field_t* copy = NULL;
+    if (field_count > 0) {
+        copy = TECS_MALLOC(field_count * sizeof(tecs_field_t) + names_size);
+        char* names = (char*)(copy + field_count);
+        for (int i = 0; i < field_count; i++) {
+            const char* name = fields[i].name ? fields[i].name : "";
+            size_t length = strlen(name) + 1;
+            memcpy(names, name, length);
+            copy[i] = fields[i];
+            copy[i].name = names;
+            names += length;
+        }
+    }
+
+    TECS_FREE(entry->fields);
+    entry->fields = copy;
+    entry->field_count = field_count;
+    return true;
+}
+
+int tecs_get_component_fields(const tecs_world_t* world, tecs_component_id_t component_id,
+                              const tecs_field_t** out_fields) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, component_id);
+    if (registry_index < 0) {
+        if (out_fields) *out_fields = NULL;
+        return 0;
+    }
+    if (out_fields) *out_fields = world->component_registry[registry_index].fields;
+    return world->component_registry[registry_index].field_count;
+}
+
+/* Descriptors of a data component, or one opaque field spanning it. -1 if unknown. */
+static int tecs_component_fields(const tecs_world_t* world, tecs_component_id_t component_id,
+                                 const tecs_field_t** fields, tecs_field_t* fallback, int* size) {
+    int registry_index = tecs_component_map_get(&world->component_registry_map, component_id);
+    if (registry_index < 0 || world->component_registry[registry_index].size <= 0) return -1;
+
+    const tecs_component_registry_entry_t* entry = &world->component_registry[registry_index];
+    *size = entry->size;
+    if (entry->field_count > 0) {
+        *fields = entry->fields;
+        return entry->field_count;
+    }
+    fallback->name = "";
+    fallback->type = TECS_FIELD_BYTES;
+    fallback->offset = 0;
+    fallback->count = entry->size;
+    *fields = fallback;
+    return 1;
+}
+
+int tecs_component_packed_size(const tecs_world_t* world, tecs_component_id_t component_id) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    int packed = 0;
+    for (int f = 0; f < field_count; f++) {
+        packed += fields[f].count * TECS_FIELD_TYPE_SIZE(fields[f].type);
+    }
+    return packed;
+}
+
+static bool tecs_host_little_endian(void) {
+    const uint16_t probe = 1;
+    return *(const unsigned char*)&probe == 1;
+}
+
+static uint64_t tecs_scalar_load(const unsigned char* ptr, int width) {
+    switch (width) {
+        case 1: return *ptr;
+        case 2: { uint16_t v; memcpy(&v, ptr, 2); return v; }
+        case 4: { uint32_t v; memcpy(&v, ptr, 4); return v; }
+        default: { uint64_t v; memcpy(&v, ptr, 8); return v; }
+    }
+}
+
+static void tecs_scalar_store(unsigned char* ptr, int width, uint64_t value) {
+    switch (width) {
+        case 1: *ptr = (unsigned char)value; break;
+        case 2: { uint16_t v = (uint16_t)value; memcpy(ptr, &v, 2); break; }
+        case 4: { uint32_t v = (uint32_t)value; memcpy(ptr, &v, 4); break; }
+        default: memcpy(ptr, &value, 8); break;
+    }
+}
+
+static uint64_t tecs_scalar_load_le(const unsigned char* ptr, int width) {
+    uint64_t value = 0;
+    for (int i = 0; i < width; i++) value |= (uint64_t)ptr[i] << (8 * i);
+    return value;
+}
+
+static void tecs_scalar_store_le(unsigned char* ptr, int width, uint64_t value) {
+    for (int i = 0; i < width; i++) ptr[i] = (unsigned char)(value >> (8 * i));
+}
+
+size_t tecs_fields_serialize(const tecs_world_t* world, tecs_component_id_t component_id,
+                             const void* src, int count, void* out) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    if (field_count < 0) return 0;
+
+    bool native = tecs_host_little_endian();
+    unsigned char* cursor = (unsigned char*)out;
+    for (int e = 0; e < count; e++) {
+        const unsigned char* element = (const unsigned char*)src + (size_t)e * size;
+        for (int f = 0; f < field_count; f++) {
+            int width = TECS_FIELD_TYPE_SIZE(fields[f].type);
+            const unsigned char* field = element + fields[f].offset;
+            if (native || width == 1) {
+                memcpy(cursor, field, (size_t)width * fields[f].count);
+            } else {
+                for (int s = 0; s < fields[f].count; s++) {
+                    tecs_scalar_store_le(cursor + s * width, width, tecs_scalar_load(field + s * width, width));
+                }
+            }
+            cursor += (size_t)width * fields[f].count;
+        }
+    }
+    return (size_t)(cursor - (unsigned char*)out);
+}
+
+size_t tecs_fields_deserialize(const tecs_world_t* world, tecs_component_id_t component_id,
+                               const void* in, int count, void* dst) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    if (field_count < 0) return 0;
+
+    /* Padding and undescribed bytes come back as zeros */
+    memset(dst, 0, (size_t)count * size);
+    bool native = tecs_host_little_endian();
+    const unsigned char* cursor = (const unsigned char*)in;
+    for (int e = 0; e < count; e++) {
+        unsigned char* element = (unsigned char*)dst + (size_t)e * size;
+        for (int f = 0; f < field_count; f++) {
+            int width = TECS_FIELD_TYPE_SIZE(fields[f].type);
+            unsigned char* field = element + fields[f].offset;
+            if (native || width == 1) {
+                memcpy(field, cursor, (size_t)width * fields[f].count);
+            } else {
+                for (int s = 0; s < fields[f].count; s++) {
+                    tecs_scalar_store(field + s * width, width, tecs_scalar_load_le(cursor + s * width, width));
+                }
+            }
+            cursor += (size_t)width * fields[f].count;
+        }
+    }
+    return (size_t)(cursor - (const unsigned char*)in);
+}
+
+/* Scalars are differenced as wrapping integers of their width, which is exact
+ * for floats too and leaves zeros wherever the bits did not change. */
+size_t tecs_fields_delta_encode(const tecs_world_t* world, tecs_component_id_t component_id,
+                                const void* baseline, const void* current, int count, void* out) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    if (field_count < 0) return 0;
+
+    const unsigned char* base = (const unsigned char*)baseline;
+    const unsigned char* cur = (const unsigned char*)current;
+    unsigned char* cursor = (unsigned char*)out;
+    for (int f = 0; f < field_count; f++) {
+        int width = TECS_FIELD_TYPE_SIZE(fields[f].type);
+        int scalars = fields[f].count;
+        for (int e = 0; e < count; e++) {
+            size_t offset = (size_t)e * size + fields[f].offset;
+            for (int s = 0; s < scalars; s++) {
+                uint64_t value = tecs_scalar_load(cur + offset + s * width, width);
+                if (base) value -= tecs_scalar_load(base + offset + s * width, width);
+                tecs_scalar_store_le(cursor, width, value);
+                cursor += width;
+            }
+        }
+    }
+    return (size_t)(cursor - (unsigned char*)out);
+}
+
+size_t tecs_fields_delta_decode(const tecs_world_t* world, tecs_component_id_t component_id,
+                                const void* baseline, const void* in, int count, void* dst) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    if (field_count < 0) return 0;
+
+    /* dst may alias the baseline for in-place updates */
+    const unsigned char* base = (const unsigned char*)baseline;
+    unsigned char* out = (unsigned char*)dst;
+    if (out != base) memset(out, 0, (size_t)count * size);
+    const unsigned char* cursor = (const unsigned char*)in;
+    for (int f = 0; f < field_count; f++) {
+        int width = TECS_FIELD_TYPE_SIZE(fields[f].type);
+        int scalars = fields[f].count;
+        for (int e = 0; e < count; e++) {
+            size_t offset = (size_t)e * size + fields[f].offset;
+            for (int s = 0; s < scalars; s++) {
+                uint64_t value = tecs_scalar_load_le(cursor, width);
+                if (base) value += tecs_scalar_load(base + offset + s * width, width);
+                tecs_scalar_store(out + offset + s * width, width, value);
+                cursor += width;
+            }
         }
     }
+    return (size_t)(cursor - (const unsigned char*)in);
+}
 
-    return 0;  /* Component not found */
+int tecs_fields_diff(const tecs_world_t* world, tecs_component_id_t component_id,
+                     const void* a, const void* b, int count, uint64_t* masks) {
+    const tecs_field_t* fields;
+    tecs_field_t fallback;
+    int size;
+    int field_count = tecs_component_fields(world, component_id, &fields, &fallback, &size);
+    if (field_count < 0) return 0;
+
+    int changed = 0;
+    for (int e = 0; e < count; e++) {
+        const unsigned char* left = (const unsigned char*)a + (size_t)e * size;
+        const unsigned char* right = (const unsigned char*)b + (size_t)e * size;
+        uint64_t mask = 0;
+        if (memcmp(left, right, (size_t)size) != 0) {
+            for (int f = 0; f < field_count; f++) {
+                size_t bytes = (size_t)fields[f].count * TECS_FIELD_TYPE_SIZE(fields[f].type);
+                if (memcmp(left + fields[f].offset, right + fields[f].offset, bytes) != 0) {
+                    mask |= (uint64_t)1 << f;
+                }
+            }
+        }
+        if (mask) changed++;
+        if (masks) masks[e] = mask;
+    }
+    return changed;
 }
 
 /* ============================================================================
@@ -1388,9 +3548,9 @@ static tecs_archetype_t* tecs_world_find_archetype(const tecs_world_t* world, ui
     
     do {
         if (world->archetype_table[index].archetype == NULL) {
-            return NULL;  /* Empty slot, archetype doesn't exist */
-        }
-        if (world->archetype_table[index].hash == hash) {
+            /* Tombstones continue the probe, empty slots end it */
+            if (!world->archetype_table[index].deleted) return NULL;
+        } else if (world->archetype_table[index].hash == hash) {
             return world->archetype_table[index].archetype;
         }
         index = (index + 1) % world->archetype_table_capacity;
@@ -1399,44 +3559,57 @@ static tecs_archetype_t* tecs_world_find_archetype(const tecs_world_t* world, ui
     return NULL;  /* Table is full and archetype not found */
 }
 
-static void tecs_world_add_archetype(tecs_world_t* world, tecs_archetype_t* arch) {
-    /* Rehash if load factor exceeds 0.7 */
-    if (world->archetype_table_size >= (world->archetype_table_capacity * 7) / 10) {
-        int old_capacity = world->archetype_table_capacity;
-        int new_capacity = old_capacity * 2;
-        tecs_archetype_table_entry_t* old_table = world->archetype_table;
-        
-        /* Allocate new table and zero-initialize */
-        world->archetype_table = TECS_CALLOC(new_capacity, sizeof(tecs_archetype_table_entry_t));
-        world->archetype_table_capacity = new_capacity;
-        world->archetype_table_size = 0;
-        
-        /* Rehash all existing entries */
-        for (int i = 0; i < old_capacity; i++) {
-            if (old_table[i].archetype != NULL) {
-                /* Insert into new table with linear probing */
-                size_t index = old_table[i].hash % new_capacity;
-                while (world->archetype_table[index].archetype != NULL) {
-                    index = (index + 1) % new_capacity;
-                }
-                world->archetype_table[index] = old_table[i];
-                world->archetype_table_size++;
+/* Rebuild the table at `new_capacity`, dropping tombstones */
+static void tecs_world_rehash_archetypes(tecs_world_t* world, int new_capacity) {
+    int old_capacity = world->archetype_table_capacity;
+    tecs_archetype_table_entry_t* old_table = world->archetype_table;
+    
+    /* Allocate new table and zero-initialize */
+    world->archetype_table = TECS_CALLOC(new_capacity, sizeof(tecs_archetype_table_entry_t));
+    world->archetype_table_capacity = new_capacity;
+    world->archetype_table_size = 0;
+    world->archetype_table_tombstones = 0;
+    
+    /* Rehash all existing entries */
+    for (int i = 0; i < old_capacity; i++) {
+        if (old_table[i].archetype != NULL) {
+            /* Insert into new table with linear probing */
+            size_t index = old_table[i].hash % new_capacity;
+            while (world->archetype_table[index].archetype != NULL) {
+                index = (index + 1) % new_capacity;
             }
+            world->archetype_table[index] = old_table[i];
+            world->archetype_table_size++;
         }
-        
-        TECS_FREE(old_table);
     }
     
-    /* Insert new archetype with linear probing */
+    TECS_FREE(old_table);
+}
+
+static void tecs_world_add_archetype(tecs_world_t* world, tecs_archetype_t* arch) {
+    /* Rehash if load factor (tombstones included) exceeds 0.7 */
+    if (world->archetype_table_size + world->archetype_table_tombstones >=
+        (world->archetype_table_capacity * 7) / 10) {
+        int old_capacity = world->archetype_table_capacity;
+        /* Mostly tombstones: purge them at the same capacity */
+        tecs_world_rehash_archetypes(world, world->archetype_table_size * 2 >= old_capacity
+                                                ? old_capacity * 2 : old_capacity);
+    }
+    
+    /* Insert new archetype with linear probing, reusing the first tombstone */
     size_t index = arch->id % world->archetype_table_capacity;
     while (world->archetype_table[index].archetype != NULL) {
         index = (index + 1) % world->archetype_table_capacity;
     }
     
+    if (world->archetype_table[index].deleted) world->archetype_table_tombstones--;
     world->archetype_table[index].hash = arch->id;
     world->archetype_table[index].archetype = arch;
+    world->archetype_table[index].deleted = false;
     world->archetype_table_size++;
     world->structural_change_version++;
+    arch->created_tick = world->tick;
+    tecs_archetype_bind_hooks(world, arch);
 }
 
 /* ============================================================================
@@ -1450,41 +3623,121 @@ tecs_entity_t tecs_entity_new(tecs_world_t* world) {
     /* Add to root archetype */
     tecs_archetype_add_entity(world, world->root_archetype, entity, record, world->tick);
 
+    if (world->trace) tecs_trace_entity(world, TECS_TRACE_SPAWN, entity);
     return entity;
 }
 
 tecs_entity_t tecs_entity_new_with_id(tecs_world_t* world, tecs_entity_t id) {
-    (void)id;  /* Unused parameter */
-    /* For now, just use the provided ID without validation */
-    /* In production, should validate and handle collisions */
-    return tecs_entity_new(world);
-}
+    tecs_entity_sparse_set_t* set = &world->entities;
+    uint32_t index = TECS_ENTITY_INDEX(id);
 
-void tecs_entity_delete(tecs_world_t* world, tecs_entity_t entity) {
-    tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
-    if (!record || !record->archetype) return;
+    if (id == TECS_ENTITY_NULL) return TECS_ENTITY_NULL;
 
-    /* Remove from archetype */
-    tecs_archetype_remove_entity(record->archetype, record->chunk_index,
-                                 record->row % TECS_CHUNK_SIZE);
+    /* O(1) collision check: the index is either free or already holds this exact ID */
+    if (tecs_sparse_set_index_alive(set, index)) {
+        return set->dense[set->sparse[index]].entity == id ? id : TECS_ENTITY_NULL;
+    }
 
-    /* Remove from sparse set */
-    tecs_sparse_set_remove(&world->entities, entity);
+    /* Any stale copy of the index left on the recycle list is skipped lazily
+     * by tecs_sparse_set_create once this ID is alive. */
+    tecs_entity_t entity = tecs_sparse_set_insert(set, index, TECS_ENTITY_GENERATION(id));
+    tecs_entity_record_t* record = tecs_sparse_set_get(set, entity);
+
+    tecs_archetype_add_entity(world, world->root_archetype, entity, record, world->tick);
+
+    if (world->trace) tecs_trace_entity(world, TECS_TRACE_SPAWN_ID, entity);
+    return entity;
 }
 
-bool tecs_entity_exists(const tecs_world_t* world, tecs_entity_t entity) {
-    return tecs_sparse_set_get(&world->entities, entity) != NULL;
+void tecs_world_reserve_id_range(tecs_world_t* world, uint32_t first_index, uint32_t count) {
+    world->entities.reserved_begin = first_index;
+    world->entities.reserved_end = first_index + count;
+    if (world->entities.reserved_end < first_index) {
+        world->entities.reserved_end = UINT32_MAX;  /* Clamp on overflow */
+    }
 }
 
-/* ============================================================================
- * Component Operations
- * ========================================================================= */
+bool tecs_entity_id_is_reserved(const tecs_world_t* world, tecs_entity_t id) {
+    return tecs_sparse_set_is_reserved(&world->entities, TECS_ENTITY_INDEX(id));
+}
+
+/* Append a command to a growable buffer; SET copies the value */
+static tecs_command_t* tecs_command_push(tecs_command_t** buffer, int* count, int* capacity,
+                                         tecs_command_type_t type, tecs_entity_t entity,
+                                         tecs_component_id_t component_id, const void* data, int size) {
+    if (*count >= *capacity) {
+        *capacity = *capacity > 0 ? *capacity * 2 : 16;
+        *buffer = TECS_REALLOC(*buffer, *capacity * sizeof(tecs_command_t));
+    }
+
+    tecs_command_t* cmd = &(*buffer)[(*count)++];
+    cmd->type = type;
+    cmd->entity = entity;
+    cmd->component_id = component_id;
+    cmd->size = size;
+    cmd->data = NULL;
+    cmd->move = false;
+    if (data && size > 0) {
+        cmd->data = TECS_MALLOC(size);
+        memcpy(cmd->data, data, size);
+    }
+    return cmd;
+}
+
+/* Queue a command until tecs_end_deferred() */
+static void tecs_defer_command(tecs_world_t* world, tecs_command_type_t type, tecs_entity_t entity,
+                               tecs_component_id_t component_id, const void* data, int size) {
+    tecs_command_push(&world->command_buffer, &world->command_count, &world->command_capacity,
+                      type, entity, component_id, data, size);
+}
+
+/* Destroy owned resources, then remove the entity's row from its archetype */
+static void tecs_entity_release_row(tecs_world_t* world, tecs_entity_record_t* record) {
+    tecs_archetype_t* arch = record->archetype;
+    if (arch->hooks) {
+        tecs_chunk_t* chunk = arch->chunks[record->chunk_index];
+        tecs_chunk_access(world, arch, chunk);
+        tecs_chunk_destruct_rows(arch, chunk, record->row % TECS_CHUNK_SIZE, 1);
+    }
+    tecs_archetype_remove_entity(world, arch, record->chunk_index,
+                                 record->row % TECS_CHUNK_SIZE);
+}
+
+void tecs_entity_delete(tecs_world_t* world, tecs_entity_t entity) {
+    if (world->trace) tecs_trace_entity(world, TECS_TRACE_DELETE, entity);
+    if (world->in_deferred) {
+        tecs_defer_command(world, TECS_CMD_DELETE_ENTITY, entity, 0, NULL, 0);
+        return;
+    }
+
+    tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
+    if (!record) return;
+
+    /* Unloaded entity: only the ID is resident, its row is dropped on reload */
+    if (!record->archetype) {
+        tecs_sparse_set_remove(&world->entities, entity);
+        return;
+    }
+
+    tecs_entity_release_row(world, record);
+
+    /* Remove from sparse set */
+    tecs_sparse_set_remove(&world->entities, entity);
+}
+
+bool tecs_entity_exists(const tecs_world_t* world, tecs_entity_t entity) {
+    return tecs_sparse_set_get(&world->entities, entity) != NULL;
+}
+
+/* ============================================================================
+ * Component Operations
+ * ========================================================================= */
 
 static tecs_archetype_t* tecs_world_get_or_create_archetype_with_component(
     tecs_world_t* world, tecs_archetype_t* current, tecs_component_id_t component_id, int size) {
 
     /* Check graph edge cache */
-    tecs_archetype_t* target = tecs_archetype_find_edge(current, component_id, true);
+    tecs_archetype_t* target = tecs_archetype_find_edge(world, current, component_id, true);
     if (target) return target;
 
     /* Build new component set */
@@ -1514,8 +3767,8 @@ static tecs_archetype_t* tecs_world_get_or_create_archetype_with_component(
     TECS_FREE(new_components);
 
     /* Add graph edge */
-    tecs_archetype_add_edge(current, component_id, target, true);
-    tecs_archetype_add_edge(target, component_id, current, false);
+    tecs_archetype_add_edge(world, current, component_id, target, true);
+    tecs_archetype_add_edge(world, target, component_id, current, false);
 
     return target;
 }
@@ -1524,7 +3777,7 @@ static tecs_archetype_t* tecs_world_get_or_create_archetype_without_component(
     tecs_world_t* world, tecs_archetype_t* current, tecs_component_id_t component_id) {
 
     /* Check graph edge cache */
-    tecs_archetype_t* target = tecs_archetype_find_edge(current, component_id, false);
+    tecs_archetype_t* target = tecs_archetype_find_edge(world, current, component_id, false);
     if (target) return target;
 
     /* Build new component set (remove component) */
@@ -1565,8 +3818,8 @@ static tecs_archetype_t* tecs_world_get_or_create_archetype_without_component(
     TECS_FREE(new_components);
 
     /* Add graph edge */
-    tecs_archetype_add_edge(current, component_id, target, false);
-    tecs_archetype_add_edge(target, component_id, current, true);
+    tecs_archetype_add_edge(world, current, component_id, target, false);
+    tecs_archetype_add_edge(world, target, component_id, current, true);
 
     return target;
 }
@@ -1578,7 +3831,7 @@ static void tecs_copy_component_data(tecs_archetype_t* src_arch, tecs_chunk_t* s
         tecs_component_id_t comp_id = src_arch->data_components[i].id;
 
         /* O(1) hashmap lookup instead of O(n) inner loop */
-        int dst_column_idx = tecs_component_map_get(&dst_arch->data_component_map, comp_id);
+        int dst_column_idx = tecs_archetype_column_index(dst_arch, comp_id);
         if (dst_column_idx < 0) continue;  /* Component not in destination archetype */
 
         int src_size = src_arch->data_components[i].size;
@@ -1588,60 +3841,75 @@ static void tecs_copy_component_data(tecs_archetype_t* src_arch, tecs_chunk_t* s
         /* Use storage provider copy_data API */
         tecs_column_t* src_column = &src_chunk->columns[i];
         tecs_column_t* dst_column = &dst_chunk->columns[dst_column_idx];
+        const tecs_type_hooks_t* hooks = tecs_column_hooks(src_arch, i);
         
-        dst_column->provider->copy_data(
-            dst_column->provider->user_data,
-            src_column->storage_data,
-            src_row,
-            dst_column->storage_data,
-            dst_row,
-            src_size
-        );
+        if (hooks && hooks->relocate) {
+            /* The source row is swap-removed afterwards, so the value moves */
+            tecs_column_relocate(hooks, src_column, src_row, dst_column, dst_row, 1, src_size);
+        } else {
+            dst_column->provider->copy_data(
+                dst_column->provider->user_data,
+                src_column->storage_data,
+                src_row,
+                dst_column->storage_data,
+                dst_row,
+                src_size
+            );
+        }
 
         /* Copy ticks */
         dst_column->changed_ticks[dst_row] = src_column->changed_ticks[src_row];
         dst_column->added_ticks[dst_row] = src_column->added_ticks[src_row];
+        TECS_TICK_MAX(dst_column->changed_max, src_column->changed_ticks[src_row]);
     }
 }
 
-void tecs_set(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
-              const void* data, int size) {
+/* Store data (copied, or relocated when move is set); false when nothing was stored */
+static bool tecs_set_value(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
+                           void* data, int size, bool move) {
     tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
-    if (!record) return;
+    if (!record || !record->archetype) return false;
 
     tecs_archetype_t* current_arch = record->archetype;
+    tecs_chunk_access(world, current_arch, current_arch->chunks[record->chunk_index]);
 
     /* Check if component already exists */
     int comp_idx = tecs_archetype_find_component(current_arch, component_id);
     if (comp_idx >= 0) {
         /* Update existing component - O(1) hashmap lookup */
-        int column_idx = tecs_component_map_get(&current_arch->data_component_map, component_id);
+        int column_idx = tecs_archetype_column_index(current_arch, component_id);
         if (column_idx < 0) {
-            return;  /* Tag component, no data to update */
+            return false;  /* Tag component, no data to update */
         }
         
         int chunk_idx = record->chunk_index;
         int row = record->row % TECS_CHUNK_SIZE;
         tecs_chunk_t* chunk = current_arch->chunks[chunk_idx];
         tecs_column_t* column = &chunk->columns[column_idx];
+        const tecs_type_hooks_t* hooks = tecs_column_hooks(current_arch, column_idx);
         
-        /* Use storage provider API */
-        column->provider->set_data(
-            column->provider->user_data,
-            column->storage_data,
-            row,
-            data,
-            size
-        );
+        if (hooks) {
+            tecs_column_assign(hooks, column, row, data, current_arch->data_components[column_idx].size, move);
+        } else {
+            /* Use storage provider API */
+            column->provider->set_data(
+                column->provider->user_data,
+                column->storage_data,
+                row,
+                data,
+                size
+            );
+        }
         column->changed_ticks[row] = world->tick;
-        return;
+        TECS_TICK_MAX(column->changed_max, world->tick);
+        return true;
     }
 
     /* Need to add component (archetype transition) */
     tecs_archetype_t* new_arch = tecs_world_get_or_create_archetype_with_component(
         world, current_arch, component_id, size);
 
-    if (new_arch == current_arch) return;
+    if (new_arch == current_arch) return false;
 
     /* Get old chunk location */
     int old_chunk_idx = record->chunk_index;
@@ -1661,24 +3929,63 @@ void tecs_set(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t com
                             new_arch, new_chunk, new_row);
 
     /* Set new component data - O(1) hashmap lookup */
-    int new_column_idx = tecs_component_map_get(&new_arch->data_component_map, component_id);
+    int new_column_idx = tecs_archetype_column_index(new_arch, component_id);
     if (new_column_idx >= 0) {
         tecs_column_t* new_column = &new_chunk->columns[new_column_idx];
+        const tecs_type_hooks_t* hooks = tecs_column_hooks(new_arch, new_column_idx);
         
-        /* Use storage provider API */
-        new_column->provider->set_data(
-            new_column->provider->user_data,
-            new_column->storage_data,
-            new_row,
-            data,
-            size
-        );
+        if (hooks) {
+            tecs_column_init(hooks, new_column, new_row, data, new_arch->data_components[new_column_idx].size, move);
+        } else {
+            /* Use storage provider API */
+            new_column->provider->set_data(
+                new_column->provider->user_data,
+                new_column->storage_data,
+                new_row,
+                data,
+                size
+            );
+        }
         new_column->changed_ticks[new_row] = world->tick;
         new_column->added_ticks[new_row] = world->tick;
+        TECS_TICK_MAX(new_column->changed_max, world->tick);
     }
 
     /* Remove from old archetype */
-    tecs_archetype_remove_entity(current_arch, old_chunk_idx, old_row);
+    tecs_archetype_remove_entity(world, current_arch, old_chunk_idx, old_row);
+    return new_column_idx >= 0;
+}
+
+void tecs_set(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
+              const void* data, int size) {
+    if (world->trace) tecs_trace_component_op(world, TECS_TRACE_SET, entity, component_id);
+    if (world->in_deferred) {
+        tecs_defer_command(world, TECS_CMD_SET_COMPONENT, entity, component_id, data, size);
+        return;
+    }
+    tecs_set_value(world, entity, component_id, (void*)data, size, false);
+}
+
+void tecs_set_move(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id,
+                   void* data, int size) {
+    if (world->trace) tecs_trace_component_op(world, TECS_TRACE_SET, entity, component_id);
+    if (world->in_deferred) {
+        /* The command owns the value until it is applied or dropped */
+        tecs_command_t* cmd = tecs_command_push(&world->command_buffer, &world->command_count,
+                                                &world->command_capacity, TECS_CMD_SET_COMPONENT,
+                                                entity, component_id, NULL, size);
+        if (data && size > 0) {
+            const tecs_type_hooks_t* hooks = tecs_component_hooks(world, component_id);
+            cmd->data = TECS_MALLOC(size);
+            if (hooks && hooks->relocate) hooks->relocate(cmd->data, data, 1, hooks->user_data);
+            else memcpy(cmd->data, data, size);
+            cmd->move = true;
+        }
+        return;
+    }
+    if (!tecs_set_value(world, entity, component_id, data, size, true)) {
+        tecs_value_destroy(world, component_id, data);
+    }
 }
 
 void* tecs_get(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id) {
@@ -1688,12 +3995,13 @@ void* tecs_get(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t co
     tecs_archetype_t* arch = record->archetype;
 
     /* O(1) hashmap lookup instead of O(n) linear search */
-    int column_idx = tecs_component_map_get(&arch->data_component_map, component_id);
+    int column_idx = tecs_archetype_column_index(arch, component_id);
     if (column_idx < 0) return NULL;  /* Component not found or is a tag */
 
     int chunk_idx = record->chunk_index;
     int row = record->row % TECS_CHUNK_SIZE;
     tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+    tecs_chunk_access(world, arch, chunk);
     tecs_column_t* column = &chunk->columns[column_idx];
     
     /* Use storage provider API */
@@ -1718,11 +4026,18 @@ bool tecs_has(const tecs_world_t* world, tecs_entity_t entity, tecs_component_id
 }
 
 void tecs_unset(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t component_id) {
+    if (world->trace) tecs_trace_component_op(world, TECS_TRACE_UNSET, entity, component_id);
+    if (world->in_deferred) {
+        tecs_defer_command(world, TECS_CMD_UNSET_COMPONENT, entity, component_id, NULL, 0);
+        return;
+    }
+
     tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
     if (!record || !record->archetype) return;
 
     tecs_archetype_t* current_arch = record->archetype;
     if (!tecs_archetype_has_component(current_arch, component_id)) return;
+    tecs_chunk_access(world, current_arch, current_arch->chunks[record->chunk_index]);
 
     /* Get new archetype without component */
     tecs_archetype_t* new_arch = tecs_world_get_or_create_archetype_without_component(
@@ -1736,6 +4051,13 @@ void tecs_unset(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t c
     tecs_chunk_t* old_chunk = current_arch->chunks[old_chunk_idx];
     tecs_entity_t entity_id = old_chunk->entities[old_row];
 
+    /* The removed component is destroyed; the rest are relocated below */
+    int column_idx = tecs_archetype_column_index(current_arch, component_id);
+    if (column_idx >= 0) {
+        tecs_column_destruct(tecs_column_hooks(current_arch, column_idx), &old_chunk->columns[column_idx],
+                             old_row, 1, current_arch->data_components[column_idx].size);
+    }
+
     /* Add to new archetype */
     tecs_archetype_add_entity(world, new_arch, entity_id, record, world->tick);
 
@@ -1744,303 +4066,3279 @@ void tecs_unset(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t c
     int new_row = record->row % TECS_CHUNK_SIZE;
     tecs_chunk_t* new_chunk = new_arch->chunks[new_chunk_idx];
 
-    tecs_copy_component_data(current_arch, old_chunk, old_row,
-                            new_arch, new_chunk, new_row);
+    tecs_copy_component_data(current_arch, old_chunk, old_row,
+                            new_arch, new_chunk, new_row);
+
+    /* Remove from old archetype */
+    tecs_archetype_remove_entity(world, current_arch, old_chunk_idx, old_row);
+}
+
+void tecs_add_tag(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t tag_id) {
+    /* Tags are zero-sized components */
+    tecs_set(world, entity, tag_id, NULL, 0);
+}
+
+void tecs_mark_changed(tecs_world_t* world, tecs_entity_t entity,
+                      tecs_component_id_t component_id) {
+    tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
+    if (!record || !record->archetype) return;
+
+    tecs_archetype_t* arch = record->archetype;
+    
+    /* O(1) hashmap lookup instead of O(n) linear search */
+    int column_idx = tecs_archetype_column_index(arch, component_id);
+    if (column_idx < 0) return;  /* Component not found or is a tag */
+    
+    int chunk_idx = record->chunk_index;
+    int row = record->row % TECS_CHUNK_SIZE;
+    tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+    tecs_chunk_access(world, arch, chunk);
+    chunk->columns[column_idx].changed_ticks[row] = world->tick;
+    TECS_TICK_MAX(chunk->columns[column_idx].changed_max, world->tick);
+}
+
+/* ============================================================================
+ * Query Operations
+ * ========================================================================= */
+
+tecs_query_t* tecs_query_new(tecs_world_t* world) {
+    tecs_query_t* query = TECS_CALLOC(1, sizeof(tecs_query_t));
+    query->world = world;
+    query->term_count = 0;
+    query->matched_capacity = 16;
+    query->matched_archetypes = TECS_MALLOC(query->matched_capacity * sizeof(tecs_archetype_t*));
+    query->matched_count = 0;
+    query->last_structural_version = 0;
+    query->built = false;
+    tecs_query_set_prefetch(query, TECS_PREFETCH_DISTANCE);
+
+    if (world->query_count >= world->query_capacity) {
+        world->query_capacity = world->query_capacity ? world->query_capacity * 2 : 16;
+        world->queries = TECS_REALLOC(world->queries, world->query_capacity * sizeof(tecs_query_t*));
+    }
+    world->queries[world->query_count++] = query;
+    return query;
+}
+
+void tecs_query_free(tecs_query_t* query) {
+    if (!query) return;
+    tecs_world_t* world = query->world;
+    if (world) {
+        for (int i = 0; i < world->query_count; i++) {
+            if (world->queries[i] == query) {
+                world->queries[i] = world->queries[--world->query_count];
+                break;
+            }
+        }
+    }
+    TECS_FREE(query->matched_archetypes);
+    TECS_FREE(query);
+}
+
+static void tecs_query_add_term(tecs_query_t* query, tecs_term_type_t type,
+                               tecs_component_id_t component_id) {
+    if (query->term_count >= TECS_MAX_QUERY_TERMS) return;
+
+    query->terms[query->term_count].type = type;
+    query->terms[query->term_count].component_id = component_id;
+    query->terms[query->term_count].data_index = -1;
+    query->term_count++;
+}
+
+void tecs_query_with(tecs_query_t* query, tecs_component_id_t component_id) {
+    tecs_query_add_term(query, TECS_TERM_WITH, component_id);
+}
+
+void tecs_query_without(tecs_query_t* query, tecs_component_id_t component_id) {
+    tecs_query_add_term(query, TECS_TERM_WITHOUT, component_id);
+}
+
+void tecs_query_optional(tecs_query_t* query, tecs_component_id_t component_id) {
+    tecs_query_add_term(query, TECS_TERM_OPTIONAL, component_id);
+}
+
+void tecs_query_changed(tecs_query_t* query, tecs_component_id_t component_id) {
+    tecs_query_add_term(query, TECS_TERM_CHANGED, component_id);
+}
+
+void tecs_query_added(tecs_query_t* query, tecs_component_id_t component_id) {
+    tecs_query_add_term(query, TECS_TERM_ADDED, component_id);
+}
+
+static bool tecs_archetype_matches_query(const tecs_archetype_t* arch, const tecs_query_t* query) {
+    for (int i = 0; i < query->term_count; i++) {
+        const tecs_query_term_t* term = &query->terms[i];
+        bool has = tecs_archetype_has_component(arch, term->component_id);
+
+        switch (term->type) {
+            case TECS_TERM_WITH:
+            case TECS_TERM_CHANGED:
+            case TECS_TERM_ADDED:
+                if (!has) return false;
+                break;
+            case TECS_TERM_WITHOUT:
+                if (has) return false;
+                break;
+            case TECS_TERM_OPTIONAL:
+                /* Always matches */
+                break;
+        }
+    }
+    return true;
+}
+
+static int tecs_compare_archetype_id(const void* a, const void* b) {
+    uint64_t id_a = (*(const tecs_archetype_t* const*)a)->id;
+    uint64_t id_b = (*(const tecs_archetype_t* const*)b)->id;
+    return (id_a > id_b) - (id_a < id_b);
+}
+
+/* Matches are kept in ascending archetype ID order: resumable cursors binary-search
+ * them and parallel runs partition in that order */
+void tecs_query_build(tecs_query_t* query) {
+    query->matched_count = 0;
+
+    /* Match against all archetypes - iterate through hash table capacity */
+    for (int i = 0; i < query->world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = query->world->archetype_table[i].archetype;
+        if (arch && tecs_archetype_matches_query(arch, query)) {
+            if (query->matched_count >= query->matched_capacity) {
+                query->matched_capacity *= 2;
+                query->matched_archetypes = TECS_REALLOC(query->matched_archetypes,
+                    query->matched_capacity * sizeof(tecs_archetype_t*));
+            }
+            query->matched_archetypes[query->matched_count++] = arch;
+        }
+    }
+    qsort(query->matched_archetypes, query->matched_count, sizeof(tecs_archetype_t*), tecs_compare_archetype_id);
+
+    query->last_structural_version = query->world->structural_change_version;
+    query->built = true;
+    if (query->world->trace) tecs_trace_query(query->world, query);
+}
+
+/* ============================================================================
+ * Query Iteration
+ * ========================================================================= */
+
+void tecs_query_iter_init(tecs_query_iter_t* iter, tecs_query_t* query) {
+    /* Rebuild if world structure changed */
+    if (!query->built ||
+        query->last_structural_version != query->world->structural_change_version) {
+        tecs_query_build(query);
+    }
+
+    iter->query = query;
+    iter->archetype_index = 0;
+    iter->chunk_index = -1;
+    iter->current_chunk = NULL;
+    iter->current_archetype = NULL;
+    iter->row_start = 0;
+    iter->row_end = -1;
+    iter->cursor = NULL;
+    iter->rows_left = -1;
+}
+
+tecs_query_iter_t* tecs_query_iter(tecs_query_t* query) {
+    tecs_query_iter_t* iter = TECS_CALLOC(1, sizeof(tecs_query_iter_t));
+    tecs_query_iter_init(iter, query);
+    return iter;
+}
+
+tecs_query_iter_t* tecs_query_iter_cached(tecs_query_t* query) {
+    tecs_query_iter_init(&query->cached_iter, query);
+    return &query->cached_iter;
+}
+
+tecs_query_iter_t* tecs_query_iter_resume(tecs_query_t* query, tecs_query_cursor_t* cursor,
+                                          int max_rows) {
+    tecs_query_iter_t* iter = tecs_query_iter(query);
+    iter->cursor = cursor;
+    iter->rows_left = max_rows > 0 ? max_rows : -1;
+    return iter;
+}
+
+/* Matched archetype with the smallest ID >= id */
+static tecs_archetype_t* tecs_query_archetype_from(const tecs_query_t* query, uint64_t id) {
+    int lo = 0, hi = query->matched_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (query->matched_archetypes[mid]->id < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < query->matched_count ? query->matched_archetypes[lo] : NULL;
+}
+
+static bool tecs_iter_next_resume(tecs_query_iter_t* iter) {
+    tecs_query_cursor_t* cursor = iter->cursor;
+    const tecs_query_t* query = iter->query;
+
+    if (iter->rows_left == 0) return false;
+
+    for (;;) {
+        tecs_archetype_t* arch = tecs_query_archetype_from(query, cursor->archetype_id);
+        if (!arch) break;
+
+        if (arch->id != cursor->archetype_id) {
+            cursor->archetype_id = arch->id;
+            cursor->chunk_index = 0;
+            cursor->row = 0;
+        }
+
+        while (cursor->chunk_index < arch->chunk_count) {
+            tecs_chunk_t* chunk = arch->chunks[cursor->chunk_index];
+            if (cursor->row < chunk->count && !(chunk->hibernated && query->skip_hibernated)) {
+                int end = chunk->count;
+                if (iter->rows_left > 0 && end - cursor->row > iter->rows_left) {
+                    end = cursor->row + iter->rows_left;
+                }
+                if (iter->rows_left > 0) iter->rows_left -= end - cursor->row;
+
+                tecs_chunk_access(query->world, arch, chunk);
+                iter->current_archetype = arch;
+                iter->current_chunk = chunk;
+                iter->row_start = cursor->row;
+                iter->row_end = end;
+                cursor->row = end;
+                return true;
+            }
+            cursor->chunk_index++;
+            cursor->row = 0;
+        }
+
+        if (arch->id == UINT64_MAX) break;
+        cursor->archetype_id = arch->id + 1;
+        cursor->chunk_index = 0;
+        cursor->row = 0;
+    }
+
+    /* End of pass: rewind for the next call */
+    cursor->archetype_id = 0;
+    cursor->chunk_index = 0;
+    cursor->row = 0;
+    cursor->passes++;
+    iter->current_chunk = NULL;
+    iter->current_archetype = NULL;
+    return false;
+}
+
+void tecs_query_set_prefetch(tecs_query_t* query, int distance) {
+    query->prefetch_distance = distance < 0 ? 0 : distance > 16 ? 16 : distance;
+}
+
+/* Prefetch the chunks after the current one. Column data sits behind three dependent
+ * loads (chunk -> columns -> storage -> data), so each level is requested a step before
+ * it is dereferenced: the farthest chunk gets its header and first entity IDs, the next
+ * nearer its column array, then its storage headers, and the nearest ones the first
+ * lines of every queried column. Stage s lands distance - s chunks ahead, so storage
+ * headers need a distance of 3 and column data 4; shorter distances drop those stages
+ * rather than stall on pointers that are not cached yet. */
+static void tecs_iter_prefetch(const tecs_query_iter_t* iter) {
+    const tecs_query_t* query = iter->query;
+    int distance = query->prefetch_distance;
+    tecs_archetype_t* archs[16];
+    tecs_chunk_t* chunks[16];
+    int found = 0;
+
+    /* Only chunk pointers are read here, never the chunks themselves */
+    int a = iter->archetype_index;
+    int c = iter->chunk_index + 1;
+    while (found < distance && a < query->matched_count) {
+        tecs_archetype_t* arch = query->matched_archetypes[a];
+        if (c < arch->chunk_count) {
+            archs[found] = arch;
+            chunks[found++] = arch->chunks[c++];
+        } else {
+            a++;
+            c = 0;
+        }
+    }
+    if (found == 0) return;
+
+    /* Stage 0: header fields and the start of the entity array */
+    tecs_chunk_t* far = chunks[found - 1];
+    TECS_PREFETCH(&far->columns);
+    TECS_PREFETCH(&far->hibernated);
+    TECS_PREFETCH(far->entities);
+
+    for (int stage = 1; stage <= 3; stage++) {
+        int i = distance - 1 - stage;
+        if (i < 0 || i >= found) break;
+
+        tecs_chunk_t* chunk = chunks[i];
+        tecs_archetype_t* arch = archs[i];
+        if (chunk->hibernated || !chunk->columns) continue;
+
+        if (stage == 1) {
+            const char* cols = (const char*)chunk->columns;
+            size_t bytes = (size_t)arch->data_component_count * sizeof(tecs_column_t);
+            for (size_t off = 0; off < bytes; off += 64) TECS_PREFETCH(cols + off);
+            continue;
+        }
+
+        for (int t = 0; t < query->term_count; t++) {
+            if (query->terms[t].type == TECS_TERM_WITHOUT) continue;
+            int col = tecs_archetype_column_index(arch, query->terms[t].component_id);
+            if (col < 0) continue;
+
+            tecs_column_t* column = &chunk->columns[col];
+            if (stage == 2) {
+                TECS_PREFETCH(column->storage_data);
+            } else if (column->is_native_storage && column->storage_data) {
+                const char* data = (const char*)((tecs_native_storage_t*)column->storage_data)->data;
+                TECS_PREFETCH(data);
+                TECS_PREFETCH(data + 64);
+            }
+        }
+    }
+}
+
+bool tecs_iter_next(tecs_query_iter_t* iter) {
+    if (!iter || !iter->query) return false;
+    if (iter->cursor) return tecs_iter_next_resume(iter);
+
+    /* Advance to next chunk */
+    iter->chunk_index++;
+
+    /* Find next non-empty chunk */
+    while (iter->archetype_index < iter->query->matched_count) {
+        iter->current_archetype = iter->query->matched_archetypes[iter->archetype_index];
+
+        if (iter->chunk_index < iter->current_archetype->chunk_count) {
+            iter->current_chunk = iter->current_archetype->chunks[iter->chunk_index];
+            if (iter->current_chunk->count > 0 &&
+                !(iter->current_chunk->hibernated && iter->query->skip_hibernated)) {
+                tecs_chunk_access(iter->query->world, iter->current_archetype, iter->current_chunk);
+                if (iter->query->prefetch_distance > 0) tecs_iter_prefetch(iter);
+                return true;
+            }
+            iter->chunk_index++;
+        } else {
+            /* Move to next archetype */
+            iter->archetype_index++;
+            iter->chunk_index = 0;
+        }
+    }
+
+    if (iter->query->world->trace) tecs_trace_iter(iter->query->world, iter->query);
+    return false;
+}
+
+void tecs_query_iter_free(tecs_query_iter_t* iter) {
+    TECS_FREE(iter);
+}
+
+int tecs_iter_count(const tecs_query_iter_t* iter) {
+    if (!iter->current_chunk) return 0;
+    return (iter->row_end < 0 ? iter->current_chunk->count : iter->row_end) - iter->row_start;
+}
+
+int tecs_iter_offset(const tecs_query_iter_t* iter) {
+    return iter->row_start;
+}
+
+tecs_entity_t* tecs_iter_entities(const tecs_query_iter_t* iter) {
+    return iter->current_chunk ? iter->current_chunk->entities + iter->row_start : NULL;
+}
+
+void* tecs_iter_column(const tecs_query_iter_t* iter, int index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+
+    tecs_column_t* column = &iter->current_chunk->columns[index];
+    
+    /* Fast path for native storage - return raw pointer to array */
+    if (column->is_native_storage) {
+        tecs_native_storage_t* storage = (tecs_native_storage_t*)column->storage_data;
+        return (char*)storage->data +
+               (size_t)iter->row_start * iter->current_archetype->data_components[index].size;
+    }
+    
+    /* Custom storage - return NULL (caller should use tecs_iter_get_at instead) */
+    return NULL;
+}
+
+tecs_tick_t* tecs_iter_changed_ticks(const tecs_query_iter_t* iter, int index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+
+    tecs_tick_t* ticks = iter->current_chunk->columns[index].changed_ticks;
+    return ticks ? ticks + iter->row_start : NULL;
+}
+
+tecs_tick_t* tecs_iter_added_ticks(const tecs_query_iter_t* iter, int index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+
+    tecs_tick_t* ticks = iter->current_chunk->columns[index].added_ticks;
+    return ticks ? ticks + iter->row_start : NULL;
+}
+
+TECS_API int tecs_iter_column_index(const tecs_query_iter_t* iter, tecs_component_id_t component_id) {
+    if (!iter->current_archetype) return -1;
+    return tecs_archetype_column_index(iter->current_archetype, component_id);
+}
+
+TECS_API void* tecs_iter_chunk_data(const tecs_query_iter_t* iter, int column_index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (column_index < 0 || column_index >= iter->current_archetype->data_component_count) return NULL;
+
+    return iter->current_chunk->columns[column_index].storage_data;
+}
+
+tecs_storage_provider_t* tecs_iter_storage_provider(const tecs_query_iter_t* iter, int index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+
+    return iter->current_chunk->columns[index].provider;
+}
+
+void** tecs_iter_boxed(const tecs_query_iter_t* iter, int index) {
+    if (!iter->current_chunk || !iter->current_archetype) return NULL;
+    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+
+    tecs_column_t* column = &iter->current_chunk->columns[index];
+    if (!tecs_storage_is_boxed(column->provider)) return NULL;
+    return (void**)column->storage_data + iter->row_start;
+}
+
+int tecs_query_fill_chunks(tecs_query_t* query, const tecs_component_id_t* components,
+                           int component_count, tecs_chunk_span_t* spans,
+                           void** columns, int capacity) {
+    if (!query || component_count < 0 || component_count > 32) return -1;
+    if (!query->built || query->last_structural_version != query->world->structural_change_version) {
+        tecs_query_build(query);
+    }
+
+    int total = 0;
+    for (int a = 0; a < query->matched_count; a++) {
+        tecs_archetype_t* arch = query->matched_archetypes[a];
+        int column_index[32];
+        for (int c = 0; c < component_count; c++) {
+            column_index[c] = tecs_archetype_column_index(arch, components[c]);
+        }
+
+        for (int k = 0; k < arch->chunk_count; k++) {
+            tecs_chunk_t* chunk = arch->chunks[k];
+            if (chunk->count == 0 || (chunk->hibernated && query->skip_hibernated)) continue;
+            if (total < capacity) {
+                tecs_chunk_access(query->world, arch, chunk);
+
+                tecs_chunk_span_t* span = &spans[total];
+                span->entities = chunk->entities;
+                span->columns = columns + (size_t)total * component_count;
+                span->count = chunk->count;
+                span->custom_mask = 0;
+                for (int c = 0; c < component_count; c++) {
+                    void* ptr = NULL;
+                    if (column_index[c] >= 0) {
+                        tecs_column_t* column = &chunk->columns[column_index[c]];
+                        if (column->is_native_storage) {
+                            ptr = ((tecs_native_storage_t*)column->storage_data)->data;
+                        } else {
+                            ptr = column->storage_data;
+                            span->custom_mask |= 1u << c;
+                        }
+                    }
+                    span->columns[c] = ptr;
+                }
+            }
+            total++;
+        }
+    }
+    return total;
+}
+
+/* ============================================================================
+ * Deferred Operations
+ * ========================================================================= */
+
+static int tecs_archetype_reserve_rows(tecs_world_t* world, tecs_archetype_t* arch, int rows);
+
+void tecs_begin_deferred(tecs_world_t* world) {
+    if (world->trace) tecs_trace_open(world, TECS_TRACE_DEFER_BEGIN);
+    world->in_deferred = true;
+}
+
+void tecs_set_deferred_pool(tecs_world_t* world, tecs_task_pool_t* pool) {
+    world->deferred_pool = pool;
+}
+
+/* Apply one queued command. With release_index false a delete only frees the row and
+ * leaves the record without an archetype; the caller removes the ID afterwards. */
+static void tecs_apply_command(tecs_world_t* world, tecs_command_t* cmd, bool release_index) {
+    switch (cmd->type) {
+        case TECS_CMD_SET_COMPONENT:
+            if (cmd->move) {
+                cmd->move = false;  /* Consumed either way */
+                tecs_set_move(world, cmd->entity, cmd->component_id, cmd->data, cmd->size);
+            } else {
+                tecs_set(world, cmd->entity, cmd->component_id, cmd->data, cmd->size);
+            }
+            break;
+
+        case TECS_CMD_UNSET_COMPONENT:
+            tecs_unset(world, cmd->entity, cmd->component_id);
+            break;
+
+        case TECS_CMD_DELETE_ENTITY:
+            if (release_index) {
+                tecs_entity_delete(world, cmd->entity);
+            } else {
+                tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, cmd->entity);
+                if (record && record->archetype) {
+                    tecs_entity_release_row(world, record);
+                    record->archetype = NULL;
+                }
+            }
+            break;
+    }
+}
+
+/* Archetype touched by a deferred batch. Node 0 has no archetype: everything joined
+ * to it runs in one group because its hooks or storage providers may share state. */
+typedef struct {
+    tecs_archetype_t* archetype;
+    int parent;  /* Union-find over archetypes that exchange entities */
+    int count;   /* Simulated entity count */
+    int peak;
+} tecs_defer_node_t;
+
+/* Simulated archetype of an entity named by the batch */
+typedef struct {
+    tecs_entity_t entity;
+    tecs_archetype_t* archetype;
+    bool used;
+} tecs_defer_entity_t;
+
+typedef struct {
+    tecs_defer_node_t* nodes;
+    int node_count;
+    int node_capacity;
+    tecs_defer_entity_t* entities;  /* Open addressing, power-of-two capacity */
+    int entity_capacity;
+} tecs_defer_plan_t;
+
+typedef struct {
+    tecs_world_t* world;
+    int* order;        /* Command indices by group, in command order within each */
+    int* group_start;  /* group_count + 1 offsets into order */
+} tecs_defer_job_t;
+
+static int tecs_defer_find(tecs_defer_node_t* nodes, int node) {
+    while (nodes[node].parent != node) {
+        nodes[node].parent = nodes[nodes[node].parent].parent;
+        node = nodes[node].parent;
+    }
+    return node;
+}
+
+/* The lower node becomes the root, so node 0 always roots its set */
+static void tecs_defer_union(tecs_defer_node_t* nodes, int a, int b) {
+    a = tecs_defer_find(nodes, a);
+    b = tecs_defer_find(nodes, b);
+    if (a < b) nodes[b].parent = a;
+    else if (b < a) nodes[a].parent = b;
+}
+
+static bool tecs_archetype_needs_serial(const tecs_world_t* world, const tecs_archetype_t* arch) {
+    if (arch->hooks) return true;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        int index = tecs_component_map_get(&world->component_registry_map, arch->data_components[i].id);
+        tecs_storage_provider_t* provider = index >= 0 ? world->component_registry[index].storage_provider : NULL;
+        if (provider && provider != &tecs_default_storage) return true;
+    }
+    return false;
+}
+
+static int tecs_defer_node(tecs_world_t* world, tecs_defer_plan_t* plan, tecs_archetype_t* arch) {
+    int node = arch->defer_node;
+    if (node > 0 && node < plan->node_count && plan->nodes[node].archetype == arch) return node;
+
+    if (plan->node_count >= plan->node_capacity) {
+        plan->node_capacity *= 2;
+        plan->nodes = TECS_REALLOC(plan->nodes, plan->node_capacity * sizeof(tecs_defer_node_t));
+    }
+    node = plan->node_count++;
+    plan->nodes[node].archetype = arch;
+    plan->nodes[node].parent = node;
+    plan->nodes[node].count = arch->entity_count;
+    plan->nodes[node].peak = arch->entity_count;
+    arch->defer_node = node;
+
+    /* Thawing allocates and updates world totals, so workers must find chunks awake */
+    for (int c = 0; c < arch->chunk_count; c++) {
+        if (arch->chunks[c]->hibernated) tecs_chunk_thaw(world, arch, arch->chunks[c]);
+    }
+    if (tecs_archetype_needs_serial(world, arch)) tecs_defer_union(plan->nodes, node, 0);
+    return node;
+}
+
+static tecs_defer_entity_t* tecs_defer_entity(tecs_world_t* world, tecs_defer_plan_t* plan,
+                                              tecs_entity_t entity) {
+    size_t mask = (size_t)plan->entity_capacity - 1;
+    size_t slot = tecs_hash_u64(entity) & mask;
+    while (plan->entities[slot].used) {
+        if (plan->entities[slot].entity == entity) return &plan->entities[slot];
+        slot = (slot + 1) & mask;
+    }
+
+    tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
+    tecs_defer_entity_t* entry = &plan->entities[slot];
+    entry->used = true;
+    entry->entity = entity;
+    entry->archetype = record ? record->archetype : NULL;
+    return entry;
+}
+
+static void tecs_defer_run_group(void* arg, int index, int worker) {
+    tecs_defer_job_t* job = (tecs_defer_job_t*)arg;
+    (void)worker;
+    for (int i = job->group_start[index]; i < job->group_start[index + 1]; i++) {
+        tecs_apply_command(job->world, &job->world->command_buffer[job->order[i]], false);
+    }
+}
+
+/* Walk the batch serially, tracking where each entity would be, so archetypes and
+ * edges are created in the same order as a serial apply and each archetype's peak
+ * row count is known. Entities that only ever touch disjoint sets of archetypes end
+ * up in different groups; rows, records and swap-removes of an archetype are only
+ * ever written by its own group. */
+static void tecs_end_deferred_parallel(tecs_world_t* world) {
+    int count = world->command_count;
+
+    tecs_defer_plan_t plan;
+    plan.node_capacity = 64;
+    plan.node_count = 1;
+    plan.nodes = TECS_MALLOC(plan.node_capacity * sizeof(tecs_defer_node_t));
+    plan.nodes[0].archetype = NULL;
+    plan.nodes[0].parent = 0;
+    plan.entity_capacity = 16;
+    while (plan.entity_capacity < count * 2) plan.entity_capacity *= 2;
+    plan.entities = TECS_CALLOC(plan.entity_capacity, sizeof(tecs_defer_entity_t));
+
+    int* command_node = TECS_MALLOC(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        tecs_command_t* cmd = &world->command_buffer[i];
+        tecs_defer_entity_t* entry = tecs_defer_entity(world, &plan, cmd->entity);
+        tecs_archetype_t* src = entry->archetype;
+        command_node[i] = -1;
+        if (!src) continue;  /* Dead or unloaded: only a delete has an effect, below */
+
+        int src_node = tecs_defer_node(world, &plan, src);
+        tecs_archetype_t* dst = src;
+        if (cmd->type == TECS_CMD_SET_COMPONENT) {
+            if (!tecs_archetype_has_component(src, cmd->component_id)) {
+                dst = tecs_world_get_or_create_archetype_with_component(world, src, cmd->component_id, cmd->size);
+            }
+        } else if (cmd->type == TECS_CMD_UNSET_COMPONENT) {
+            if (!tecs_archetype_has_component(src, cmd->component_id)) continue;
+            dst = tecs_world_get_or_create_archetype_without_component(world, src, cmd->component_id);
+        } else {
+            dst = NULL;
+        }
+
+        if (dst != src) {
+            plan.nodes[src_node].count--;
+            if (dst) {
+                int dst_node = tecs_defer_node(world, &plan, dst);
+                tecs_defer_node_t* node = &plan.nodes[dst_node];
+                if (++node->count > node->peak) node->peak = node->count;
+                tecs_defer_union(plan.nodes, src_node, dst_node);
+            }
+            entry->archetype = dst;
+        }
+        command_node[i] = src_node;
+    }
+
+    /* Reserve each archetype's peak so no worker appends a chunk */
+    for (int n = 1; n < plan.node_count; n++) {
+        tecs_defer_node_t* node = &plan.nodes[n];
+        if (node->peak > node->archetype->entity_count) {
+            tecs_archetype_reserve_rows(world, node->archetype, node->peak - node->archetype->entity_count);
+        }
+    }
+
+    /* Number the groups and bucket commands by group, keeping command order */
+    int* group_of_root = TECS_MALLOC(plan.node_count * sizeof(int));
+    int group_count = 0;
+    for (int n = 0; n < plan.node_count; n++) group_of_root[n] = -1;
+    for (int i = 0; i < count; i++) {
+        if (command_node[i] < 0) continue;
+        int root = tecs_defer_find(plan.nodes, command_node[i]);
+        if (group_of_root[root] < 0) group_of_root[root] = group_count++;
+        command_node[i] = group_of_root[root];
+    }
+
+    tecs_defer_job_t job;
+    job.world = world;
+    job.group_start = TECS_CALLOC(group_count + 1, sizeof(int));
+    job.order = TECS_MALLOC((count > 0 ? count : 1) * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        if (command_node[i] >= 0) job.group_start[command_node[i] + 1]++;
+    }
+    for (int g = 0; g < group_count; g++) job.group_start[g + 1] += job.group_start[g];
+    int* fill = TECS_MALLOC((group_count > 0 ? group_count : 1) * sizeof(int));
+    memcpy(fill, job.group_start, group_count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        if (command_node[i] >= 0) job.order[fill[command_node[i]]++] = i;
+    }
+
+    tecs_task_pool_run(world->deferred_pool, group_count, tecs_defer_run_group, &job);
+
+    /* The entity index is shared: release deleted IDs in command order */
+    for (int i = 0; i < count; i++) {
+        tecs_command_t* cmd = &world->command_buffer[i];
+        if (cmd->type != TECS_CMD_DELETE_ENTITY) continue;
+        tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, cmd->entity);
+        if (record && !record->archetype) tecs_sparse_set_remove(&world->entities, cmd->entity);
+    }
+
+    TECS_FREE(fill);
+    TECS_FREE(job.order);
+    TECS_FREE(job.group_start);
+    TECS_FREE(group_of_root);
+    TECS_FREE(command_node);
+    TECS_FREE(plan.entities);
+    TECS_FREE(plan.nodes);
+}
+
+void tecs_end_deferred(tecs_world_t* world) {
+    world->in_deferred = false;
+    if (world->trace) {
+        tecs_trace_open(world, TECS_TRACE_DEFER_END);
+        world->trace->mute++;  /* Commands were recorded when queued */
+    }
+
+    /* Apply all deferred commands */
+    if (world->deferred_pool && tecs_task_pool_size(world->deferred_pool) > 1 &&
+        world->command_count >= TECS_DEFER_PARALLEL_MIN) {
+        tecs_end_deferred_parallel(world);
+    } else {
+        for (int i = 0; i < world->command_count; i++) {
+            tecs_apply_command(world, &world->command_buffer[i], true);
+        }
+    }
+
+    for (int i = 0; i < world->command_count; i++) {
+        tecs_command_release(world, &world->command_buffer[i]);
+    }
+    world->command_count = 0;
+    if (world->trace) world->trace->mute--;
+}
+
+/* ============================================================================
+ * Deterministic Parallel Execution
+ * ========================================================================= */
+
+typedef struct tecs_par_run_s tecs_par_run_t;
+
+struct tecs_par_ctx_s {
+    tecs_par_run_t* run;
+    int partition;
+    tecs_archetype_t* archetype;
+    tecs_chunk_t* chunk;
+    int row_start;
+    int row_end;
+
+    tecs_command_t* commands;
+    int command_count;
+    int command_capacity;
+
+    uint32_t spawn_count;
+    tecs_entity_t* spawned;  /* Real IDs, filled while merging */
+
+    unsigned char* events;  /* {uint32 type, int32 size, data} records, 8-byte aligned */
+    size_t event_bytes;
+    size_t event_capacity;
+};
+
+struct tecs_par_run_s {
+    tecs_world_t* world;
+    tecs_query_t* query;
+    const tecs_par_desc_t* desc;
+    tecs_par_ctx_t* partitions;
+    int partition_count;
+};
+
+#define TECS_PAR_EVENT_HEADER 8
+#define TECS_PAR_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+static void tecs_par_run_partition(void* arg, int index, int worker) {
+    tecs_par_run_t* run = (tecs_par_run_t*)arg;
+    tecs_par_ctx_t* ctx = &run->partitions[index];
+    (void)worker;
+
+    /* A single-range iterator: tecs_iter_next() on it returns false */
+    tecs_query_iter_t iter;
+    memset(&iter, 0, sizeof(iter));
+    iter.query = run->query;
+    iter.archetype_index = run->query->matched_count;
+    iter.current_archetype = ctx->archetype;
+    iter.current_chunk = ctx->chunk;
+    iter.row_start = ctx->row_start;
+    iter.row_end = ctx->row_end;
+    iter.rows_left = -1;
+    run->desc->kernel(ctx, &iter, run->desc->user_data);
+}
+
+int tecs_query_par_run(tecs_query_t* query, tecs_task_pool_t* pool, const tecs_par_desc_t* desc) {
+    tecs_world_t* world = query->world;
+    if (!query->built || query->last_structural_version != world->structural_change_version) {
+        tecs_query_build(query);
+    }
+
+    /* Fixed partitioning: archetype ID order, storage order, partition_rows each */
+    int rows_per = desc->partition_rows > 0 && desc->partition_rows < TECS_CHUNK_SIZE
+                       ? desc->partition_rows : TECS_CHUNK_SIZE;
+    tecs_archetype_t** archs = TECS_MALLOC((query->matched_count + 1) * sizeof(tecs_archetype_t*));
+    memcpy(archs, query->matched_archetypes, query->matched_count * sizeof(tecs_archetype_t*));
+
+    int count = 0;
+    for (int a = 0; a < query->matched_count; a++) {
+        for (int c = 0; c < archs[a]->chunk_count; c++) {
+            tecs_chunk_t* chunk = archs[a]->chunks[c];
+            if (chunk->hibernated && query->skip_hibernated) continue;
+            count += (chunk->count + rows_per - 1) / rows_per;
+        }
+    }
+
+    tecs_par_run_t run;
+    run.world = world;
+    run.query = query;
+    run.desc = desc;
+    run.partition_count = count;
+    run.partitions = TECS_CALLOC(count > 0 ? count : 1, sizeof(tecs_par_ctx_t));
+
+    int index = 0;
+    for (int a = 0; a < query->matched_count; a++) {
+        tecs_archetype_t* arch = archs[a];
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_chunk_t* chunk = arch->chunks[c];
+            if (chunk->count == 0 || (chunk->hibernated && query->skip_hibernated)) continue;
+            tecs_chunk_access(world, arch, chunk);  /* Workers must not thaw */
+            for (int row = 0; row < chunk->count; row += rows_per) {
+                tecs_par_ctx_t* ctx = &run.partitions[index];
+                ctx->run = &run;
+                ctx->partition = index++;
+                ctx->archetype = arch;
+                ctx->chunk = chunk;
+                ctx->row_start = row;
+                ctx->row_end = row + rows_per < chunk->count ? row + rows_per : chunk->count;
+            }
+        }
+    }
+    TECS_FREE(archs);
+
+    if (pool) {
+        tecs_task_pool_run(pool, count, tecs_par_run_partition, &run);
+    } else {
+        for (int i = 0; i < count; i++) tecs_par_run_partition(&run, i, 0);
+    }
+
+    /* Spawns, in partition order */
+    for (int i = 0; i < count; i++) {
+        tecs_par_ctx_t* ctx = &run.partitions[i];
+        if (ctx->spawn_count == 0) continue;
+        ctx->spawned = TECS_MALLOC(ctx->spawn_count * sizeof(tecs_entity_t));
+        for (uint32_t s = 0; s < ctx->spawn_count; s++) ctx->spawned[s] = tecs_entity_new(world);
+    }
+
+    /* Commands: handed to the world buffer as one batch, values are not copied again */
+    bool outer = world->in_deferred;
+    if (!outer) tecs_begin_deferred(world);
+    for (int i = 0; i < count; i++) {
+        tecs_par_ctx_t* ctx = &run.partitions[i];
+        for (int c = 0; c < ctx->command_count; c++) {
+            tecs_command_t* src = &ctx->commands[c];
+            tecs_command_t* cmd = tecs_command_push(&world->command_buffer, &world->command_count,
+                                                    &world->command_capacity, src->type,
+                                                    tecs_par_resolve(ctx, src->entity), src->component_id,
+                                                    NULL, 0);
+            cmd->data = src->data;
+            cmd->size = src->size;
+        }
+    }
+    if (!outer) tecs_end_deferred(world);
+
+    /* Events */
+    for (int i = 0; i < count; i++) {
+        tecs_par_ctx_t* ctx = &run.partitions[i];
+        size_t offset = 0;
+        while (desc->on_event && offset < ctx->event_bytes) {
+            uint32_t type;
+            int32_t size;
+            memcpy(&type, ctx->events + offset, sizeof(type));
+            memcpy(&size, ctx->events + offset + 4, sizeof(size));
+            desc->on_event(ctx, type, ctx->events + offset + TECS_PAR_EVENT_HEADER, size, desc->user_data);
+            offset += TECS_PAR_EVENT_HEADER + TECS_PAR_ALIGN((size_t)size);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        TECS_FREE(run.partitions[i].commands);
+        TECS_FREE(run.partitions[i].spawned);
+        TECS_FREE(run.partitions[i].events);
+    }
+    TECS_FREE(run.partitions);
+    return count;
+}
+
+int tecs_par_partition(const tecs_par_ctx_t* ctx) {
+    return ctx->partition;
+}
+
+tecs_entity_t tecs_par_spawn(tecs_par_ctx_t* ctx) {
+    return TECS_ENTITY_PROVISIONAL | ((uint64_t)ctx->partition << 32) | ctx->spawn_count++;
+}
+
+void tecs_par_set(tecs_par_ctx_t* ctx, tecs_entity_t entity, tecs_component_id_t component_id,
+                  const void* data, int size) {
+    tecs_command_push(&ctx->commands, &ctx->command_count, &ctx->command_capacity,
+                      TECS_CMD_SET_COMPONENT, entity, component_id, data, size);
+}
+
+void tecs_par_unset(tecs_par_ctx_t* ctx, tecs_entity_t entity, tecs_component_id_t component_id) {
+    tecs_command_push(&ctx->commands, &ctx->command_count, &ctx->command_capacity,
+                      TECS_CMD_UNSET_COMPONENT, entity, component_id, NULL, 0);
+}
+
+void tecs_par_delete(tecs_par_ctx_t* ctx, tecs_entity_t entity) {
+    tecs_command_push(&ctx->commands, &ctx->command_count, &ctx->command_capacity,
+                      TECS_CMD_DELETE_ENTITY, entity, 0, NULL, 0);
+}
+
+void tecs_par_emit(tecs_par_ctx_t* ctx, uint32_t type, const void* data, int size) {
+    if (size < 0) size = 0;
+    size_t needed = ctx->event_bytes + TECS_PAR_EVENT_HEADER + TECS_PAR_ALIGN((size_t)size);
+    if (needed > ctx->event_capacity) {
+        size_t capacity = ctx->event_capacity > 0 ? ctx->event_capacity : 256;
+        while (capacity < needed) capacity *= 2;
+        ctx->events = TECS_REALLOC(ctx->events, capacity);
+        ctx->event_capacity = capacity;
+    }
+
+    int32_t stored_size = size;
+    unsigned char* record = ctx->events + ctx->event_bytes;
+    memcpy(record, &type, sizeof(type));
+    memcpy(record + 4, &stored_size, sizeof(stored_size));
+    if (size > 0) memcpy(record + TECS_PAR_EVENT_HEADER, data, (size_t)size);
+    ctx->event_bytes = needed;
+}
+
+tecs_entity_t tecs_par_resolve(const tecs_par_ctx_t* ctx, tecs_entity_t entity) {
+    if (!(entity & TECS_ENTITY_PROVISIONAL)) return entity;
+
+    uint32_t partition = (uint32_t)((entity >> 32) & 0x7FFFFFFFu);
+    uint32_t spawn = TECS_ENTITY_INDEX(entity);
+    if (partition >= (uint32_t)ctx->run->partition_count) return TECS_ENTITY_NULL;
+
+    const tecs_par_ctx_t* owner = &ctx->run->partitions[partition];
+    if (!owner->spawned || spawn >= owner->spawn_count) return TECS_ENTITY_NULL;
+    return owner->spawned[spawn];
+}
+
+/* ============================================================================
+ * Memory Management
+ * ========================================================================= */
+
+/* Tick of the last structural change seen by an archetype */
+static tecs_tick_t tecs_archetype_last_used(const tecs_archetype_t* arch) {
+    tecs_tick_t last = arch->created_tick;
+    for (int c = 0; c < arch->chunk_count; c++) {
+        if ((tecs_tick_t)(arch->chunks[c]->last_access - last) < UINT32_MAX / 2) {
+            last = arch->chunks[c]->last_access;
+        }
+    }
+    return last;
+}
+
+/* Free every archetype marked for collection: one sweep drops their edges, then
+ * they leave live query matches and become tombstones in the archetype table */
+static void tecs_world_free_marked_archetypes(tecs_world_t* world) {
+    tecs_world_rehash_edges(world, world->edge_capacity);
+
+    for (int q = 0; q < world->query_count; q++) {
+        tecs_query_t* query = world->queries[q];
+        int kept = 0;
+        for (int i = 0; i < query->matched_count; i++) {
+            if (!query->matched_archetypes[i]->gc_marked) {
+                query->matched_archetypes[kept++] = query->matched_archetypes[i];
+            }
+        }
+        query->matched_count = kept;
+    }
+
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch || !arch->gc_marked) continue;
+        world->archetype_table[i].archetype = NULL;
+        world->archetype_table[i].deleted = true;
+        world->archetype_table_size--;
+        world->archetype_table_tombstones++;
+        tecs_archetype_free(arch);
+    }
+}
+
+/* Free idle empty chunks past the first `keep` empty ones, from the end so
+ * entity records keep their chunk indices */
+static int tecs_archetype_trim_chunks(tecs_world_t* world, tecs_archetype_t* arch, int keep,
+                                      tecs_tick_t min_idle) {
+    int empty = 0;
+    for (int c = 0; c < arch->chunk_count; c++) {
+        if (arch->chunks[c]->count == 0) empty++;
+    }
+
+    int freed = 0;
+    while (empty > keep && arch->chunk_count > 0) {
+        tecs_chunk_t* chunk = arch->chunks[arch->chunk_count - 1];
+        if (chunk->count > 0 || (tecs_tick_t)(world->tick - chunk->last_access) < min_idle) break;
+        tecs_chunk_free(chunk, arch->data_component_count);
+        arch->chunk_count--;
+        empty--;
+        freed++;
+    }
+    return freed;
+}
+
+int tecs_world_gc_archetypes(tecs_world_t* world, const tecs_archetype_gc_policy_t* policy) {
+    tecs_archetype_gc_policy_t defaults = {0, -1};
+    if (!policy) policy = &defaults;
+
+    int removed = 0;
+    int trimmed = 0;
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch || arch == world->root_archetype) continue;
+
+        if (arch->entity_count == 0 &&
+            (tecs_tick_t)(world->tick - tecs_archetype_last_used(arch)) >= policy->min_empty_ticks) {
+            arch->gc_marked = true;
+            removed++;
+        } else if (policy->keep_chunks >= 0) {
+            trimmed += tecs_archetype_trim_chunks(world, arch, policy->keep_chunks, policy->min_empty_ticks);
+        }
+    }
+    if (policy->keep_chunks >= 0) {
+        trimmed += tecs_archetype_trim_chunks(world, world->root_archetype, policy->keep_chunks,
+                                              policy->min_empty_ticks);
+    }
+    if (removed > 0) tecs_world_free_marked_archetypes(world);
+
+    if (removed > 0 || trimmed > 0) {
+        world->structural_change_version++;
+    }
+
+    return removed;
+}
+
+int tecs_remove_empty_archetypes(tecs_world_t* world) {
+    return tecs_world_gc_archetypes(world, NULL);
+}
+
+int tecs_world_archetype_count(const tecs_world_t* world) {
+    return world->archetype_table_size;
+}
+
+int tecs_world_chunk_count(const tecs_world_t* world) {
+    int chunks = 0;
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        if (world->archetype_table[i].archetype) chunks += world->archetype_table[i].archetype->chunk_count;
+    }
+    return chunks;
+}
+
+int tecs_world_archetype_slots(const tecs_world_t* world) {
+    return world->archetype_table_capacity;
+}
+
+bool tecs_world_archetype_info(const tecs_world_t* world, int slot, tecs_archetype_info_t* out) {
+    if (slot < 0 || slot >= world->archetype_table_capacity) return false;
+    const tecs_archetype_t* arch = world->archetype_table[slot].archetype;
+    if (!arch) return false;
+
+    size_t row_bytes = 0;
+    for (int i = 0; i < arch->data_component_count; i++) {
+        row_bytes += (size_t)arch->data_components[i].size + 2 * sizeof(tecs_tick_t);
+    }
+
+    out->archetype_id = arch->id;
+    out->entity_count = arch->entity_count;
+    out->chunk_count = arch->chunk_count;
+    out->component_count = arch->component_count;
+    out->bytes = (size_t)arch->chunk_count * (sizeof(tecs_chunk_t) + row_bytes * TECS_CHUNK_SIZE);
+    return true;
+}
+
+/* Capacity to shrink an array to, or `capacity` when less than half would be freed */
+static int tecs_shrink_capacity(int count, int capacity, int minimum) {
+    int target = minimum;
+    while (target < count) target *= 2;
+    return target * 2 <= capacity ? target : capacity;
+}
+
+/* madvise the whole pages inside [ptr, ptr + size); their contents become undefined.
+ * posix_madvise is no substitute: glibc ignores POSIX_MADV_DONTNEED, so the pages
+ * would be counted as released while staying resident. */
+static size_t tecs_release_pages(void* ptr, size_t size) {
+#if defined(MADV_DONTNEED) && !defined(_WIN32)
+    static uintptr_t page = 0;
+    if (page == 0) page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t begin = ((uintptr_t)ptr + page - 1) & ~(page - 1);
+    uintptr_t end = ((uintptr_t)ptr + size) & ~(page - 1);
+    if (end <= begin || madvise((void*)begin, end - begin, MADV_DONTNEED) != 0) return 0;
+    return end - begin;
+#else
+    (void)ptr;
+    (void)size;
+    return 0;
+#endif
+}
+
+static size_t tecs_chunk_bytes(const tecs_archetype_t* arch) {
+    size_t bytes = sizeof(tecs_chunk_t) + (size_t)arch->data_component_count * sizeof(tecs_column_t);
+    for (int i = 0; i < arch->data_component_count; i++) {
+        bytes += (size_t)TECS_CHUNK_SIZE * ((size_t)arch->data_components[i].size + 2 * sizeof(tecs_tick_t));
+    }
+    return bytes;
+}
+
+/* Release the rows past `count`; only native columns have a known layout */
+static size_t tecs_chunk_release_free_rows(tecs_archetype_t* arch, tecs_chunk_t* chunk) {
+    if (chunk->hibernated || chunk->released_version == chunk->version) return 0;
+    chunk->released_version = chunk->version;
+
+    size_t rows = (size_t)(TECS_CHUNK_SIZE - chunk->count);
+    size_t released = tecs_release_pages(&chunk->entities[chunk->count], rows * sizeof(tecs_entity_t));
+    for (int i = 0; i < arch->data_component_count; i++) {
+        tecs_column_t* column = &chunk->columns[i];
+        size_t size = (size_t)arch->data_components[i].size;
+        if (column->is_native_storage && size > 0) {
+            unsigned char* data = ((tecs_native_storage_t*)column->storage_data)->data;
+            released += tecs_release_pages(data + (size_t)chunk->count * size, rows * size);
+        }
+        released += tecs_release_pages(&column->changed_ticks[chunk->count], rows * sizeof(tecs_tick_t));
+        released += tecs_release_pages(&column->added_ticks[chunk->count], rows * sizeof(tecs_tick_t));
+    }
+    return released;
+}
+
+static void tecs_archetype_shrink(tecs_world_t* world, tecs_archetype_t* arch,
+                                  const tecs_shrink_policy_t* policy, tecs_shrink_stats_t* stats) {
+    int freed = policy->keep_chunks >= 0 ? tecs_archetype_trim_chunks(world, arch, policy->keep_chunks, 0) : 0;
+    if (freed > 0) {
+        stats->chunks_freed += freed;
+        stats->bytes_freed += (size_t)freed * tecs_chunk_bytes(arch);
+        world->structural_change_version++;
+    }
+
+    int capacity = tecs_shrink_capacity(arch->chunk_count, arch->chunk_capacity, TECS_INITIAL_CHUNKS);
+    if (capacity < arch->chunk_capacity) {
+        stats->bytes_freed += (size_t)(arch->chunk_capacity - capacity) * sizeof(tecs_chunk_t*);
+        arch->chunk_capacity = capacity;
+        arch->chunks = TECS_REALLOC(arch->chunks, capacity * sizeof(tecs_chunk_t*));
+    }
+
+    if (policy->release_pages) {
+        for (int c = 0; c < arch->chunk_count; c++) {
+            stats->bytes_released += tecs_chunk_release_free_rows(arch, arch->chunks[c]);
+        }
+    }
+}
+
+static void tecs_shrink_buffer(void** ptr, int count, int* capacity, int minimum, size_t element_size,
+                               tecs_shrink_stats_t* stats) {
+    int new_capacity = tecs_shrink_capacity(count, *capacity, minimum);
+    if (new_capacity < *capacity) {
+        stats->bytes_freed += (size_t)(*capacity - new_capacity) * element_size;
+        *ptr = TECS_REALLOC(*ptr, (size_t)new_capacity * element_size);
+        *capacity = new_capacity;
+    }
+}
+
+/* Sparse slots are only needed up to the highest live index. Generations are
+ * kept up to next_index: they are what rejects stale handles to recycled IDs. */
+static void tecs_world_shrink_indices(tecs_world_t* world, tecs_shrink_stats_t* stats) {
+    tecs_entity_sparse_set_t* set = &world->entities;
+
+    uint32_t high_water = 0;
+    for (int i = 0; i < set->dense_count; i++) {
+        uint32_t index = TECS_ENTITY_INDEX(set->dense[i].entity);
+        if (index >= high_water) high_water = index + 1;
+    }
+    if (high_water < set->sparse_capacity / 2) {
+        size_t capacity = set->sparse_capacity;
+        while (capacity / 2 >= 1024 && capacity / 2 >= (size_t)high_water * 2) capacity /= 2;
+        stats->bytes_freed += (set->sparse_capacity - capacity) * sizeof(uint32_t);
+        set->sparse = TECS_REALLOC(set->sparse, capacity * sizeof(uint32_t));
+        set->sparse_capacity = capacity;
+    }
+    /* Explicit IDs (tecs_entity_new_with_id, transfers keeping IDs) can live past
+     * next_index, so generations keep the live high-water mark too */
+    uint32_t generation_mark = high_water;
+    if (generation_mark < set->next_index) generation_mark = set->next_index;
+    if (generation_mark < set->reserved_end) generation_mark = set->reserved_end;
+    if (generation_mark < set->generation_capacity / 2) {
+        size_t capacity = set->generation_capacity;
+        while (capacity / 2 >= 1024 && capacity / 2 >= (size_t)generation_mark * 2) capacity /= 2;
+        stats->bytes_freed += (set->generation_capacity - capacity) * sizeof(uint16_t);
+        set->generations = TECS_REALLOC(set->generations, capacity * sizeof(uint16_t));
+        set->generation_capacity = capacity;
+    }
+
+    tecs_shrink_buffer((void**)&set->dense, set->dense_count, &set->dense_capacity, 64,
+                       sizeof(tecs_entity_record_t), stats);
+    tecs_shrink_buffer((void**)&set->recycled, set->recycled_count, &set->recycled_capacity, 64,
+                       sizeof(uint32_t), stats);
+    tecs_shrink_buffer((void**)&world->command_buffer, world->command_count, &world->command_capacity, 256,
+                       sizeof(tecs_command_t), stats);
+}
+
+bool tecs_world_shrink(tecs_world_t* world, const tecs_shrink_policy_t* policy,
+                       tecs_shrink_stats_t* stats) {
+    tecs_shrink_policy_t defaults = {0, true, true, 0};
+    tecs_shrink_stats_t scratch;
+    if (!policy) policy = &defaults;
+    if (!stats) stats = &scratch;
+    memset(stats, 0, sizeof(*stats));
+
+    uint64_t start = policy->budget_ns ? tecs_time_ns() : 0;
+    if (world->shrink_cursor >= world->archetype_table_capacity) world->shrink_cursor = 0;
+
+    while (world->shrink_cursor < world->archetype_table_capacity) {
+        tecs_archetype_t* arch = world->archetype_table[world->shrink_cursor++].archetype;
+        if (!arch) continue;
+        tecs_archetype_shrink(world, arch, policy, stats);
+        if (policy->budget_ns && tecs_time_ns() - start >= policy->budget_ns) {
+            if (world->shrink_cursor < world->archetype_table_capacity) return false;
+        }
+    }
+
+    if (policy->trim_indices) tecs_world_shrink_indices(world, stats);
+    world->shrink_cursor = 0;
+    return true;
+}
+
+/* ============================================================================
+ * Capacity Planning
+ * ========================================================================= */
+
+void tecs_world_reserve_entities(tecs_world_t* world, int count) {
+    tecs_entity_sparse_set_t* set = &world->entities;
+    if (count <= 0) return;
+
+    /* Fresh indices come from next_index; recycled ones are already covered */
+    uint64_t last = (uint64_t)set->next_index + (uint64_t)count;
+    if (last >= set->reserved_begin && set->next_index < set->reserved_end) {
+        last += set->reserved_end - set->reserved_begin;
+    }
+    tecs_sparse_set_ensure_capacity(set, last > UINT32_MAX ? UINT32_MAX : (uint32_t)last);
+
+    int dense_needed = set->dense_count + count;
+    if (dense_needed > set->dense_capacity) {
+        set->dense_capacity = dense_needed;
+        set->dense = TECS_REALLOC(set->dense, set->dense_capacity * sizeof(tecs_entity_record_t));
+    }
+}
+
+void tecs_world_reserve_archetypes(tecs_world_t* world, int count) {
+    /* Room for `count` more archetypes below the 0.7 load factor */
+    int needed = world->archetype_table_size + count;
+    int capacity = world->archetype_table_capacity;
+    while (needed >= (capacity * 7) / 10) capacity *= 2;
+    if (capacity > world->archetype_table_capacity || world->archetype_table_tombstones > 0) {
+        tecs_world_rehash_archetypes(world, capacity);
+    }
+
+    /* An add edge and its reverse remove edge per new archetype */
+    tecs_world_reserve_edges(world, count * 2);
+}
+
+/* Append chunks until the archetype has `rows` free rows */
+static int tecs_archetype_reserve_rows(tecs_world_t* world, tecs_archetype_t* arch, int rows) {
+    int free_rows = 0;
+    for (int c = 0; c < arch->chunk_count; c++) {
+        free_rows += TECS_CHUNK_SIZE - arch->chunks[c]->count;
+    }
+    if (free_rows >= rows) return 0;
+
+    int needed = (rows - free_rows + TECS_CHUNK_SIZE - 1) / TECS_CHUNK_SIZE;
+    if (arch->chunk_count + needed > arch->chunk_capacity) {
+        arch->chunk_capacity = arch->chunk_count + needed;
+        arch->chunks = TECS_REALLOC(arch->chunks, arch->chunk_capacity * sizeof(tecs_chunk_t*));
+    }
+    for (int i = 0; i < needed; i++) tecs_archetype_append_chunk(world, arch);
+    return needed;
+}
+
+/* Walk from the root adding `components` in order, creating the archetypes and
+ * edges a real entity would create on the same path. Archetypes along the way
+ * get a chunk for the row passing through them. */
+static tecs_archetype_t* tecs_world_warm_path(tecs_world_t* world, const tecs_component_id_t* components,
+                                              int component_count) {
+    tecs_archetype_t* arch = world->root_archetype;
+    for (int i = 0; i < component_count; i++) {
+        int size = tecs_get_component_size(world, components[i]);
+        if (size < 0) return NULL;  /* Unregistered component */
+        tecs_archetype_reserve_rows(world, arch, 1);
+        arch = tecs_world_get_or_create_archetype_with_component(world, arch, components[i], size);
+    }
+    return arch;
+}
+
+int tecs_world_reserve_rows(tecs_world_t* world, const tecs_component_id_t* components,
+                            int component_count, int rows) {
+    tecs_archetype_t* arch = tecs_world_warm_path(world, components, component_count);
+    return arch ? tecs_archetype_reserve_rows(world, arch, rows) : -1;
+}
+
+int tecs_world_warm_up(tecs_world_t* world, const tecs_archetype_desc_t* descs, int desc_count) {
+    int path_length = 0;
+    for (int i = 0; i < desc_count; i++) path_length += descs[i].component_count;
+    tecs_world_reserve_archetypes(world, path_length);
+
+    int warmed = 0;
+    for (int i = 0; i < desc_count; i++) {
+        tecs_archetype_t* arch = tecs_world_warm_path(world, descs[i].components, descs[i].component_count);
+        if (!arch) continue;
+        if (descs[i].rows > 0) tecs_archetype_reserve_rows(world, arch, descs[i].rows);
+        warmed++;
+    }
+
+    /* Match the new archetypes now so the first iteration does not rebuild */
+    for (int i = 0; i < world->query_count; i++) {
+        if (world->queries[i]->built) tecs_query_build(world->queries[i]);
+    }
+    return warmed;
+}
+
+/* ============================================================================
+ * Chunk Hibernation API
+ * ========================================================================= */
+
+static int tecs_archetype_hibernate(tecs_world_t* world, tecs_archetype_t* arch, tecs_tick_t idle_ticks) {
+    int hibernated = 0;
+    for (int c = 0; c < arch->chunk_count; c++) {
+        tecs_chunk_t* chunk = arch->chunks[c];
+        if ((tecs_tick_t)(world->tick - chunk->last_access) < idle_ticks) continue;
+        if (tecs_chunk_hibernate(world, arch, chunk)) hibernated++;
+    }
+    return hibernated;
+}
+
+int tecs_world_hibernate(tecs_world_t* world, tecs_tick_t idle_ticks) {
+    int hibernated = 0;
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (arch) hibernated += tecs_archetype_hibernate(world, arch, idle_ticks);
+    }
+    return hibernated;
+}
+
+int tecs_query_hibernate(tecs_query_t* query, tecs_tick_t idle_ticks) {
+    if (!query->built || query->last_structural_version != query->world->structural_change_version) {
+        tecs_query_build(query);
+    }
+
+    int hibernated = 0;
+    for (int i = 0; i < query->matched_count; i++) {
+        hibernated += tecs_archetype_hibernate(query->world, query->matched_archetypes[i], idle_ticks);
+    }
+    return hibernated;
+}
+
+int tecs_world_wake(tecs_world_t* world) {
+    int woken = 0;
+    for (int i = 0; i < world->archetype_table_capacity && world->hibernation.chunk_count > 0; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch) continue;
+        for (int c = 0; c < arch->chunk_count; c++) {
+            if (!arch->chunks[c]->hibernated) continue;
+            tecs_chunk_thaw(world, arch, arch->chunks[c]);
+            woken++;
+        }
+    }
+    return woken;
+}
+
+void tecs_query_skip_hibernated(tecs_query_t* query, bool skip) {
+    query->skip_hibernated = skip;
+}
+
+tecs_hibernation_stats_t tecs_world_hibernation_stats(const tecs_world_t* world) {
+    return world->hibernation;
+}
+
+/* ============================================================================
+ * World Hashing
+ * ========================================================================= */
+
+/* Non-empty archetypes in canonical (ascending ID) order; caller frees */
+static tecs_archetype_t** tecs_world_sorted_archetypes(const tecs_world_t* world, int* count) {
+    tecs_archetype_t** archs = TECS_MALLOC((world->archetype_table_capacity + 1) * sizeof(tecs_archetype_t*));
+    int n = 0;
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (arch && arch->entity_count > 0) archs[n++] = arch;
+    }
+    qsort(archs, n, sizeof(tecs_archetype_t*), tecs_compare_archetype_id);
+    *count = n;
+    return archs;
+}
+
+static uint64_t tecs_hash_row(const tecs_world_t* world, tecs_component_id_t component_id,
+                              const void* ptr, int size, uint64_t seed) {
+    /* Children lists live on the heap: hash their contents, not the pointer */
+    if (component_id == world->children_component_id) {
+        const tecs_children_t* children = (const tecs_children_t*)ptr;
+        return tecs_hash_bytes(children->entities, (size_t)children->count * sizeof(tecs_entity_t),
+                               seed ^ (uint64_t)children->count);
+    }
+    return tecs_hash_bytes(ptr, (size_t)size, seed);
+}
+
+static uint64_t tecs_column_compute_hash(const tecs_world_t* world, const tecs_archetype_t* arch,
+                                         const tecs_chunk_t* chunk, int column_index) {
+    const tecs_column_t* column = &chunk->columns[column_index];
+    tecs_component_id_t component_id = arch->data_components[column_index].id;
+    int size = arch->data_components[column_index].size;
+
+    if (column->is_native_storage && component_id != world->children_component_id) {
+        return tecs_hash_bytes(((tecs_native_storage_t*)column->storage_data)->data,
+                               (size_t)chunk->count * size, component_id);
+    }
+
+    uint64_t hash = component_id;
+    for (int row = 0; row < chunk->count; row++) {
+        const void* ptr = column->provider->get_ptr(column->provider->user_data,
+                                                    column->storage_data, row, size);
+        hash = tecs_hash_row(world, component_id, ptr, size, hash);
+    }
+    return hash;
+}
+
+static bool tecs_column_hash_valid(const tecs_chunk_t* chunk, const tecs_column_t* column) {
+    return column->hash_version == chunk->version && column->changed_max < column->hash_tick;
+}
+
+static uint64_t tecs_chunk_entity_hash(tecs_chunk_t* chunk) {
+    if (chunk->entity_hash_version != chunk->version) {
+        chunk->entity_hash = tecs_hash_bytes(chunk->entities,
+                                             (size_t)chunk->count * sizeof(tecs_entity_t), 0);
+        chunk->entity_hash_version = chunk->version;
+    }
+    return chunk->entity_hash;
+}
+
+static uint64_t tecs_column_hash(tecs_world_t* world, tecs_archetype_t* arch, tecs_chunk_t* chunk,
+                                 int column_index) {
+    tecs_column_t* column = &chunk->columns[column_index];
+    if (!tecs_column_hash_valid(chunk, column)) {
+        if (chunk->hibernated) tecs_chunk_access(world, arch, chunk);
+        column->hash = tecs_column_compute_hash(world, arch, chunk, column_index);
+        column->hash_version = chunk->version;
+        column->hash_tick = world->tick;
+    }
+    return column->hash;
+}
+
+uint64_t tecs_world_hash(tecs_world_t* world) {
+    int arch_count;
+    tecs_archetype_t** archs = tecs_world_sorted_archetypes(world, &arch_count);
+
+    uint64_t hash = 0x544543534841534ULL;
+    for (int a = 0; a < arch_count; a++) {
+        tecs_archetype_t* arch = archs[a];
+        hash = tecs_hash_combine(hash, arch->id);
+
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_chunk_t* chunk = arch->chunks[c];
+            if (chunk->count == 0) continue;
+
+            hash = tecs_hash_combine(hash, tecs_chunk_entity_hash(chunk));
+            for (int i = 0; i < arch->data_component_count; i++) {
+                hash = tecs_hash_combine(hash, tecs_column_hash(world, arch, chunk, i));
+            }
+        }
+    }
+
+    TECS_FREE(archs);
+    return hash;
+}
+
+/* Locate the first row where two chunks of the same archetype differ */
+static bool tecs_chunk_diff(tecs_world_t* wa, tecs_archetype_t* arch_a, int chunk_index_a,
+                            tecs_world_t* wb, tecs_archetype_t* arch_b, int chunk_index_b,
+                            tecs_world_diff_t* out) {
+    tecs_chunk_t* ca = arch_a->chunks[chunk_index_a];
+    tecs_chunk_t* cb = arch_b->chunks[chunk_index_b];
+
+    out->archetype_id = arch_a->id;
+    out->chunk_index = chunk_index_a;
+
+    if (ca->count != cb->count || tecs_chunk_entity_hash(ca) != tecs_chunk_entity_hash(cb)) {
+        int count = ca->count < cb->count ? ca->count : cb->count;
+        int row = 0;
+        while (row < count && ca->entities[row] == cb->entities[row]) row++;
+        out->component_id = 0;
+        out->row = row;
+        out->entity = row < ca->count ? ca->entities[row] : cb->entities[row];
+        return true;
+    }
+
+    for (int i = 0; i < arch_a->data_component_count; i++) {
+        if (tecs_column_hash(wa, arch_a, ca, i) == tecs_column_hash(wb, arch_b, cb, i)) continue;
+
+        tecs_component_id_t component_id = arch_a->data_components[i].id;
+        int size = arch_a->data_components[i].size;
+        tecs_column_t* col_a = &ca->columns[i];
+        tecs_column_t* col_b = &cb->columns[i];
+
+        /* Cached hashes survive hibernation; the rows do not */
+        tecs_chunk_access(wa, arch_a, ca);
+        tecs_chunk_access(wb, arch_b, cb);
+
+        out->component_id = component_id;
+        out->row = 0;
+        out->entity = ca->entities[0];
+        for (int row = 0; row < ca->count; row++) {
+            const void* pa = col_a->provider->get_ptr(col_a->provider->user_data, col_a->storage_data, row, size);
+            const void* pb = col_b->provider->get_ptr(col_b->provider->user_data, col_b->storage_data, row, size);
+            if (tecs_hash_row(wa, component_id, pa, size, 0) != tecs_hash_row(wb, component_id, pb, size, 0)) {
+                out->row = row;
+                out->entity = ca->entities[row];
+                break;
+            }
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool tecs_world_diff(tecs_world_t* a, tecs_world_t* b, tecs_world_diff_t* out) {
+    tecs_world_diff_t diff = {0, 0, TECS_ENTITY_NULL, -1, -1};
+
+    int count_a, count_b;
+    tecs_archetype_t** archs_a = tecs_world_sorted_archetypes(a, &count_a);
+    tecs_archetype_t** archs_b = tecs_world_sorted_archetypes(b, &count_b);
+
+    bool differs = false;
+    int ia = 0, ib = 0;
+    while (!differs && (ia < count_a || ib < count_b)) {
+        tecs_archetype_t* arch_a = ia < count_a ? archs_a[ia] : NULL;
+        tecs_archetype_t* arch_b = ib < count_b ? archs_b[ib] : NULL;
+
+        /* Archetype present in only one world */
+        if (!arch_b || (arch_a && arch_a->id < arch_b->id) || !arch_a || arch_b->id < arch_a->id) {
+            bool only_a = arch_a && (!arch_b || arch_a->id < arch_b->id);
+            tecs_archetype_t* arch = only_a ? arch_a : arch_b;
+            diff.archetype_id = arch->id;
+            for (int c = 0; c < arch->chunk_count; c++) {
+                if (arch->chunks[c]->count > 0) {
+                    diff.chunk_index = c;
+                    diff.row = 0;
+                    diff.entity = arch->chunks[c]->entities[0];
+                    break;
+                }
+            }
+            differs = true;
+            break;
+        }
+
+        /* Same archetype: compare non-empty chunks pairwise */
+        int ca = 0, cb = 0;
+        for (;;) {
+            while (ca < arch_a->chunk_count && arch_a->chunks[ca]->count == 0) ca++;
+            while (cb < arch_b->chunk_count && arch_b->chunks[cb]->count == 0) cb++;
+            bool end_a = ca >= arch_a->chunk_count;
+            bool end_b = cb >= arch_b->chunk_count;
+            if (end_a && end_b) break;
+
+            if (end_a || end_b) {
+                tecs_archetype_t* arch = end_a ? arch_b : arch_a;
+                int c = end_a ? cb : ca;
+                diff.archetype_id = arch->id;
+                diff.chunk_index = c;
+                diff.row = 0;
+                diff.entity = arch->chunks[c]->entities[0];
+                differs = true;
+                break;
+            }
+
+            if (tecs_chunk_diff(a, arch_a, ca, b, arch_b, cb, &diff)) {
+                differs = true;
+                break;
+            }
+            ca++;
+            cb++;
+        }
+
+        ia++;
+        ib++;
+    }
+
+    TECS_FREE(archs_a);
+    TECS_FREE(archs_b);
+    if (out) *out = diff;
+    return differs;
+}
+
+/* ============================================================================
+ * Snapshots
+ * ========================================================================= */
+
+/* Immutable copy of one chunk's snapshot columns, shared between snapshots */
+typedef struct tecs_snapshot_chunk_s {
+    int refcount;  /* Owned by the world thread only */
+    int count;
+    tecs_entity_t* entities;
+    void** columns;  /* One per snapshot component of the archetype */
+} tecs_snapshot_chunk_t;
+
+typedef struct {
+    uint64_t id;
+    int component_count;
+    tecs_component_id_t* component_ids;
+    int* sizes;
+    int chunk_count;
+    tecs_snapshot_chunk_t** chunks;
+} tecs_snapshot_archetype_t;
+
+struct tecs_snapshot_s {
+    tecs_tick_t tick;
+    int entity_count;
+    int archetype_count;
+    int archetype_capacity;
+    tecs_snapshot_archetype_t* archetypes;
+};
+
+static void tecs_snapshot_chunk_release(tecs_snapshot_chunk_t* snapshot_chunk) {
+    if (!snapshot_chunk || --snapshot_chunk->refcount > 0) return;
+    TECS_FREE(snapshot_chunk->entities);
+    TECS_FREE(snapshot_chunk->columns);  /* Column data shares the entities block */
+    TECS_FREE(snapshot_chunk);
+}
+
+/* Drop the contents of a snapshot slot, keeping the slot itself */
+static void tecs_snapshot_reset(tecs_snapshot_t* snapshot) {
+    for (int i = 0; i < snapshot->archetype_count; i++) {
+        tecs_snapshot_archetype_t* arch = &snapshot->archetypes[i];
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_snapshot_chunk_release(arch->chunks[c]);
+        }
+        TECS_FREE(arch->component_ids);
+        TECS_FREE(arch->sizes);
+        TECS_FREE(arch->chunks);
+    }
+    snapshot->archetype_count = 0;
+    snapshot->entity_count = 0;
+}
+
+static void tecs_snapshot_free(tecs_snapshot_t* snapshot) {
+    if (!snapshot) return;
+    tecs_snapshot_reset(snapshot);
+    TECS_FREE(snapshot->archetypes);
+    TECS_FREE(snapshot);
+}
+
+static bool tecs_snapshot_is_component(const tecs_world_t* world, tecs_component_id_t component_id) {
+    for (int i = 0; i < world->snapshot_component_count; i++) {
+        if (world->snapshot_components[i] == component_id) return true;
+    }
+    return false;
+}
+
+void tecs_snapshot_component(tecs_world_t* world, tecs_component_id_t component_id) {
+    if (tecs_snapshot_is_component(world, component_id)) return;
+
+    if (world->snapshot_component_count >= world->snapshot_component_capacity) {
+        world->snapshot_component_capacity = world->snapshot_component_capacity ? world->snapshot_component_capacity * 2 : 8;
+        world->snapshot_components = TECS_REALLOC(world->snapshot_components,
+            world->snapshot_component_capacity * sizeof(tecs_component_id_t));
+    }
+    world->snapshot_components[world->snapshot_component_count++] = component_id;
+
+    /* Chunk copies no longer match the column layout */
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch) continue;
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_snapshot_chunk_release(arch->chunks[c]->snapshot);
+            arch->chunks[c]->snapshot = NULL;
+        }
+    }
+}
+
+static bool tecs_chunk_snapshot_valid(const tecs_chunk_t* chunk, const int* columns, int column_count) {
+    if (!chunk->snapshot || chunk->snapshot_version != chunk->version) return false;
+    if (chunk->hibernated) return true;  /* Ticks cannot move without waking the chunk */
+
+    for (int i = 0; i < column_count; i++) {
+        if (chunk->columns[columns[i]].changed_max >= chunk->snapshot_tick) return false;
+    }
+    return true;
+}
+
+/* Snapshot copy of a chunk, reusing the previous copy when nothing changed. `complete`
+ * is the first tick the copy may miss writes of: the current tick, or the next one
+ * when the tick ends right after the publish. */
+static tecs_snapshot_chunk_t* tecs_chunk_snapshot(tecs_world_t* world, tecs_archetype_t* arch,
+                                                  tecs_chunk_t* chunk, const int* columns,
+                                                  const int* sizes, int column_count,
+                                                  tecs_tick_t complete) {
+    if (!tecs_chunk_snapshot_valid(chunk, columns, column_count)) {
+        tecs_chunk_access(world, arch, chunk);
+
+        /* Entities and columns in a single block */
+        size_t bytes = (size_t)chunk->count * sizeof(tecs_entity_t);
+        for (int i = 0; i < column_count; i++) {
+            bytes += ((size_t)chunk->count * sizes[i] + 7) & ~(size_t)7;
+        }
+
+        tecs_snapshot_chunk_t* copy = TECS_MALLOC(sizeof(tecs_snapshot_chunk_t));
+        copy->refcount = 1;
+        copy->count = chunk->count;
+        copy->entities = TECS_MALLOC(bytes > 0 ? bytes : 1);
+        copy->columns = TECS_MALLOC((column_count > 0 ? column_count : 1) * sizeof(void*));
+        memcpy(copy->entities, chunk->entities, (size_t)chunk->count * sizeof(tecs_entity_t));
+
+        char* cursor = (char*)(copy->entities + chunk->count);
+        for (int i = 0; i < column_count; i++) {
+            tecs_column_t* column = &chunk->columns[columns[i]];
+            copy->columns[i] = cursor;
+            if (column->is_native_storage) {
+                memcpy(cursor, ((tecs_native_storage_t*)column->storage_data)->data,
+                       (size_t)chunk->count * sizes[i]);
+            } else {
+                for (int row = 0; row < chunk->count; row++) {
+                    memcpy(cursor + (size_t)row * sizes[i],
+                           column->provider->get_ptr(column->provider->user_data,
+                                                     column->storage_data, row, sizes[i]),
+                           sizes[i]);
+                }
+            }
+            cursor += ((size_t)chunk->count * sizes[i] + 7) & ~(size_t)7;
+        }
+
+        tecs_snapshot_chunk_release(chunk->snapshot);
+        chunk->snapshot = copy;
+        chunk->snapshot_version = chunk->version;
+        chunk->snapshot_tick = complete;
+    }
+
+    chunk->snapshot->refcount++;
+    return chunk->snapshot;
+}
+
+static void tecs_snapshot_build(tecs_world_t* world, tecs_snapshot_t* snapshot, tecs_tick_t complete) {
+    int columns[TECS_MAX_COMPONENTS];
+    int sizes[TECS_MAX_COMPONENTS];
+
+    snapshot->tick = world->tick;
+
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (!arch || arch->entity_count == 0) continue;
+
+        int column_count = 0;
+        for (int c = 0; c < arch->data_component_count; c++) {
+            if (tecs_snapshot_is_component(world, arch->data_components[c].id)) {
+                columns[column_count] = c;
+                sizes[column_count] = arch->data_components[c].size;
+                column_count++;
+            }
+        }
+        if (column_count == 0) continue;
+
+        if (snapshot->archetype_count >= snapshot->archetype_capacity) {
+            snapshot->archetype_capacity = snapshot->archetype_capacity ? snapshot->archetype_capacity * 2 : 16;
+            snapshot->archetypes = TECS_REALLOC(snapshot->archetypes,
+                snapshot->archetype_capacity * sizeof(tecs_snapshot_archetype_t));
+        }
+
+        tecs_snapshot_archetype_t* snap_arch = &snapshot->archetypes[snapshot->archetype_count++];
+        snap_arch->id = arch->id;
+        snap_arch->component_count = column_count;
+        snap_arch->component_ids = TECS_MALLOC(column_count * sizeof(tecs_component_id_t));
+        snap_arch->sizes = TECS_MALLOC(column_count * sizeof(int));
+        for (int c = 0; c < column_count; c++) {
+            snap_arch->component_ids[c] = arch->data_components[columns[c]].id;
+            snap_arch->sizes[c] = sizes[c];
+        }
+
+        snap_arch->chunk_count = 0;
+        snap_arch->chunks = TECS_MALLOC(arch->chunk_count * sizeof(tecs_snapshot_chunk_t*));
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_chunk_t* chunk = arch->chunks[c];
+            if (chunk->count == 0) continue;
+            snap_arch->chunks[snap_arch->chunk_count++] =
+                tecs_chunk_snapshot(world, arch, chunk, columns, sizes, column_count, complete);
+            snapshot->entity_count += chunk->count;
+        }
+    }
+}
+
+static bool tecs_snapshot_publish_ex(tecs_world_t* world, tecs_tick_t complete) {
+    int current = tecs_atomic_load(&world->snapshot_current);
+
+    /* Any slot that is neither published nor pinned by a reader */
+    int slot = -1;
+    for (int i = 0; i < TECS_SNAPSHOT_SLOTS; i++) {
+        if (i != current && tecs_atomic_load(&world->snapshot_pins[i]) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) return false;
+
+    tecs_snapshot_t* snapshot = world->snapshot_slots[slot];
+    if (!snapshot) {
+        snapshot = TECS_CALLOC(1, sizeof(tecs_snapshot_t));
+        world->snapshot_slots[slot] = snapshot;
+    }
+    tecs_snapshot_reset(snapshot);
+    tecs_snapshot_build(world, snapshot, complete);
+
+    tecs_atomic_store(&world->snapshot_current, slot);
+    return true;
+}
+
+/* Writes later in this tick carry the same tick: copies taken now are not complete */
+bool tecs_snapshot_publish(tecs_world_t* world) {
+    return tecs_snapshot_publish_ex(world, world->tick);
+}
+
+const tecs_snapshot_t* tecs_snapshot_acquire(tecs_world_t* world) {
+    for (;;) {
+        int slot = tecs_atomic_load(&world->snapshot_current);
+        if (slot < 0) return NULL;
+
+        /* Pin, then confirm the slot was not recycled in between */
+        tecs_atomic_add(&world->snapshot_pins[slot], 1);
+        if (tecs_atomic_load(&world->snapshot_current) == slot) {
+            return world->snapshot_slots[slot];
+        }
+        tecs_atomic_add(&world->snapshot_pins[slot], -1);
+    }
+}
+
+void tecs_snapshot_release(tecs_world_t* world, const tecs_snapshot_t* snapshot) {
+    for (int i = 0; i < TECS_SNAPSHOT_SLOTS; i++) {
+        if (world->snapshot_slots[i] == snapshot) {
+            tecs_atomic_add(&world->snapshot_pins[i], -1);
+            return;
+        }
+    }
+}
+
+tecs_tick_t tecs_snapshot_tick(const tecs_snapshot_t* snapshot) {
+    return snapshot->tick;
+}
+
+int tecs_snapshot_entity_count(const tecs_snapshot_t* snapshot) {
+    return snapshot->entity_count;
+}
+
+void tecs_snapshot_iter_init(tecs_snapshot_iter_t* iter, const tecs_snapshot_t* snapshot,
+                             const tecs_component_id_t* terms, int term_count) {
+    if (term_count > TECS_MAX_QUERY_TERMS) term_count = TECS_MAX_QUERY_TERMS;
+    iter->snapshot = snapshot;
+    iter->term_count = term_count;
+    for (int i = 0; i < term_count; i++) {
+        iter->terms[i] = terms[i];
+    }
+    iter->archetype_index = -1;
+    iter->chunk_index = 0;
+}
+
+static bool tecs_snapshot_iter_match(tecs_snapshot_iter_t* iter, const tecs_snapshot_archetype_t* arch) {
+    for (int t = 0; t < iter->term_count; t++) {
+        iter->columns[t] = -1;
+        for (int c = 0; c < arch->component_count; c++) {
+            if (arch->component_ids[c] == iter->terms[t]) {
+                iter->columns[t] = c;
+                break;
+            }
+        }
+        if (iter->columns[t] < 0) return false;
+    }
+    return true;
+}
+
+bool tecs_snapshot_iter_next(tecs_snapshot_iter_t* iter) {
+    const tecs_snapshot_t* snapshot = iter->snapshot;
+    if (!snapshot) return false;
+
+    if (iter->archetype_index >= 0 &&
+        ++iter->chunk_index < snapshot->archetypes[iter->archetype_index].chunk_count) {
+        return true;
+    }
+
+    while (++iter->archetype_index < snapshot->archetype_count) {
+        const tecs_snapshot_archetype_t* arch = &snapshot->archetypes[iter->archetype_index];
+        if (arch->chunk_count > 0 && tecs_snapshot_iter_match(iter, arch)) {
+            iter->chunk_index = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+static const tecs_snapshot_chunk_t* tecs_snapshot_iter_chunk(const tecs_snapshot_iter_t* iter) {
+    return iter->snapshot->archetypes[iter->archetype_index].chunks[iter->chunk_index];
+}
+
+int tecs_snapshot_iter_count(const tecs_snapshot_iter_t* iter) {
+    return tecs_snapshot_iter_chunk(iter)->count;
+}
+
+const tecs_entity_t* tecs_snapshot_iter_entities(const tecs_snapshot_iter_t* iter) {
+    return tecs_snapshot_iter_chunk(iter)->entities;
+}
+
+const void* tecs_snapshot_iter_column(const tecs_snapshot_iter_t* iter, int term) {
+    if (term < 0 || term >= iter->term_count) return NULL;
+    return tecs_snapshot_iter_chunk(iter)->columns[iter->columns[term]];
+}
+
+/* ============================================================================
+ * Cross-World Transfer
+ * ========================================================================= */
+
+/* Insertion-ordered uint64 -> uint64 map with an open-addressed index */
+typedef struct {
+    uint64_t* keys;
+    uint64_t* values;
+    int count;
+    int capacity;
+    int* slots;         /* Pair index per slot, -1 if empty */
+    int slot_capacity;  /* Power of two */
+} tecs_u64_map_t;
+
+static void tecs_u64_map_init(tecs_u64_map_t* map) {
+    memset(map, 0, sizeof(*map));
+}
+
+static void tecs_u64_map_free(tecs_u64_map_t* map) {
+    TECS_FREE(map->keys);
+    TECS_FREE(map->values);
+    TECS_FREE(map->slots);
+    memset(map, 0, sizeof(*map));
+}
+
+static void tecs_u64_map_clear(tecs_u64_map_t* map) {
+    map->count = 0;
+    for (int i = 0; i < map->slot_capacity; i++) map->slots[i] = -1;
+}
+
+static int tecs_u64_map_find(const tecs_u64_map_t* map, uint64_t key) {
+    if (map->slot_capacity == 0) return -1;
+
+    size_t mask = (size_t)map->slot_capacity - 1;
+    size_t index = tecs_hash_u64(key) & mask;
+    while (map->slots[index] >= 0) {
+        if (map->keys[map->slots[index]] == key) return map->slots[index];
+        index = (index + 1) & mask;
+    }
+    return -1;
+}
+
+static void tecs_u64_map_rehash(tecs_u64_map_t* map, int slot_capacity) {
+    TECS_FREE(map->slots);
+    map->slots = TECS_MALLOC(slot_capacity * sizeof(int));
+    map->slot_capacity = slot_capacity;
+    for (int i = 0; i < slot_capacity; i++) map->slots[i] = -1;
+
+    size_t mask = (size_t)slot_capacity - 1;
+    for (int i = 0; i < map->count; i++) {
+        size_t index = tecs_hash_u64(map->keys[i]) & mask;
+        while (map->slots[index] >= 0) index = (index + 1) & mask;
+        map->slots[index] = i;
+    }
+}
+
+static void tecs_u64_map_set(tecs_u64_map_t* map, uint64_t key, uint64_t value) {
+    int existing = tecs_u64_map_find(map, key);
+    if (existing >= 0) {
+        map->values[existing] = value;
+        return;
+    }
+
+    if (map->count >= map->capacity) {
+        map->capacity = map->capacity ? map->capacity * 2 : 64;
+        map->keys = TECS_REALLOC(map->keys, map->capacity * sizeof(uint64_t));
+        map->values = TECS_REALLOC(map->values, map->capacity * sizeof(uint64_t));
+    }
+
+    /* Keep load factor <= 0.5 */
+    if ((map->count + 1) * 2 > map->slot_capacity) {
+        tecs_u64_map_rehash(map, map->slot_capacity ? map->slot_capacity * 2 : 128);
+    }
+
+    int pair = map->count++;
+    map->keys[pair] = key;
+    map->values[pair] = value;
+
+    size_t mask = (size_t)map->slot_capacity - 1;
+    size_t index = tecs_hash_u64(key) & mask;
+    while (map->slots[index] >= 0) index = (index + 1) & mask;
+    map->slots[index] = pair;
+}
+
+struct tecs_entity_remap_s {
+    tecs_u64_map_t map;
+};
+
+#define TECS_WORLD_MAP_NOT_TRANSFERRED (-2)
+
+struct tecs_world_map_s {
+    tecs_world_t* src;
+    tecs_world_t* dst;
+    tecs_component_map_t components;  /* src component id -> dst registry index */
+    tecs_u64_map_t archetypes;        /* src archetype id -> dst archetype id */
+};
+
+tecs_entity_remap_t* tecs_entity_remap_new(void) {
+    tecs_entity_remap_t* remap = TECS_MALLOC(sizeof(tecs_entity_remap_t));
+    tecs_u64_map_init(&remap->map);
+    return remap;
+}
+
+void tecs_entity_remap_free(tecs_entity_remap_t* remap) {
+    if (!remap) return;
+    tecs_u64_map_free(&remap->map);
+    TECS_FREE(remap);
+}
+
+void tecs_entity_remap_clear(tecs_entity_remap_t* remap) {
+    tecs_u64_map_clear(&remap->map);
+}
+
+int tecs_entity_remap_count(const tecs_entity_remap_t* remap) {
+    return remap->map.count;
+}
+
+tecs_entity_t tecs_entity_remap_get(const tecs_entity_remap_t* remap, tecs_entity_t src) {
+    int pair = tecs_u64_map_find(&remap->map, src);
+    return pair >= 0 ? remap->map.values[pair] : TECS_ENTITY_NULL;
+}
+
+const tecs_entity_t* tecs_entity_remap_sources(const tecs_entity_remap_t* remap) {
+    return remap->map.keys;
+}
+
+const tecs_entity_t* tecs_entity_remap_targets(const tecs_entity_remap_t* remap) {
+    return remap->map.values;
+}
+
+tecs_world_map_t* tecs_world_map_new(tecs_world_t* src, tecs_world_t* dst) {
+    assert(src != dst);
+
+    tecs_world_map_t* map = TECS_CALLOC(1, sizeof(tecs_world_map_t));
+    map->src = src;
+    map->dst = dst;
+    tecs_component_map_init(&map->components, TECS_MAX_COMPONENTS * 2);
+    tecs_u64_map_init(&map->archetypes);
+
+    /* Resolve every component registered so far; later ones resolve lazily */
+    for (int i = 0; i < src->component_count; i++) {
+        tecs_world_map_component(map, src->component_registry[i].id);
+    }
+
+    return map;
+}
+
+void tecs_world_map_free(tecs_world_map_t* map) {
+    if (!map) return;
+    tecs_component_map_free(&map->components);
+    tecs_u64_map_free(&map->archetypes);
+    TECS_FREE(map);
+}
+
+static int tecs_world_map_resolve(tecs_world_map_t* map, tecs_component_id_t src_id) {
+    int dst_index = tecs_component_map_get(&map->components, src_id);
+    if (dst_index != -1) return dst_index;
+
+    int src_index = tecs_component_map_get(&map->src->component_registry_map, src_id);
+    if (src_index < 0 ||
+        src_id == map->src->parent_component_id || src_id == map->src->children_component_id) {
+        tecs_component_map_set(&map->components, src_id, TECS_WORLD_MAP_NOT_TRANSFERRED);
+        return TECS_WORLD_MAP_NOT_TRANSFERRED;
+    }
+
+    /* Names hash to the same ID in both worlds, so only unregistered components need work */
+    const tecs_component_registry_entry_t* entry = &map->src->component_registry[src_index];
+    dst_index = tecs_component_map_get(&map->dst->component_registry_map, src_id);
+    if (dst_index < 0 || strcmp(map->dst->component_registry[dst_index].name, entry->name) != 0) {
+        tecs_component_id_t dst_id;
+        if (tecs_storage_is_boxed(entry->storage_provider)) {
+            /* Slabs belong to their world */
+            dst_id = tecs_register_component_boxed(map->dst, entry->name, entry->size);
+            tecs_set_component_hooks(map->dst, dst_id, &entry->hooks);
+        } else {
+            dst_id = tecs_register_component_hooks(map->dst, entry->name, entry->size,
+                                                   entry->storage_provider, &entry->hooks);
+        }
+        tecs_set_component_fields(map->dst, dst_id, entry->fields, entry->field_count);
+        dst_index = tecs_component_map_get(&map->dst->component_registry_map, dst_id);
+    }
+
+    /* A destination registered under the name with another size keeps its stride */
+    if (dst_index < 0 || map->dst->component_registry[dst_index].size != entry->size) {
+        tecs_component_map_set(&map->components, src_id, TECS_WORLD_MAP_NOT_TRANSFERRED);
+        return TECS_WORLD_MAP_NOT_TRANSFERRED;
+    }
+    tecs_component_map_set(&map->components, src_id, dst_index);
+    return dst_index;
+}
+
+tecs_component_id_t tecs_world_map_component(tecs_world_map_t* map, tecs_component_id_t src_id) {
+    int dst_index = tecs_world_map_resolve(map, src_id);
+    return dst_index >= 0 ? map->dst->component_registry[dst_index].id : 0;
+}
+
+/* Find or create the archetype with exactly these components */
+static tecs_archetype_t* tecs_world_ensure_archetype(tecs_world_t* world,
+                                                     const tecs_component_info_t* components,
+                                                     int count) {
+    if (count == 0) return world->root_archetype;
+
+    tecs_component_id_t* ids = TECS_MALLOC(count * sizeof(tecs_component_id_t));
+    for (int i = 0; i < count; i++) {
+        ids[i] = components[i].id;
+    }
+    uint64_t hash = tecs_hash_component_set(ids, count);
+    TECS_FREE(ids);
+
+    tecs_archetype_t* arch = tecs_world_find_archetype(world, hash);
+    if (!arch) {
+        arch = tecs_archetype_new(components, count);
+        tecs_world_add_archetype(world, arch);
+    }
+    return arch;
+}
+
+static tecs_archetype_t* tecs_world_map_archetype(tecs_world_map_t* map, tecs_archetype_t* src_arch) {
+    int pair = tecs_u64_map_find(&map->archetypes, src_arch->id);
+    if (pair >= 0) {
+        uint64_t dst_hash = map->archetypes.values[pair];
+        tecs_archetype_t* cached = dst_hash == map->dst->root_archetype->id
+            ? map->dst->root_archetype : tecs_world_find_archetype(map->dst, dst_hash);
+        if (cached) return cached;
+    }
+
+    tecs_component_info_t* components = TECS_MALLOC(
+        (src_arch->component_count + 1) * sizeof(tecs_component_info_t));
+    int count = 0;
+    for (int i = 0; i < src_arch->component_count; i++) {
+        int dst_index = tecs_world_map_resolve(map, src_arch->components[i].id);
+        if (dst_index < 0) continue;
+        components[count].id = map->dst->component_registry[dst_index].id;
+        components[count].size = src_arch->components[i].size;
+        components[count].column_index = -1;
+        count++;
+    }
+
+    tecs_archetype_t* dst_arch = tecs_world_ensure_archetype(map->dst, components, count);
+    TECS_FREE(components);
+
+    tecs_u64_map_set(&map->archetypes, src_arch->id, dst_arch->id);
+    return dst_arch;
+}
+
+/* Copy `count` consecutive rows between two columns of the same component */
+static void tecs_column_copy_rows(tecs_column_t* src, int src_row,
+                                  tecs_column_t* dst, int dst_row, int count, int size) {
+    if (src->is_native_storage && dst->is_native_storage) {
+        memcpy((char*)((tecs_native_storage_t*)dst->storage_data)->data + (size_t)dst_row * size,
+               (char*)((tecs_native_storage_t*)src->storage_data)->data + (size_t)src_row * size,
+               (size_t)count * size);
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        const void* ptr = src->provider->get_ptr(src->provider->user_data, src->storage_data,
+                                                 src_row + i, size);
+        dst->provider->set_data(dst->provider->user_data, dst->storage_data,
+                                dst_row + i, ptr, size);
+    }
+}
+
+/* Close the hole [first, first + count) by moving rows from the chunk tail.
+ * Records of the removed entities are left to the caller, and hooked
+ * components of the removed rows must already be dead. */
+static void tecs_chunk_remove_range(tecs_world_t* world, tecs_archetype_t* arch,
+                                    int chunk_idx, int first, int count) {
+    tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+    tecs_chunk_access(world, arch, chunk);
+    int after = chunk->count - (first + count);
+    int move_count = after < count ? after : count;
+    int tail = chunk->count - move_count;
+
+    if (move_count > 0) {
+        memcpy(&chunk->entities[first], &chunk->entities[tail],
+               move_count * sizeof(tecs_entity_t));
+
+        for (int i = 0; i < arch->data_component_count; i++) {
+            tecs_column_t* column = &chunk->columns[i];
+            int size = arch->data_components[i].size;
+            const tecs_type_hooks_t* hooks = tecs_column_hooks(arch, i);
+
+            if (column->is_native_storage || (hooks && hooks->relocate)) {
+                tecs_column_relocate(hooks, column, tail, column, first, move_count, size);
+            } else {
+                for (int r = 0; r < move_count; r++) {
+                    column->provider->copy_data(column->provider->user_data,
+                                                column->storage_data, tail + r,
+                                                column->storage_data, first + r, size);
+                }
+            }
+            memcpy(&column->changed_ticks[first], &column->changed_ticks[tail],
+                   move_count * sizeof(tecs_tick_t));
+            memcpy(&column->added_ticks[first], &column->added_ticks[tail],
+                   move_count * sizeof(tecs_tick_t));
+        }
+
+        for (int r = 0; r < move_count; r++) {
+            tecs_entity_record_t* moved = tecs_sparse_set_get(&world->entities,
+                                                              chunk->entities[first + r]);
+            if (moved) moved->row = first + r;
+        }
+    }
+
+    chunk->count -= count;
+    chunk->version++;
+    arch->entity_count -= count;
+}
+
+/* Append rows [first, first + count) of a source chunk to the mapped destination archetype */
+static void tecs_transfer_rows(tecs_world_map_t* map, tecs_archetype_t* src_arch,
+                               tecs_chunk_t* src_chunk, int first, int count,
+                               int flags, tecs_entity_remap_t* remap) {
+    tecs_world_t* dst = map->dst;
+    tecs_archetype_t* dst_arch = tecs_world_map_archetype(map, src_arch);
+    tecs_chunk_access(map->src, src_arch, src_chunk);
+
+    /* Destination column -> source column */
+    int src_columns[TECS_MAX_COMPONENTS];
+    for (int j = 0; j < dst_arch->data_component_count; j++) src_columns[j] = -1;
+    for (int i = 0; i < src_arch->data_component_count; i++) {
+        tecs_component_id_t dst_id = tecs_world_map_component(map, src_arch->data_components[i].id);
+        int dst_column = tecs_archetype_column_index(dst_arch, dst_id);
+        if (dst_column >= 0) {
+            src_columns[dst_column] = i;
+        } else if (flags & TECS_TRANSFER_MOVE) {
+            /* Moved entities drop components the destination does not take */
+            tecs_column_destruct(tecs_column_hooks(src_arch, i), &src_chunk->columns[i], first, count,
+                                 src_arch->data_components[i].size);
+        }
+    }
+
+    int done = 0;
+    while (done < count) {
+        int chunk_idx = tecs_archetype_chunk_with_space(dst, dst_arch);
+        tecs_chunk_t* dst_chunk = dst_arch->chunks[chunk_idx];
+        int base = dst_chunk->count;
+        int n = TECS_CHUNK_SIZE - base;
+        if (n > count - done) n = count - done;
+
+        for (int j = 0; j < dst_arch->data_component_count; j++) {
+            tecs_column_t* dst_column = &dst_chunk->columns[j];
+            if (src_columns[j] >= 0) {
+                /* Moves relocate the source rows, copies run the copy hook */
+                const tecs_type_hooks_t* hooks = tecs_column_hooks(src_arch, src_columns[j]);
+                tecs_column_t* src_column = &src_chunk->columns[src_columns[j]];
+                if (flags & TECS_TRANSFER_MOVE) {
+                    tecs_column_relocate(hooks, src_column, first + done,
+                                         dst_column, base, n, dst_arch->data_components[j].size);
+                } else {
+                    tecs_column_copy_construct(hooks, src_column, first + done,
+                                               dst_column, base, n, dst_arch->data_components[j].size);
+                }
+            }
+            for (int r = 0; r < n; r++) {
+                dst_column->changed_ticks[base + r] = dst->tick;
+                dst_column->added_ticks[base + r] = dst->tick;
+            }
+            TECS_TICK_MAX(dst_column->changed_max, dst->tick);
+        }
+
+        for (int r = 0; r < n; r++) {
+            tecs_entity_t src_entity = src_chunk->entities[first + done + r];
+            tecs_entity_t dst_entity;
+            if ((flags & TECS_TRANSFER_KEEP_IDS) &&
+                !tecs_sparse_set_index_alive(&dst->entities, TECS_ENTITY_INDEX(src_entity))) {
+                dst_entity = tecs_sparse_set_insert(&dst->entities, TECS_ENTITY_INDEX(src_entity),
+                                                    TECS_ENTITY_GENERATION(src_entity));
+            } else {
+                dst_entity = tecs_sparse_set_create(&dst->entities);
+            }
+
+            tecs_entity_record_t* record = tecs_sparse_set_get(&dst->entities, dst_entity);
+            record->archetype = dst_arch;
+            record->chunk_index = chunk_idx;
+            record->row = base + r;
+            dst_chunk->entities[base + r] = dst_entity;
+
+            if (remap) tecs_u64_map_set(&remap->map, src_entity, dst_entity);
+        }
+
+        dst_chunk->count += n;
+        dst_chunk->version++;
+        dst_arch->entity_count += n;
+        done += n;
+    }
+}
+
+static void tecs_transfer_release_rows(tecs_world_map_t* map, tecs_archetype_t* src_arch,
+                                       int chunk_idx, int first, int count) {
+    tecs_chunk_t* chunk = src_arch->chunks[chunk_idx];
+    for (int r = 0; r < count; r++) {
+        tecs_sparse_set_remove(&map->src->entities, chunk->entities[first + r]);
+    }
+    tecs_chunk_remove_range(map->src, src_arch, chunk_idx, first, count);
+}
+
+int tecs_transfer_query(tecs_world_map_t* map, tecs_query_t* src_query, int flags,
+                        tecs_entity_remap_t* remap) {
+    assert(src_query->world == map->src);
+
+    if (!src_query->built ||
+        src_query->last_structural_version != map->src->structural_change_version) {
+        tecs_query_build(src_query);
+    }
+
+    int transferred = 0;
+    for (int a = 0; a < src_query->matched_count; a++) {
+        tecs_archetype_t* arch = src_query->matched_archetypes[a];
+        for (int c = 0; c < arch->chunk_count; c++) {
+            int count = arch->chunks[c]->count;
+            if (count == 0) continue;
+
+            tecs_transfer_rows(map, arch, arch->chunks[c], 0, count, flags, remap);
+            if (flags & TECS_TRANSFER_MOVE) {
+                tecs_transfer_release_rows(map, arch, c, 0, count);
+            }
+            transferred += count;
+        }
+    }
+
+    return transferred;
+}
+
+int tecs_transfer_entities(tecs_world_map_t* map, const tecs_entity_t* entities, int count,
+                           int flags, tecs_entity_remap_t* remap) {
+    int transferred = 0;
+    for (int i = 0; i < count; i++) {
+        tecs_entity_record_t* record = tecs_sparse_set_get(&map->src->entities, entities[i]);
+        if (!record || !record->archetype) continue;
+
+        tecs_archetype_t* arch = record->archetype;
+        int chunk_idx = record->chunk_index;
+        int row = record->row;
+
+        tecs_transfer_rows(map, arch, arch->chunks[chunk_idx], row, 1, flags, remap);
+        if (flags & TECS_TRANSFER_MOVE) {
+            tecs_transfer_release_rows(map, arch, chunk_idx, row, 1);
+        }
+        transferred++;
+    }
+
+    return transferred;
+}
+
+/* ============================================================================
+ * Region Streaming
+ * ========================================================================= */
+
+/* File layout (native endianness):
+ *   "TECSRGN1" u32 region u32 archetype_count
+ *   per archetype: u32 component_count {u64 id, i32 size}* u32 chunk_count
+ *   per chunk:     u32 count, u64 entities[count],
+ *                  per data column: bytes[count * size], ticks changed[count], added[count] */
+static const char tecs_region_magic[8] = {'T', 'E', 'C', 'S', 'R', 'G', 'N', '1'};
+
+tecs_component_id_t tecs_region_tag(tecs_world_t* world, uint32_t region) {
+    char name[64];
+    snprintf(name, sizeof(name), "tecs.region.%u", (unsigned)region);
+
+    tecs_component_id_t id = tecs_get_component_id(world, name);
+    if (id == 0) {
+        id = tecs_register_component(world, name, 0);
+    }
+    return id;
+}
+
+void tecs_set_region(tecs_world_t* world, tecs_entity_t entity, uint32_t region) {
+    tecs_add_tag(world, entity, tecs_region_tag(world, region));
+}
+
+bool tecs_entity_is_resident(const tecs_world_t* world, tecs_entity_t entity) {
+    const tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
+    return record && record->archetype;
+}
+
+static bool tecs_region_write_chunk(FILE* file, const tecs_archetype_t* arch, const tecs_chunk_t* chunk) {
+    uint32_t count = (uint32_t)chunk->count;
+    if (fwrite(&count, sizeof(count), 1, file) != 1) return false;
+    if (fwrite(chunk->entities, sizeof(tecs_entity_t), count, file) != count) return false;
+
+    for (int i = 0; i < arch->data_component_count; i++) {
+        const tecs_column_t* column = &chunk->columns[i];
+        int size = arch->data_components[i].size;
+
+        if (column->is_native_storage) {
+            const void* data = ((tecs_native_storage_t*)column->storage_data)->data;
+            if (fwrite(data, (size_t)size, count, file) != count) return false;
+        } else {
+            for (uint32_t r = 0; r < count; r++) {
+                const void* ptr = column->provider->get_ptr(column->provider->user_data,
+                                                            column->storage_data, (int)r, size);
+                if (fwrite(ptr, (size_t)size, 1, file) != 1) return false;
+            }
+        }
+
+        if (fwrite(column->changed_ticks, sizeof(tecs_tick_t), count, file) != count) return false;
+        if (fwrite(column->added_ticks, sizeof(tecs_tick_t), count, file) != count) return false;
+    }
+    return true;
+}
+
+static bool tecs_region_write_archetype(FILE* file, const tecs_archetype_t* arch) {
+    uint32_t component_count = (uint32_t)arch->component_count;
+    if (fwrite(&component_count, sizeof(component_count), 1, file) != 1) return false;
+    for (int i = 0; i < arch->component_count; i++) {
+        uint64_t id = arch->components[i].id;
+        int32_t size = arch->components[i].size;
+        if (fwrite(&id, sizeof(id), 1, file) != 1) return false;
+        if (fwrite(&size, sizeof(size), 1, file) != 1) return false;
+    }
+
+    uint32_t chunk_count = 0;
+    for (int c = 0; c < arch->chunk_count; c++) {
+        if (arch->chunks[c]->count > 0) chunk_count++;
+    }
+    if (fwrite(&chunk_count, sizeof(chunk_count), 1, file) != 1) return false;
+
+    for (int c = 0; c < arch->chunk_count; c++) {
+        if (arch->chunks[c]->count == 0) continue;
+        if (!tecs_region_write_chunk(file, arch, arch->chunks[c])) return false;
+    }
+    return true;
+}
+
+int tecs_region_unload(tecs_world_t* world, uint32_t region, const char* path) {
+    tecs_component_id_t tag = tecs_region_tag(world, region);
+
+    /* Collect the region's archetypes */
+    int arch_count = 0;
+    tecs_archetype_t** archs = TECS_MALLOC(world->archetype_table_capacity * sizeof(tecs_archetype_t*));
+    for (int i = 0; i < world->archetype_table_capacity; i++) {
+        tecs_archetype_t* arch = world->archetype_table[i].archetype;
+        if (arch && arch->entity_count > 0 && tecs_archetype_has_component(arch, tag)) {
+            archs[arch_count++] = arch;
+            for (int c = 0; c < arch->chunk_count; c++) {
+                tecs_chunk_access(world, arch, arch->chunks[c]);
+            }
+        }
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        TECS_FREE(archs);
+        return -1;
+    }
+
+    uint32_t header[2] = {region, (uint32_t)arch_count};
+    bool ok = fwrite(tecs_region_magic, sizeof(tecs_region_magic), 1, file) == 1 &&
+              fwrite(header, sizeof(header), 1, file) == 1;
+    for (int a = 0; ok && a < arch_count; a++) {
+        ok = tecs_region_write_archetype(file, archs[a]);
+    }
+    ok = (fclose(file) == 0) && ok;
+
+    if (!ok) {
+        remove(path);
+        TECS_FREE(archs);
+        return -1;
+    }
+
+    /* File is complete: evict the chunks, keeping entity IDs alive */
+    int unloaded = 0;
+    for (int a = 0; a < arch_count; a++) {
+        tecs_archetype_t* arch = archs[a];
+        for (int c = 0; c < arch->chunk_count; c++) {
+            tecs_chunk_t* chunk = arch->chunks[c];
+            for (int r = 0; r < chunk->count; r++) {
+                tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, chunk->entities[r]);
+                if (record) {
+                    record->archetype = NULL;
+                    record->chunk_index = -1;
+                    record->row = -1;
+                }
+            }
+            unloaded += chunk->count;
+            tecs_chunk_free(chunk, arch->data_component_count);
+        }
+        arch->chunk_count = 0;
+        arch->entity_count = 0;
+    }
+
+    TECS_FREE(archs);
+    world->structural_change_version++;
+    return unloaded;
+}
+
+/* Parsed region file. Chunk payloads point into the file buffer. */
+typedef struct {
+    uint32_t count;
+    const unsigned char* entities;  /* Only 4-byte aligned in the file: read with tecs_region_entity */
+    const unsigned char* columns;   /* Column bytes followed by changed/added ticks, per column */
+} tecs_region_chunk_image_t;
+
+static tecs_entity_t tecs_region_entity(const tecs_region_chunk_image_t* chunk, int index) {
+    tecs_entity_t entity;
+    memcpy(&entity, chunk->entities + (size_t)index * sizeof(tecs_entity_t), sizeof(entity));
+    return entity;
+}
+
+typedef struct {
+    tecs_component_info_t* components;
+    int component_count;
+    tecs_region_chunk_image_t* chunks;
+    int chunk_count;
+} tecs_region_archetype_image_t;
+
+typedef struct {
+    unsigned char* buffer;
+    tecs_region_archetype_image_t* archetypes;
+    int archetype_count;
+} tecs_region_image_t;
+
+static void tecs_region_image_free(tecs_region_image_t* image) {
+    for (int a = 0; a < image->archetype_count; a++) {
+        TECS_FREE(image->archetypes[a].components);
+        TECS_FREE(image->archetypes[a].chunks);
+    }
+    TECS_FREE(image->archetypes);
+    TECS_FREE(image->buffer);
+    TECS_FREE(image);
+}
+
+static bool tecs_region_take(const unsigned char** cursor, const unsigned char* end,
+                             void* out, size_t size) {
+    if ((size_t)(end - *cursor) < size) return false;
+    if (out) memcpy(out, *cursor, size);
+    *cursor += size;
+    return true;
+}
+
+/* Read and validate a region file; touches no world state, safe on any thread */
+static tecs_region_image_t* tecs_region_image_read(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < (long)(sizeof(tecs_region_magic) + 2 * sizeof(uint32_t))) {
+        fclose(file);
+        return NULL;
+    }
+
+    unsigned char* buffer = TECS_MALLOC((size_t)length);
+    size_t read = fread(buffer, 1, (size_t)length, file);
+    fclose(file);
+    if (read != (size_t)length || memcmp(buffer, tecs_region_magic, sizeof(tecs_region_magic)) != 0) {
+        TECS_FREE(buffer);
+        return NULL;
+    }
+
+    tecs_region_image_t* image = TECS_CALLOC(1, sizeof(tecs_region_image_t));
+    image->buffer = buffer;
+
+    const unsigned char* cursor = buffer + sizeof(tecs_region_magic);
+    const unsigned char* end = buffer + length;
+    uint32_t header[2];
+    tecs_region_take(&cursor, end, header, sizeof(header));
+
+    int archetype_count = (int)header[1];
+    image->archetypes = TECS_CALLOC(archetype_count > 0 ? archetype_count : 1,
+                                    sizeof(tecs_region_archetype_image_t));
+
+    for (int a = 0; a < archetype_count; a++) {
+        tecs_region_archetype_image_t* arch = &image->archetypes[image->archetype_count++];
+
+        uint32_t component_count;
+        if (!tecs_region_take(&cursor, end, &component_count, sizeof(component_count)) ||
+            component_count > TECS_MAX_COMPONENTS) goto fail;
+
+        arch->component_count = (int)component_count;
+        arch->components = TECS_MALLOC((component_count + 1) * sizeof(tecs_component_info_t));
+        size_t row_size = sizeof(tecs_entity_t);
+        for (uint32_t i = 0; i < component_count; i++) {
+            uint64_t id;
+            int32_t size;
+            if (!tecs_region_take(&cursor, end, &id, sizeof(id)) ||
+                !tecs_region_take(&cursor, end, &size, sizeof(size)) || size < 0) goto fail;
+            arch->components[i].id = id;
+            arch->components[i].size = size;
+            arch->components[i].column_index = -1;
+            if (size > 0) row_size += (size_t)size + 2 * sizeof(tecs_tick_t);
+        }
+
+        uint32_t chunk_count;
+        if (!tecs_region_take(&cursor, end, &chunk_count, sizeof(chunk_count))) goto fail;
+        arch->chunks = TECS_CALLOC(chunk_count > 0 ? chunk_count : 1, sizeof(tecs_region_chunk_image_t));
+
+        for (uint32_t c = 0; c < chunk_count; c++) {
+            tecs_region_chunk_image_t* chunk = &arch->chunks[arch->chunk_count++];
+            if (!tecs_region_take(&cursor, end, &chunk->count, sizeof(chunk->count)) ||
+                chunk->count > TECS_CHUNK_SIZE ||
+                (size_t)(end - cursor) < row_size * chunk->count) goto fail;
+
+            chunk->entities = cursor;
+            cursor += sizeof(tecs_entity_t) * chunk->count;
+            chunk->columns = cursor;
+            cursor += (row_size - sizeof(tecs_entity_t)) * chunk->count;
+        }
+    }
+
+    return image;
+
+fail:
+    tecs_region_image_free(image);
+    return NULL;
+}
+
+/* Copy `count` rows of a chunk image column into a live column */
+static void tecs_region_copy_column(tecs_column_t* column, int dst_row, const unsigned char* src,
+                                    int size, int count) {
+    if (column->is_native_storage) {
+        memcpy((char*)((tecs_native_storage_t*)column->storage_data)->data + (size_t)dst_row * size,
+               src, (size_t)count * size);
+    } else {
+        for (int r = 0; r < count; r++) {
+            column->provider->set_data(column->provider->user_data, column->storage_data,
+                                       dst_row + r, src + (size_t)r * size, size);
+        }
+    }
+}
+
+/* Build chunks from a parsed image. Rows whose entity was deleted while
+ * unloaded are skipped; live runs are copied in bulk. */
+static int tecs_region_image_integrate(tecs_world_t* world, const tecs_region_image_t* image) {
+    int restored = 0;
+
+    for (int a = 0; a < image->archetype_count; a++) {
+        const tecs_region_archetype_image_t* arch_image = &image->archetypes[a];
+
+        /* Components must still be registered with the same size */
+        bool valid = true;
+        for (int i = 0; i < arch_image->component_count; i++) {
+            int index = tecs_component_map_get(&world->component_registry_map,
+                                               arch_image->components[i].id);
+            if (index < 0 || world->component_registry[index].size != arch_image->components[i].size) {
+                valid = false;
+                break;
+            }
+        }
+        if (!valid) continue;
+
+        tecs_archetype_t* arch = tecs_world_ensure_archetype(world, arch_image->components,
+                                                             arch_image->component_count);
+
+        for (int c = 0; c < arch_image->chunk_count; c++) {
+            const tecs_region_chunk_image_t* chunk_image = &arch_image->chunks[c];
+            int count = (int)chunk_image->count;
+            if (count == 0) continue;
+
+            int chunk_idx = tecs_archetype_append_chunk(world, arch);
+            tecs_chunk_t* chunk = arch->chunks[chunk_idx];
+
+            int row = 0;
+            int first = 0;
+            while (first < count) {
+                /* Find the next run of entities that are still waiting to be loaded */
+                tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities,
+                                                                   tecs_region_entity(chunk_image, first));
+                if (!record || record->archetype) {
+                    first++;
+                    continue;
+                }
+
+                int run = 0;
+                while (first + run < count) {
+                    record = tecs_sparse_set_get(&world->entities, tecs_region_entity(chunk_image, first + run));
+                    if (!record || record->archetype) break;
+                    record->archetype = arch;
+                    record->chunk_index = chunk_idx;
+                    record->row = row + run;
+                    run++;
+                }
+
+                memcpy(&chunk->entities[row], chunk_image->entities + (size_t)first * sizeof(tecs_entity_t),
+                       run * sizeof(tecs_entity_t));
+
+                const unsigned char* src = chunk_image->columns;
+                for (int i = 0; i < arch->data_component_count; i++) {
+                    tecs_column_t* column = &chunk->columns[i];
+                    int size = arch->data_components[i].size;
+                    const unsigned char* data = src;
+                    const unsigned char* changed = data + (size_t)size * count;
+                    const unsigned char* added = changed + sizeof(tecs_tick_t) * count;
+
+                    tecs_region_copy_column(column, row, data + (size_t)first * size, size, run);
+                    memcpy(&column->changed_ticks[row], changed + sizeof(tecs_tick_t) * first,
+                           run * sizeof(tecs_tick_t));
+                    for (int r = row; r < row + run; r++) TECS_TICK_MAX(column->changed_max, column->changed_ticks[r]);
+                    memcpy(&column->added_ticks[row], added + sizeof(tecs_tick_t) * first,
+                           run * sizeof(tecs_tick_t));
+
+                    src = added + sizeof(tecs_tick_t) * count;
+                }
+
+                row += run;
+                first += run;
+            }
+
+            chunk->count = row;
+            chunk->version++;
+            arch->entity_count += row;
+            restored += row;
+        }
+    }
 
-    /* Remove from old archetype */
-    tecs_archetype_remove_entity(current_arch, old_chunk_idx, old_row);
+    world->structural_change_version++;
+    return restored;
 }
 
-void tecs_add_tag(tecs_world_t* world, tecs_entity_t entity, tecs_component_id_t tag_id) {
-    /* Tags are zero-sized components */
-    tecs_set(world, entity, tag_id, NULL, 0);
+int tecs_region_load(tecs_world_t* world, const char* path) {
+    tecs_region_image_t* image = tecs_region_image_read(path);
+    if (!image) return -1;
+
+    int restored = tecs_region_image_integrate(world, image);
+    tecs_region_image_free(image);
+    return restored;
 }
 
-void tecs_mark_changed(tecs_world_t* world, tecs_entity_t entity,
-                      tecs_component_id_t component_id) {
-    tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
-    if (!record || !record->archetype) return;
+typedef struct tecs_region_request_s {
+    char* path;
+    tecs_region_image_t* image;
+    struct tecs_region_request_s* next;
+} tecs_region_request_t;
 
-    tecs_archetype_t* arch = record->archetype;
-    
-    /* O(1) hashmap lookup instead of O(n) linear search */
-    int column_idx = tecs_component_map_get(&arch->data_component_map, component_id);
-    if (column_idx < 0) return;  /* Component not found or is a tag */
-    
-    int chunk_idx = record->chunk_index;
-    int row = record->row % TECS_CHUNK_SIZE;
-    tecs_chunk_t* chunk = arch->chunks[chunk_idx];
-    chunk->columns[column_idx].changed_ticks[row] = world->tick;
-}
+struct tecs_region_loader_s {
+    tecs_world_t* world;
+    tecs_thread_t* thread;
+    tecs_mutex_t* mutex;
+    tecs_cond_t* wake;
+    tecs_region_request_t* queue_head;  /* Waiting to be read */
+    tecs_region_request_t* queue_tail;
+    tecs_region_request_t* ready;       /* Parsed, waiting for sync */
+    int in_flight;
+    bool stop;
+};
 
-/* ============================================================================
- * Query Operations
- * ========================================================================= */
+static void tecs_region_loader_main(void* arg) {
+    tecs_region_loader_t* loader = (tecs_region_loader_t*)arg;
 
-tecs_query_t* tecs_query_new(tecs_world_t* world) {
-    tecs_query_t* query = TECS_CALLOC(1, sizeof(tecs_query_t));
-    query->world = world;
-    query->term_count = 0;
-    query->matched_capacity = 16;
-    query->matched_archetypes = TECS_MALLOC(query->matched_capacity * sizeof(tecs_archetype_t*));
-    query->matched_count = 0;
-    query->last_structural_version = 0;
-    query->built = false;
-    return query;
-}
+    tecs_mutex_lock(loader->mutex);
+    for (;;) {
+        while (!loader->queue_head && !loader->stop) {
+            tecs_cond_wait(loader->wake, loader->mutex);
+        }
+        if (loader->stop) break;
 
-void tecs_query_free(tecs_query_t* query) {
-    if (!query) return;
-    TECS_FREE(query->matched_archetypes);
-    TECS_FREE(query);
-}
+        tecs_region_request_t* request = loader->queue_head;
+        loader->queue_head = request->next;
+        if (!loader->queue_head) loader->queue_tail = NULL;
+        loader->in_flight++;
+        tecs_mutex_unlock(loader->mutex);
 
-static void tecs_query_add_term(tecs_query_t* query, tecs_term_type_t type,
-                               tecs_component_id_t component_id) {
-    if (query->term_count >= TECS_MAX_QUERY_TERMS) return;
+        request->image = tecs_region_image_read(request->path);
 
-    query->terms[query->term_count].type = type;
-    query->terms[query->term_count].component_id = component_id;
-    query->terms[query->term_count].data_index = -1;
-    query->term_count++;
+        tecs_mutex_lock(loader->mutex);
+        request->next = loader->ready;
+        loader->ready = request;
+        loader->in_flight--;
+    }
+    tecs_mutex_unlock(loader->mutex);
 }
 
-void tecs_query_with(tecs_query_t* query, tecs_component_id_t component_id) {
-    tecs_query_add_term(query, TECS_TERM_WITH, component_id);
+tecs_region_loader_t* tecs_region_loader_new(tecs_world_t* world) {
+    tecs_region_loader_t* loader = TECS_CALLOC(1, sizeof(tecs_region_loader_t));
+    loader->world = world;
+    loader->mutex = tecs_mutex_new();
+    loader->wake = tecs_cond_new();
+    loader->thread = tecs_thread_start(tecs_region_loader_main, loader);
+    return loader;
 }
 
-void tecs_query_without(tecs_query_t* query, tecs_component_id_t component_id) {
-    tecs_query_add_term(query, TECS_TERM_WITHOUT, component_id);
+static void tecs_region_request_free(tecs_region_request_t* request) {
+    if (request->image) tecs_region_image_free(request->image);
+    TECS_FREE(request->path);
+    TECS_FREE(request);
 }
 
-void tecs_query_optional(tecs_query_t* query, tecs_component_id_t component_id) {
-    tecs_query_add_term(query, TECS_TERM_OPTIONAL, component_id);
-}
+void tecs_region_loader_free(tecs_region_loader_t* loader) {
+    if (!loader) return;
+
+    tecs_mutex_lock(loader->mutex);
+    loader->stop = true;
+    tecs_cond_broadcast(loader->wake);
+    tecs_mutex_unlock(loader->mutex);
+    if (loader->thread) tecs_thread_join(loader->thread);
+
+    tecs_region_request_t* lists[2] = {loader->queue_head, loader->ready};
+    for (int i = 0; i < 2; i++) {
+        while (lists[i]) {
+            tecs_region_request_t* next = lists[i]->next;
+            tecs_region_request_free(lists[i]);
+            lists[i] = next;
+        }
+    }
 
-void tecs_query_changed(tecs_query_t* query, tecs_component_id_t component_id) {
-    tecs_query_add_term(query, TECS_TERM_CHANGED, component_id);
+    tecs_cond_free(loader->wake);
+    tecs_mutex_free(loader->mutex);
+    TECS_FREE(loader);
 }
 
-void tecs_query_added(tecs_query_t* query, tecs_component_id_t component_id) {
-    tecs_query_add_term(query, TECS_TERM_ADDED, component_id);
+void tecs_region_loader_request(tecs_region_loader_t* loader, const char* path) {
+    tecs_region_request_t* request = TECS_CALLOC(1, sizeof(tecs_region_request_t));
+    size_t length = strlen(path);
+    request->path = TECS_MALLOC(length + 1);
+    memcpy(request->path, path, length + 1);
+
+    /* Without a worker thread the request is read at the next sync */
+    tecs_mutex_lock(loader->mutex);
+    if (loader->queue_tail) loader->queue_tail->next = request;
+    else loader->queue_head = request;
+    loader->queue_tail = request;
+    tecs_cond_signal(loader->wake);
+    tecs_mutex_unlock(loader->mutex);
 }
 
-static bool tecs_archetype_matches_query(const tecs_archetype_t* arch, const tecs_query_t* query) {
-    for (int i = 0; i < query->term_count; i++) {
-        const tecs_query_term_t* term = &query->terms[i];
-        bool has = tecs_archetype_has_component(arch, term->component_id);
+int tecs_region_loader_pending(tecs_region_loader_t* loader) {
+    int pending = 0;
+    tecs_mutex_lock(loader->mutex);
+    for (tecs_region_request_t* r = loader->queue_head; r; r = r->next) pending++;
+    for (tecs_region_request_t* r = loader->ready; r; r = r->next) pending++;
+    pending += loader->in_flight;
+    tecs_mutex_unlock(loader->mutex);
+    return pending;
+}
 
-        switch (term->type) {
-            case TECS_TERM_WITH:
-            case TECS_TERM_CHANGED:
-            case TECS_TERM_ADDED:
-                if (!has) return false;
-                break;
-            case TECS_TERM_WITHOUT:
-                if (has) return false;
-                break;
-            case TECS_TERM_OPTIONAL:
-                /* Always matches */
-                break;
+int tecs_region_loader_sync(tecs_region_loader_t* loader) {
+    tecs_mutex_lock(loader->mutex);
+    tecs_region_request_t* ready = loader->ready;
+    loader->ready = NULL;
+    if (!loader->thread) {
+        /* No worker thread available: read queued files here */
+        for (tecs_region_request_t* r = loader->queue_head; r; r = r->next) {
+            r->image = tecs_region_image_read(r->path);
         }
+        tecs_region_request_t* tail = loader->queue_tail;
+        if (tail) {
+            tail->next = ready;
+            ready = loader->queue_head;
+        }
+        loader->queue_head = loader->queue_tail = NULL;
     }
-    return true;
-}
-
-void tecs_query_build(tecs_query_t* query) {
-    query->matched_count = 0;
+    tecs_mutex_unlock(loader->mutex);
 
-    /* Match against all archetypes - iterate through hash table capacity */
-    for (int i = 0; i < query->world->archetype_table_capacity; i++) {
-        tecs_archetype_t* arch = query->world->archetype_table[i].archetype;
-        if (arch && tecs_archetype_matches_query(arch, query)) {
-            if (query->matched_count >= query->matched_capacity) {
-                query->matched_capacity *= 2;
-                query->matched_archetypes = TECS_REALLOC(query->matched_archetypes,
-                    query->matched_capacity * sizeof(tecs_archetype_t*));
-            }
-            query->matched_archetypes[query->matched_count++] = arch;
+    int restored = 0;
+    while (ready) {
+        tecs_region_request_t* next = ready->next;
+        if (ready->image) {
+            restored += tecs_region_image_integrate(loader->world, ready->image);
         }
+        tecs_region_request_free(ready);
+        ready = next;
     }
-
-    query->last_structural_version = query->world->structural_change_version;
-    query->built = true;
+    return restored;
 }
 
 /* ============================================================================
- * Query Iteration
+ * Sharded Worlds
  * ========================================================================= */
 
-void tecs_query_iter_init(tecs_query_iter_t* iter, tecs_query_t* query) {
-    /* Rebuild if world structure changed */
-    if (!query->built ||
-        query->last_structural_version != query->world->structural_change_version) {
-        tecs_query_build(query);
-    }
+typedef struct {
+    tecs_entity_t entity;
+    int to;
+} tecs_shard_migration_t;
 
-    iter->query = query;
-    iter->archetype_index = 0;
-    iter->chunk_index = -1;
-    iter->current_chunk = NULL;
-    iter->current_archetype = NULL;
-}
+typedef struct {
+    tecs_shard_migration_t* items;
+    int count;
+    int capacity;
+} tecs_shard_queue_t;
 
-tecs_query_iter_t* tecs_query_iter(tecs_query_t* query) {
-    tecs_query_iter_t* iter = TECS_CALLOC(1, sizeof(tecs_query_iter_t));
-    tecs_query_iter_init(iter, query);
-    return iter;
-}
+/* Messages packed as {u32 type, i32 size, payload padded to 8 bytes} */
+typedef struct {
+    unsigned char* data;
+    int size;
+    int capacity;
+} tecs_shard_outbox_t;
 
-tecs_query_iter_t* tecs_query_iter_cached(tecs_query_t* query) {
-    tecs_query_iter_init(&query->cached_iter, query);
-    return &query->cached_iter;
-}
+typedef struct {
+    uint32_t type;
+    int32_t size;
+} tecs_shard_message_header_t;
+
+struct tecs_shard_set_s {
+    int shard_count;
+    tecs_world_t** worlds;
+    tecs_query_t** proxy_queries;
+    tecs_task_pool_t* pool;
+    tecs_component_id_t proxy_id;
+
+    tecs_shard_tick_fn tick;
+    tecs_shard_message_fn on_message;
+    void* user_data;
 
-bool tecs_iter_next(tecs_query_iter_t* iter) {
-    if (!iter || !iter->query) return false;
+    /* Written by the sending shard only */
+    tecs_shard_queue_t* migrations;       /* [from] */
+    tecs_shard_outbox_t* outboxes[2];     /* [from * K + to]; sends go to outboxes[front] */
+    int front;
 
-    /* Advance to next chunk */
-    iter->chunk_index++;
+    /* Per shard pair, created on first use */
+    tecs_world_map_t** maps;
+    tecs_entity_remap_t** remaps;         /* Moves of the last boundary */
 
-    /* Find next non-empty chunk */
-    while (iter->archetype_index < iter->query->matched_count) {
-        iter->current_archetype = iter->query->matched_archetypes[iter->archetype_index];
+    tecs_entity_t* batch;
+    int batch_capacity;
 
-        if (iter->chunk_index < iter->current_archetype->chunk_count) {
-            iter->current_chunk = iter->current_archetype->chunks[iter->chunk_index];
-            if (iter->current_chunk->count > 0) {
-                return true;
-            }
-            iter->chunk_index++;
-        } else {
-            /* Move to next archetype */
-            iter->archetype_index++;
-            iter->chunk_index = 0;
-        }
+    int* delivered;                       /* [shard], last boundary */
+    int* refreshed;
+    tecs_shard_stats_t stats;
+};
+
+tecs_shard_set_t* tecs_shard_set_new(int shard_count, int thread_count) {
+    assert(shard_count > 0);
+    tecs_shard_set_t* set = TECS_CALLOC(1, sizeof(tecs_shard_set_t));
+    int pairs = shard_count * shard_count;
+
+    set->shard_count = shard_count;
+    set->worlds = TECS_MALLOC(shard_count * sizeof(tecs_world_t*));
+    set->proxy_queries = TECS_MALLOC(shard_count * sizeof(tecs_query_t*));
+    set->migrations = TECS_CALLOC(shard_count, sizeof(tecs_shard_queue_t));
+    set->outboxes[0] = TECS_CALLOC(pairs, sizeof(tecs_shard_outbox_t));
+    set->outboxes[1] = TECS_CALLOC(pairs, sizeof(tecs_shard_outbox_t));
+    set->maps = TECS_CALLOC(pairs, sizeof(tecs_world_map_t*));
+    set->remaps = TECS_CALLOC(pairs, sizeof(tecs_entity_remap_t*));
+    set->delivered = TECS_CALLOC(shard_count, sizeof(int));
+    set->refreshed = TECS_CALLOC(shard_count, sizeof(int));
+    set->pool = tecs_task_pool_new(thread_count > 0 ? thread_count : shard_count);
+
+    for (int i = 0; i < shard_count; i++) {
+        set->worlds[i] = tecs_world_new();
+        set->proxy_id = tecs_register_component(set->worlds[i], "tecs.shard.proxy",
+                                                sizeof(tecs_shard_proxy_t));
+        set->proxy_queries[i] = tecs_query_new(set->worlds[i]);
+        tecs_query_with(set->proxy_queries[i], set->proxy_id);
+        tecs_query_build(set->proxy_queries[i]);
     }
+    return set;
+}
 
-    return false;
+void tecs_shard_set_free(tecs_shard_set_t* set) {
+    if (!set) return;
+    int pairs = set->shard_count * set->shard_count;
+
+    for (int i = 0; i < pairs; i++) {
+        tecs_world_map_free(set->maps[i]);
+        tecs_entity_remap_free(set->remaps[i]);
+        TECS_FREE(set->outboxes[0][i].data);
+        TECS_FREE(set->outboxes[1][i].data);
+    }
+    for (int i = 0; i < set->shard_count; i++) {
+        tecs_query_free(set->proxy_queries[i]);
+        tecs_world_free(set->worlds[i]);
+        TECS_FREE(set->migrations[i].items);
+    }
+    tecs_task_pool_free(set->pool);
+
+    TECS_FREE(set->worlds);
+    TECS_FREE(set->proxy_queries);
+    TECS_FREE(set->migrations);
+    TECS_FREE(set->outboxes[0]);
+    TECS_FREE(set->outboxes[1]);
+    TECS_FREE(set->maps);
+    TECS_FREE(set->remaps);
+    TECS_FREE(set->batch);
+    TECS_FREE(set->delivered);
+    TECS_FREE(set->refreshed);
+    TECS_FREE(set);
 }
 
-void tecs_query_iter_free(tecs_query_iter_t* iter) {
-    TECS_FREE(iter);
+int tecs_shard_count(const tecs_shard_set_t* set) {
+    return set->shard_count;
 }
 
-int tecs_iter_count(const tecs_query_iter_t* iter) {
-    return iter->current_chunk ? iter->current_chunk->count : 0;
+tecs_world_t* tecs_shard_world(const tecs_shard_set_t* set, int shard) {
+    return shard >= 0 && shard < set->shard_count ? set->worlds[shard] : NULL;
 }
 
-tecs_entity_t* tecs_iter_entities(const tecs_query_iter_t* iter) {
-    return iter->current_chunk ? iter->current_chunk->entities : NULL;
+tecs_component_id_t tecs_shard_register_component(tecs_shard_set_t* set, const char* name, int size) {
+    tecs_component_id_t id = 0;
+    for (int i = 0; i < set->shard_count; i++) {
+        id = tecs_register_component(set->worlds[i], name, size);
+    }
+    return id;
 }
 
-void* tecs_iter_column(const tecs_query_iter_t* iter, int index) {
-    if (!iter->current_chunk || !iter->current_archetype) return NULL;
-    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+void tecs_shard_set_systems(tecs_shard_set_t* set, tecs_shard_tick_fn tick,
+                            tecs_shard_message_fn on_message, void* user_data) {
+    set->tick = tick;
+    set->on_message = on_message;
+    set->user_data = user_data;
+}
 
-    tecs_column_t* column = &iter->current_chunk->columns[index];
-    
-    /* Fast path for native storage - return raw pointer to array */
-    if (column->is_native_storage) {
-        tecs_native_storage_t* storage = (tecs_native_storage_t*)column->storage_data;
-        return storage->data;
+void tecs_shard_migrate(tecs_shard_set_t* set, int from, tecs_entity_t entity, int to) {
+    assert(from >= 0 && from < set->shard_count && to >= 0 && to < set->shard_count);
+    if (from == to) return;
+
+    tecs_shard_queue_t* queue = &set->migrations[from];
+    if (queue->count >= queue->capacity) {
+        queue->capacity = queue->capacity ? queue->capacity * 2 : 64;
+        queue->items = TECS_REALLOC(queue->items, queue->capacity * sizeof(tecs_shard_migration_t));
     }
-    
-    /* Custom storage - return NULL (caller should use tecs_iter_get_at instead) */
-    return NULL;
+    queue->items[queue->count].entity = entity;
+    queue->items[queue->count].to = to;
+    queue->count++;
 }
 
-tecs_tick_t* tecs_iter_changed_ticks(const tecs_query_iter_t* iter, int index) {
-    if (!iter->current_chunk || !iter->current_archetype) return NULL;
-    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
-
-    return iter->current_chunk->columns[index].changed_ticks;
+tecs_entity_t tecs_shard_remapped(const tecs_shard_set_t* set, int from, tecs_entity_t entity, int* to) {
+    for (int t = 0; t < set->shard_count; t++) {
+        const tecs_entity_remap_t* remap = set->remaps[from * set->shard_count + t];
+        if (!remap) continue;
+        tecs_entity_t moved = tecs_entity_remap_get(remap, entity);
+        if (moved != TECS_ENTITY_NULL) {
+            if (to) *to = t;
+            return moved;
+        }
+    }
+    return TECS_ENTITY_NULL;
 }
 
-tecs_tick_t* tecs_iter_added_ticks(const tecs_query_iter_t* iter, int index) {
-    if (!iter->current_chunk || !iter->current_archetype) return NULL;
-    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+void tecs_shard_send(tecs_shard_set_t* set, int from, int to, uint32_t type, const void* data, int size) {
+    assert(from >= 0 && from < set->shard_count && to >= 0 && to < set->shard_count && size >= 0);
+
+    tecs_shard_outbox_t* box = &set->outboxes[set->front][from * set->shard_count + to];
+    int bytes = (int)sizeof(tecs_shard_message_header_t) + ((size + 7) & ~7);
+    if (box->size + bytes > box->capacity) {
+        int capacity = box->capacity ? box->capacity * 2 : 1024;
+        while (capacity < box->size + bytes) capacity *= 2;
+        box->data = TECS_REALLOC(box->data, capacity);
+        box->capacity = capacity;
+    }
 
-    return iter->current_chunk->columns[index].added_ticks;
+    tecs_shard_message_header_t header = {type, size};
+    memcpy(box->data + box->size, &header, sizeof(header));
+    if (size > 0) memcpy(box->data + box->size + sizeof(header), data, (size_t)size);
+    box->size += bytes;
 }
 
-TECS_API int tecs_iter_column_index(const tecs_query_iter_t* iter, tecs_component_id_t component_id) {
-    if (!iter->current_archetype) return -1;
-    return tecs_component_map_get(&iter->current_archetype->data_component_map, component_id);
+tecs_component_id_t tecs_shard_proxy_component(const tecs_shard_set_t* set) {
+    return set->proxy_id;
 }
 
-TECS_API void* tecs_iter_chunk_data(const tecs_query_iter_t* iter, int column_index) {
-    if (!iter->current_chunk || !iter->current_archetype) return NULL;
-    if (column_index < 0 || column_index >= iter->current_archetype->data_component_count) return NULL;
+tecs_entity_t tecs_shard_proxy_new(tecs_shard_set_t* set, int shard, int remote_shard,
+                                   tecs_entity_t remote, const tecs_component_id_t* components,
+                                   int component_count) {
+    assert(component_count >= 0 && component_count <= TECS_SHARD_PROXY_COMPONENTS);
+    tecs_world_t* world = set->worlds[shard];
 
-    return iter->current_chunk->columns[column_index].storage_data;
-}
+    tecs_shard_proxy_t proxy;
+    memset(&proxy, 0, sizeof(proxy));
+    proxy.shard = remote_shard;
+    proxy.entity = remote;
+    proxy.component_count = component_count;
 
-tecs_storage_provider_t* tecs_iter_storage_provider(const tecs_query_iter_t* iter, int index) {
-    if (!iter->current_chunk || !iter->current_archetype) return NULL;
-    if (index < 0 || index >= iter->current_archetype->data_component_count) return NULL;
+    /* Mirrors are added up front so refreshes never move the proxy between archetypes */
+    tecs_entity_t entity = tecs_entity_new(world);
+    for (int i = 0; i < component_count; i++) {
+        int size = tecs_get_component_size(world, components[i]);
+        if (size <= 0) continue;
+        void* zero = TECS_CALLOC(1, (size_t)size);
+        tecs_set(world, entity, components[i], zero, size);
+        TECS_FREE(zero);
+        proxy.components[i] = components[i];
+    }
+    tecs_set(world, entity, set->proxy_id, &proxy, sizeof(proxy));
+    return entity;
+}
 
-    return iter->current_chunk->columns[index].provider;
+bool tecs_shard_proxy_target(const tecs_shard_set_t* set, int shard, tecs_entity_t proxy,
+                             int* remote_shard, tecs_entity_t* remote) {
+    const tecs_shard_proxy_t* data = (const tecs_shard_proxy_t*)tecs_get_const(
+        set->worlds[shard], proxy, set->proxy_id);
+    if (!data || data->shard < 0) return false;
+    if (remote_shard) *remote_shard = data->shard;
+    if (remote) *remote = data->entity;
+    return true;
 }
 
-/* ============================================================================
- * Deferred Operations
- * ========================================================================= */
+tecs_shard_stats_t tecs_shard_set_stats(const tecs_shard_set_t* set) {
+    return set->stats;
+}
 
-void tecs_begin_deferred(tecs_world_t* world) {
-    world->in_deferred = true;
+static void tecs_shard_tick_task(void* arg, int shard, int worker) {
+    tecs_shard_set_t* set = (tecs_shard_set_t*)arg;
+    (void)worker;
+    if (set->tick) set->tick(set, shard, set->worlds[shard], set->user_data);
+    tecs_world_update(set->worlds[shard]);
 }
 
-void tecs_end_deferred(tecs_world_t* world) {
-    world->in_deferred = false;
+/* Bulk-move every queued entity, one transfer per shard pair */
+static int tecs_shard_apply_migrations(tecs_shard_set_t* set) {
+    int shards = set->shard_count;
+    int moved = 0;
 
-    /* Apply all deferred commands */
-    for (int i = 0; i < world->command_count; i++) {
-        tecs_command_t* cmd = &world->command_buffer[i];
+    for (int i = 0; i < shards * shards; i++) {
+        if (set->remaps[i]) tecs_entity_remap_clear(set->remaps[i]);
+    }
 
-        switch (cmd->type) {
-            case TECS_CMD_SET_COMPONENT:
-                tecs_set(world, cmd->entity, cmd->component_id, cmd->data, cmd->size);
-                TECS_FREE(cmd->data);
-                break;
+    for (int from = 0; from < shards; from++) {
+        tecs_shard_queue_t* queue = &set->migrations[from];
+        if (queue->count == 0) continue;
 
-            case TECS_CMD_UNSET_COMPONENT:
-                tecs_unset(world, cmd->entity, cmd->component_id);
-                break;
+        if (queue->count > set->batch_capacity) {
+            set->batch_capacity = queue->count;
+            set->batch = TECS_REALLOC(set->batch, set->batch_capacity * sizeof(tecs_entity_t));
+        }
 
-            case TECS_CMD_DELETE_ENTITY:
-                tecs_entity_delete(world, cmd->entity);
-                break;
+        for (int to = 0; to < shards; to++) {
+            int count = 0;
+            for (int i = 0; i < queue->count; i++) {
+                if (queue->items[i].to == to) set->batch[count++] = queue->items[i].entity;
+            }
+            if (count == 0) continue;
+
+            int pair = from * shards + to;
+            if (!set->maps[pair]) {
+                set->maps[pair] = tecs_world_map_new(set->worlds[from], set->worlds[to]);
+                set->remaps[pair] = tecs_entity_remap_new();
+            }
+            moved += tecs_transfer_entities(set->maps[pair], set->batch, count,
+                                            TECS_TRANSFER_MOVE, set->remaps[pair]);
         }
+        queue->count = 0;
     }
+    return moved;
+}
 
-    world->command_count = 0;
+/* Read a component without stamping or thawing the chunk, so other shards may call it */
+static const void* tecs_shard_peek(const tecs_world_t* world, tecs_entity_t entity,
+                                   tecs_component_id_t component_id) {
+    const tecs_entity_record_t* record = tecs_sparse_set_get(&world->entities, entity);
+    if (!record || !record->archetype) return NULL;
+
+    const tecs_archetype_t* arch = record->archetype;
+    int column_idx = tecs_archetype_column_index(arch, component_id);
+    if (column_idx < 0) return NULL;
+
+    const tecs_chunk_t* chunk = arch->chunks[record->chunk_index];
+    if (chunk->hibernated) return NULL;
+    const tecs_column_t* column = &chunk->columns[column_idx];
+    return column->provider->get_ptr(column->provider->user_data, column->storage_data,
+                                     record->row, arch->data_components[column_idx].size);
 }
 
-/* ============================================================================
- * Memory Management
- * ========================================================================= */
+static void tecs_shard_proxy_task(void* arg, int shard, int worker) {
+    tecs_shard_set_t* set = (tecs_shard_set_t*)arg;
+    tecs_world_t* world = set->worlds[shard];
+    int refreshed = 0;
+    (void)worker;
+
+    tecs_query_iter_t iter;
+    tecs_query_iter_init(&iter, set->proxy_queries[shard]);
+    while (tecs_iter_next(&iter)) {
+        int count = tecs_iter_count(&iter);
+        tecs_entity_t* entities = tecs_iter_entities(&iter);
+        tecs_shard_proxy_t* proxies = (tecs_shard_proxy_t*)tecs_iter_column(
+            &iter, tecs_iter_column_index(&iter, set->proxy_id));
+
+        for (int i = 0; i < count; i++) {
+            tecs_shard_proxy_t* proxy = &proxies[i];
+            if (proxy->shard < 0) continue;
+
+            int to;
+            tecs_entity_t moved = tecs_shard_remapped(set, proxy->shard, proxy->entity, &to);
+            if (moved != TECS_ENTITY_NULL) {
+                proxy->shard = to;
+                proxy->entity = moved;
+            }
 
-int tecs_remove_empty_archetypes(tecs_world_t* world) {
-    int removed = 0;
+            const tecs_world_t* remote = set->worlds[proxy->shard];
+            if (!tecs_entity_exists(remote, proxy->entity)) {
+                proxy->shard = -1;
+                proxy->entity = TECS_ENTITY_NULL;
+                continue;
+            }
 
-    /* Iterate through hash table capacity */
-    for (int i = 0; i < world->archetype_table_capacity; i++) {
-        tecs_archetype_t* arch = world->archetype_table[i].archetype;
-        if (arch && arch->entity_count == 0 && arch != world->root_archetype) {
-            tecs_archetype_free(arch);
-            world->archetype_table[i].archetype = NULL;
-            world->archetype_table[i].hash = 0;
-            world->archetype_table_size--;
-            removed++;
+            /* Mirrors already exist, so these writes stay in place */
+            for (int c = 0; c < proxy->component_count; c++) {
+                const void* data = tecs_shard_peek(remote, proxy->entity, proxy->components[c]);
+                if (data) {
+                    tecs_set(world, entities[i], proxy->components[c], data,
+                             tecs_get_component_size(world, proxy->components[c]));
+                }
+            }
+            refreshed++;
         }
     }
+    set->refreshed[shard] = refreshed;
+}
 
-    if (removed > 0) {
-        world->structural_change_version++;
+static void tecs_shard_deliver_task(void* arg, int shard, int worker) {
+    tecs_shard_set_t* set = (tecs_shard_set_t*)arg;
+    tecs_shard_outbox_t* back = set->outboxes[set->front ^ 1];
+    int delivered = 0;
+    (void)worker;
+
+    for (int from = 0; from < set->shard_count; from++) {
+        tecs_shard_outbox_t* box = &back[from * set->shard_count + shard];
+        int offset = 0;
+        while (offset < box->size) {
+            tecs_shard_message_header_t header;
+            memcpy(&header, box->data + offset, sizeof(header));
+            offset += (int)sizeof(header);
+            if (set->on_message) {
+                set->on_message(set, shard, from, header.type, box->data + offset, header.size,
+                                set->user_data);
+            }
+            offset += (header.size + 7) & ~7;
+            delivered++;
+        }
+        box->size = 0;
     }
+    set->delivered[shard] = delivered;
+}
 
-    return removed;
+void tecs_shard_set_step(tecs_shard_set_t* set) {
+    uint64_t start = tecs_time_ns();
+    tecs_task_pool_run(set->pool, set->shard_count, tecs_shard_tick_task, set);
+    uint64_t ticked = tecs_time_ns();
+
+    set->stats.migrated = tecs_shard_apply_migrations(set);
+    tecs_task_pool_run(set->pool, set->shard_count, tecs_shard_proxy_task, set);
+
+    /* This frame's sends become the back buffers; delivery may send into the front */
+    set->front ^= 1;
+    tecs_task_pool_run(set->pool, set->shard_count, tecs_shard_deliver_task, set);
+
+    set->stats.messages = 0;
+    set->stats.proxies = 0;
+    for (int i = 0; i < set->shard_count; i++) {
+        set->stats.messages += set->delivered[i];
+        set->stats.proxies += set->refreshed[i];
+    }
+    set->stats.frames++;
+    set->stats.tick_ms = (double)(ticked - start) / 1e6;
+    set->stats.boundary_ms = (double)(tecs_time_ns() - ticked) / 1e6;
 }
 
 /* ============================================================================
@@ -2159,6 +7457,8 @@ void tecs_add_child(tecs_world_t* world, tecs_entity_t parent, tecs_entity_t chi
         }
     }
 
+    if (world->trace) tecs_trace_pair(world, TECS_TRACE_ADD_CHILD, parent, child);
+
     /* Set new Parent component on child */
     tecs_parent_t new_parent = { parent };
     tecs_set(world, child, PARENT_ID, &new_parent, sizeof(tecs_parent_t));
@@ -2193,6 +7493,8 @@ void tecs_remove_child(tecs_world_t* world, tecs_entity_t parent, tecs_entity_t
         return; /* Not a child of this parent */
     }
 
+    if (world->trace) tecs_trace_pair(world, TECS_TRACE_REMOVE_CHILD, parent, child);
+
     /* Remove Parent component from child */
     tecs_unset(world, child, PARENT_ID);
 
@@ -2222,6 +7524,7 @@ void tecs_remove_all_children(tecs_world_t* world, tecs_entity_t parent) {
 
     tecs_children_t* children = tecs_find_children(world, parent);
     if (!children || children->count == 0) return;
+    if (world->trace) tecs_trace_entity(world, TECS_TRACE_REMOVE_CHILDREN, parent);
 
     /* Remove Parent component from all children */
     for (int i = 0; i < children->count; i++) {
@@ -101,6 +101,26 @@ extern "C" {
 #define TBEVY_MAX_STATE_SYSTEMS 64  /* OnEnter/OnExit systems per state */
 #endif
 
+#ifndef TBEVY_MAX_EXTRACT_COMPONENTS
+#define TBEVY_MAX_EXTRACT_COMPONENTS 64  /* Extracted components per sub-app (bitmask) */
+#endif
+
+#ifndef TBEVY_MAX_WORKERS
+#define TBEVY_MAX_WORKERS 64  /* Scheduler threads, including the caller */
+#endif
+
+#ifndef TBEVY_TELEMETRY_ARCHETYPES
+#define TBEVY_TELEMETRY_ARCHETYPES 256  /* Archetype rows in the telemetry block */
+#endif
+
+#ifndef TBEVY_TELEMETRY_SYSTEMS
+#define TBEVY_TELEMETRY_SYSTEMS 128  /* System rows in the telemetry block */
+#endif
+
+#ifndef TBEVY_TELEMETRY_ROWS_PER_FRAME
+#define TBEVY_TELEMETRY_ROWS_PER_FRAME 8  /* Archetype and system rows refreshed per update */
+#endif
+
 /* ============================================================================
  * Forward Declarations
  * ========================================================================= */
@@ -110,6 +130,7 @@ typedef struct tbevy_system_s tbevy_system_t;
 typedef struct tbevy_stage_s tbevy_stage_t;
 typedef struct tbevy_commands_s tbevy_commands_t;
 typedef struct tbevy_observer_s tbevy_observer_t;
+typedef struct tbevy_sub_app_s tbevy_sub_app_t;
 
 /* ============================================================================
  * Enums and Constants
@@ -163,8 +184,37 @@ typedef struct {
     tecs_world_t* world;        /* Direct world access */
     tbevy_commands_t* commands; /* Per-system commands instance */
     tbevy_app_t* _app;          /* Private - for resource access */
+    tbevy_system_t* _system;    /* Private - for budgets and cursors */
 } tbevy_system_ctx_t;
 
+/* Per-system timing collected by the scheduler */
+typedef struct {
+    uint64_t run_count;
+    uint64_t overrun_count;  /* Runs that exceeded the system's budget */
+    double last_ms;
+    double max_ms;
+    double total_ms;
+} tbevy_system_stats_t;
+
+/* Scheduler counters since the last reset, for thread-scaling measurements.
+ * Per-worker arrays are indexed by task pool worker (0 = the updating thread). */
+typedef struct {
+    uint64_t frames;            /* tbevy_app_update calls */
+    uint64_t batches;           /* Parallel batches run */
+    uint64_t parallel_systems;  /* Systems run inside batches */
+    uint64_t serial_systems;    /* Systems run exclusively on the updating thread */
+    uint64_t steals;            /* Batch systems picked up by a worker other than 0 */
+    double batch_ms;            /* Wall time of parallel batches */
+    double barrier_ms;          /* Time worker 0 waited for the rest of a batch */
+    double apply_ms;            /* Time applying system commands */
+    double serial_ms;           /* Time running exclusive systems */
+    uint64_t commands;          /* System commands applied */
+    int worker_count;
+    double busy_ms[TBEVY_MAX_WORKERS];
+    double idle_ms[TBEVY_MAX_WORKERS];  /* Batch wall time the worker spent without a system */
+    uint64_t tasks[TBEVY_MAX_WORKERS];
+} tbevy_scheduler_stats_t;
+
 /* System function signature */
 typedef void (*tbevy_system_fn_t)(tbevy_system_ctx_t* ctx, void* user_data);
 
@@ -247,6 +297,7 @@ struct tbevy_commands_s {
     tecs_entity_t* spawned_entities;
     size_t spawned_count;
     size_t spawned_capacity;
+    bool deferred_spawn;  /* Spawns return provisional IDs (set inside parallel batches) */
 };
 
 /* Entity commands builder */
@@ -277,6 +328,12 @@ TBEVY_API void tbevy_app_update(tbevy_app_t* app);
 /* Run until should_quit returns true */
 TBEVY_API void tbevy_app_run(tbevy_app_t* app, bool (*should_quit)(tbevy_app_t*));
 
+/* Scheduler threads including the caller (0 = CPU count, the default). Ignored for
+ * TBEVY_THREADING_SINGLE apps; AUTO apps stay serial on single-core machines. */
+TBEVY_API void tbevy_app_set_threads(tbevy_app_t* app, int thread_count);
+TBEVY_API void tbevy_app_scheduler_stats(const tbevy_app_t* app, tbevy_scheduler_stats_t* out);
+TBEVY_API void tbevy_app_reset_scheduler_stats(tbevy_app_t* app);
+
 /* ============================================================================
  * Public API - Stages
  * ========================================================================= */
@@ -320,10 +377,38 @@ TBEVY_API tbevy_system_builder_t* tbevy_system_single_threaded(tbevy_system_buil
 TBEVY_API tbevy_system_builder_t* tbevy_system_run_if(tbevy_system_builder_t* builder,
                                                        tbevy_run_condition_fn_t condition,
                                                        void* user_data);
+TBEVY_API tbevy_system_builder_t* tbevy_system_budget(tbevy_system_builder_t* builder,
+                                                       double budget_ms);
+
+/* Access declarations. A system that declares its access may run in parallel with
+ * neighbouring systems of its stage that do not conflict with it (one writes what
+ * the other reads or writes) and have no before/after edge with it. Undeclared and
+ * single-threaded systems run alone, as before. Inside a batch a system must touch
+ * only what it declared, change the world only through its commands (spawns return
+ * provisional IDs, resolved when the commands apply), send events with
+ * tbevy_commands_send_event, and use queries no other system iterates. Run
+ * conditions of batched systems are checked when the batch starts. */
+TBEVY_API tbevy_system_builder_t* tbevy_system_reads(tbevy_system_builder_t* builder,
+                                                      tecs_component_id_t component_id);
+TBEVY_API tbevy_system_builder_t* tbevy_system_writes(tbevy_system_builder_t* builder,
+                                                       tecs_component_id_t component_id);
+TBEVY_API tbevy_system_builder_t* tbevy_system_reads_resource(tbevy_system_builder_t* builder,
+                                                               uint64_t type_id);
+TBEVY_API tbevy_system_builder_t* tbevy_system_writes_resource(tbevy_system_builder_t* builder,
+                                                                uint64_t type_id);
+TBEVY_API tbevy_system_builder_t* tbevy_system_reads_events(tbevy_system_builder_t* builder,
+                                                             uint64_t event_type_id);
 
 /* Finalize system builder (must be called!) */
 TBEVY_API void tbevy_system_build(tbevy_system_builder_t* builder);
 
+/* Time-sliced systems: poll the budget while working and keep progress in the
+ * system's cursor (see tecs_query_iter_resume) so the next frame continues there */
+TBEVY_API bool tbevy_system_over_budget(const tbevy_system_ctx_t* ctx);
+TBEVY_API tecs_query_cursor_t* tbevy_system_cursor(tbevy_system_ctx_t* ctx);
+TBEVY_API bool tbevy_app_system_stats(tbevy_app_t* app, const char* label,
+                                      tbevy_system_stats_t* out);
+
 /* ============================================================================
  * Public API - Resources
  * ========================================================================= */
@@ -417,6 +502,10 @@ TBEVY_API void tbevy_commands_entity_despawn(tbevy_commands_t* commands, tecs_en
 /* Get spawned entity ID */
 TBEVY_API tecs_entity_t tbevy_entity_id(const tbevy_entity_commands_t* ec);
 
+/* Queue an event; it is sent when the commands apply */
+TBEVY_API void tbevy_commands_send_event(tbevy_commands_t* commands, uint64_t event_type_id,
+                                          const void* event_data, size_t event_size);
+
 /* Apply all deferred commands */
 TBEVY_API void tbevy_commands_apply(tbevy_commands_t* commands);
 
@@ -490,6 +579,128 @@ TBEVY_API tbevy_system_builder_t* tbevy_app_add_system_on_exit(tbevy_app_t* app,
                                                                  tbevy_system_fn_t fn,
                                                                  void* user_data);
 
+/* ============================================================================
+ * Public API - Sub-Apps
+ * ========================================================================= */
+
+/* Extract callback - runs on the main thread while neither app is updating */
+typedef void (*tbevy_extract_fn_t)(tbevy_app_t* main_app, tbevy_app_t* sub_app, void* user_data);
+
+/* Add a sub-app with its own world (e.g. rendering). After each main update the
+ * extract step copies registered components into the sub-app's world, then the
+ * sub-app updates - on its own thread when `threaded`, overlapping the next main
+ * update, so frame time approaches max(main, sub) instead of the sum. */
+TBEVY_API tbevy_sub_app_t* tbevy_app_add_sub_app(tbevy_app_t* app, bool threaded);
+
+/* The sub-app's own app: add systems and resources to it as usual */
+TBEVY_API tbevy_app_t* tbevy_sub_app_app(tbevy_sub_app_t* sub_app);
+
+/* Mirror a main-world component into the sub-app's world; only rows whose change
+ * tick moved since the last extract are copied. Returns the sub-world component ID,
+ * 0 for hierarchy components or past TBEVY_MAX_EXTRACT_COMPONENTS. */
+TBEVY_API tecs_component_id_t tbevy_sub_app_extract_component(tbevy_sub_app_t* sub_app,
+                                                               tecs_component_id_t component_id);
+
+/* Add a custom extract step (resources, events, input sampling) */
+TBEVY_API void tbevy_sub_app_add_extract(tbevy_sub_app_t* sub_app, tbevy_extract_fn_t fn,
+                                          void* user_data);
+
+/* Run a system on the sub-app's thread right before it exits */
+TBEVY_API void tbevy_sub_app_on_exit(tbevy_sub_app_t* sub_app, tbevy_system_fn_t fn,
+                                      void* user_data);
+
+/* Sub-world entity mirroring a main-world entity, TECS_ENTITY_NULL if none */
+TBEVY_API tecs_entity_t tbevy_sub_app_entity(const tbevy_sub_app_t* sub_app,
+                                              tecs_entity_t main_entity);
+
+/* Block until the sub-app has finished its current frame */
+TBEVY_API void tbevy_sub_app_wait(tbevy_sub_app_t* sub_app);
+
+/* Default stage of a specific app (tbevy_stage_default() uses the last created app) */
+TBEVY_API tbevy_stage_t* tbevy_app_stage(tbevy_app_t* app, tbevy_stage_id_t stage_id);
+
+/* ============================================================================
+ * Public API - Telemetry
+ * ========================================================================= */
+
+/* Live telemetry for an external inspector: a fixed-size block in named shared memory
+ * (POSIX shm_open, or a named file mapping on Windows), published at the end of every
+ * tbevy_app_update. Counters are refreshed each frame; archetype and system rows are
+ * refreshed TBEVY_TELEMETRY_ROWS_PER_FRAME at a time, round robin, so the cost stays
+ * flat no matter how large the world is. Readers copy the block under a seqlock:
+ * `sequence` is odd while the writer is inside an update. */
+#define TBEVY_TELEMETRY_MAGIC 0x4D4C4554u  /* "TELM" */
+#define TBEVY_TELEMETRY_VERSION 1
+
+typedef struct {
+    uint64_t archetype_id;
+    uint64_t bytes;          /* Chunk storage */
+    int32_t entity_count;
+    int32_t chunk_count;
+    int32_t component_count;
+    uint32_t sampled_frame;  /* Low 32 bits of the frame the row was taken at */
+} tbevy_telemetry_archetype_t;
+
+typedef struct {
+    char label[48];          /* Empty for unlabeled systems */
+    uint64_t run_count;
+    uint64_t overrun_count;
+    double last_ms;
+    double max_ms;
+    double total_ms;
+    uint32_t sampled_frame;
+    uint32_t declaration_order;
+} tbevy_telemetry_system_t;
+
+typedef struct {
+    /* Written once */
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;                /* sizeof(tbevy_telemetry_t) in the writer */
+    uint32_t archetype_capacity;
+    uint32_t system_capacity;
+    uint32_t writer_pid;
+    volatile uint32_t sequence;   /* Seqlock counter, odd while being written */
+    uint32_t reserved;
+
+    /* Refreshed every frame */
+    uint64_t frame;
+    uint64_t timestamp_ns;        /* tecs_time_ns() of the writer at publish */
+    uint64_t publish_ns;          /* Cost of the previous publish */
+    double frame_ms;              /* Wall time of the last tbevy_app_update */
+    int32_t entity_count;
+    int32_t archetype_count;
+    int32_t chunk_count;          /* From the last complete archetype sweep */
+    int32_t system_count;
+    uint64_t memory_bytes;        /* Chunk storage, from the last complete archetype sweep */
+    uint64_t commands;            /* Scheduler counters since the last reset */
+    uint64_t commands_frame;      /* Commands applied during the last frame */
+    uint64_t batches;
+    uint64_t steals;
+    double apply_ms;
+    double batch_ms;
+    double barrier_ms;
+    double serial_ms;
+
+    /* Refreshed round robin */
+    int32_t archetype_rows;
+    int32_t system_rows;
+    tbevy_telemetry_archetype_t archetypes[TBEVY_TELEMETRY_ARCHETYPES];
+    tbevy_telemetry_system_t systems[TBEVY_TELEMETRY_SYSTEMS];
+} tbevy_telemetry_t;
+
+/* Writer. `name` is a plain identifier such as "tecs-game"; false if the segment
+ * could not be created. Disabling (or freeing the app) unlinks the segment. */
+TBEVY_API bool tbevy_app_enable_telemetry(tbevy_app_t* app, const char* name);
+TBEVY_API void tbevy_app_disable_telemetry(tbevy_app_t* app);
+
+/* Reader, usable from another process. Open returns NULL if the segment does not exist
+ * or was written with a different layout; read copies a consistent block and returns
+ * false if the writer kept it busy for every retry. */
+TBEVY_API const tbevy_telemetry_t* tbevy_telemetry_open(const char* name);
+TBEVY_API bool tbevy_telemetry_read(const tbevy_telemetry_t* block, tbevy_telemetry_t* out);
+TBEVY_API void tbevy_telemetry_close(const tbevy_telemetry_t* block);
+
 /* ============================================================================
  * Public API - Bundles
  * ========================================================================= */
@@ -574,6 +785,19 @@ void tbevy_commands_insert_bundle(tbevy_commands_t* commands,
  * Internal Data Structures
  * ========================================================================= */
 
+/* Declared component, resource or event access (internal) */
+typedef enum {
+    TBEVY_ACCESS_COMPONENT,
+    TBEVY_ACCESS_RESOURCE,
+    TBEVY_ACCESS_EVENT
+} tbevy_access_kind_t;
+
+typedef struct {
+    uint64_t id;
+    tbevy_access_kind_t kind;
+    bool write;
+} tbevy_access_t;
+
 /* System descriptor (internal) */
 struct tbevy_system_s {
     tbevy_system_fn_t fn;
@@ -594,6 +818,16 @@ struct tbevy_system_s {
     size_t run_condition_count;
     size_t run_condition_capacity;
 
+    /* Budget */
+    double budget_ms;  /* 0 = unbudgeted */
+    uint64_t start_ns;
+    tecs_query_cursor_t cursor;
+    tbevy_system_stats_t stats;
+
+    /* Declared access (parallel scheduling) */
+    tbevy_access_t* access;
+    size_t access_count, access_capacity;
+
     /* Metadata */
     int declaration_order;
     bool visited;
@@ -650,6 +884,9 @@ typedef struct {
     size_t capacity;
 } tbevy_hashmap_t;
 
+/* Telemetry writer state (internal) */
+typedef struct tbevy_telemetry_writer_s tbevy_telemetry_writer_t;
+
 /* Application state */
 struct tbevy_app_s {
     tecs_world_t* world;
@@ -682,11 +919,73 @@ struct tbevy_app_s {
     /* Deferred operations */
     tbevy_commands_t commands;
 
+    /* Parallel scheduling */
+    tecs_task_pool_t* pool;  /* Created on first use */
+    int thread_count;        /* 0 = CPU count */
+    tbevy_scheduler_stats_t scheduler_stats;
+
+    /* Shared-memory telemetry, NULL when disabled */
+    tbevy_telemetry_writer_t* telemetry;
+
+    /* Sub-apps */
+    tbevy_sub_app_t** sub_apps;
+    size_t sub_app_count;
+    size_t sub_app_capacity;
+
     /* Runtime state */
     bool startup_run;
     int system_declaration_counter;
 };
 
+/* Extracted component (internal) */
+typedef struct {
+    tecs_component_id_t main_id;
+    tecs_component_id_t sub_id;
+    int size;
+    tecs_query_t* query;
+} tbevy_extract_component_t;
+
+/* Main-world entity mirrored in a sub-app, indexed by entity index */
+typedef struct {
+    tecs_entity_t main_entity;  /* TECS_ENTITY_NULL if unused */
+    tecs_entity_t sub_entity;
+    uint64_t mask;              /* Extracted components present in the sub-world */
+    uint64_t seen_mask;         /* Components seen during the current extract */
+    uint32_t seen_frame;
+    uint32_t live_index;
+} tbevy_extract_slot_t;
+
+/* Sub-app (internal) */
+struct tbevy_sub_app_s {
+    tbevy_app_t* app;
+    tbevy_app_t* main_app;
+    bool threaded;
+
+    /* Extraction */
+    tecs_world_map_t* component_map;
+    tbevy_extract_component_t components[TBEVY_MAX_EXTRACT_COMPONENTS];
+    int component_count;
+    tbevy_extract_fn_t* extract_fns;
+    void** extract_data;
+    size_t extract_count, extract_capacity;
+    tbevy_extract_slot_t* slots;
+    uint32_t slot_capacity;
+    uint32_t* live;  /* Indices of used slots */
+    uint32_t live_count, live_capacity;
+    uint32_t frame;
+    tecs_tick_t last_tick;
+
+    tbevy_system_fn_t on_exit;
+    void* on_exit_data;
+
+    /* Worker thread */
+    tecs_thread_t* thread;
+    tecs_mutex_t* mutex;
+    tecs_cond_t* cond;
+    bool frame_pending;
+    bool quit;
+};
+
 /* ============================================================================
  * Hash Map Implementation
  * ========================================================================= */
@@ -829,6 +1128,9 @@ static void tbevy_observer_list_add(tbevy_observer_list_t* list, tbevy_observer_
 
 /* Forward declarations */
 static tbevy_stage_t* tbevy_stage_alloc(tbevy_stage_id_t id, const char* name);
+static void tbevy_sub_app_free(tbevy_sub_app_t* sub_app);
+static void tbevy_app_sync_sub_apps(tbevy_app_t* app);
+static void tbevy_telemetry_publish(tbevy_app_t* app, uint64_t start_ns);
 
 /* Global app pointer for tbevy_stage_default() - set by tbevy_app_new() */
 static tbevy_app_t* g_current_app = NULL;
@@ -888,6 +1190,11 @@ void tbevy_app_free(tbevy_app_t* app) {
     if (g_current_app == app)
         g_current_app = NULL;
 
+    /* Stop and free sub-apps first, they may still be reading their worlds */
+    for (size_t i = 0; i < app->sub_app_count; i++)
+        tbevy_sub_app_free(app->sub_apps[i]);
+    TBEVY_FREE(app->sub_apps);
+
     /* Free systems */
     for (size_t i = 0; i < app->all_systems.count; i++) {
         tbevy_system_t* sys = app->all_systems.systems[i];
@@ -895,6 +1202,7 @@ void tbevy_app_free(tbevy_app_t* app) {
         TBEVY_FREE(sys->after_systems);
         TBEVY_FREE(sys->run_conditions);
         TBEVY_FREE(sys->run_condition_data);
+        TBEVY_FREE(sys->access);
         TBEVY_FREE(sys);
     }
     tbevy_system_list_free(&app->all_systems);
@@ -945,6 +1253,8 @@ void tbevy_app_free(tbevy_app_t* app) {
     tbevy_hashmap_free(&app->on_exit_systems);
 
     tbevy_commands_free(&app->commands);
+    tbevy_app_disable_telemetry(app);
+    tecs_task_pool_free(app->pool);
     tecs_world_free(app->world);
     TBEVY_FREE(app);
 }
@@ -979,6 +1289,12 @@ tbevy_stage_t* tbevy_stage_default(tbevy_stage_id_t stage_id) {
     return tbevy_stage_alloc(stage_id, names[stage_id]);
 }
 
+tbevy_stage_t* tbevy_app_stage(tbevy_app_t* app, tbevy_stage_id_t stage_id) {
+    if (stage_id >= 0 && stage_id < 6)
+        return app->default_stages[stage_id];
+    return NULL;
+}
+
 tbevy_stage_t* tbevy_stage_custom(const char* name) {
     return tbevy_stage_alloc(TBEVY_STAGE_CUSTOM, name);
 }
@@ -1126,6 +1442,76 @@ tbevy_system_builder_t* tbevy_system_run_if(tbevy_system_builder_t* builder,
     return builder;
 }
 
+tbevy_system_builder_t* tbevy_system_budget(tbevy_system_builder_t* builder, double budget_ms) {
+    builder->system->budget_ms = budget_ms > 0.0 ? budget_ms : 0.0;
+    return builder;
+}
+
+bool tbevy_system_over_budget(const tbevy_system_ctx_t* ctx) {
+    const tbevy_system_t* sys = ctx->_system;
+    if (!sys || sys->budget_ms <= 0.0) return false;
+    return (double)(tecs_time_ns() - sys->start_ns) >= sys->budget_ms * 1e6;
+}
+
+static tbevy_system_builder_t* tbevy_system_access(tbevy_system_builder_t* builder,
+                                                    tbevy_access_kind_t kind, uint64_t id,
+                                                    bool write) {
+    tbevy_system_t* sys = builder->system;
+    for (size_t i = 0; i < sys->access_count; i++) {
+        if (sys->access[i].kind == kind && sys->access[i].id == id) {
+            sys->access[i].write |= write;
+            return builder;
+        }
+    }
+
+    if (sys->access_count >= sys->access_capacity) {
+        sys->access_capacity = sys->access_capacity ? sys->access_capacity * 2 : 4;
+        sys->access = TBEVY_REALLOC(sys->access, sys->access_capacity * sizeof(tbevy_access_t));
+    }
+    tbevy_access_t* access = &sys->access[sys->access_count++];
+    access->id = id;
+    access->kind = kind;
+    access->write = write;
+    return builder;
+}
+
+tbevy_system_builder_t* tbevy_system_reads(tbevy_system_builder_t* builder,
+                                            tecs_component_id_t component_id) {
+    return tbevy_system_access(builder, TBEVY_ACCESS_COMPONENT, component_id, false);
+}
+
+tbevy_system_builder_t* tbevy_system_writes(tbevy_system_builder_t* builder,
+                                             tecs_component_id_t component_id) {
+    return tbevy_system_access(builder, TBEVY_ACCESS_COMPONENT, component_id, true);
+}
+
+tbevy_system_builder_t* tbevy_system_reads_resource(tbevy_system_builder_t* builder,
+                                                     uint64_t type_id) {
+    return tbevy_system_access(builder, TBEVY_ACCESS_RESOURCE, type_id, false);
+}
+
+tbevy_system_builder_t* tbevy_system_writes_resource(tbevy_system_builder_t* builder,
+                                                      uint64_t type_id) {
+    return tbevy_system_access(builder, TBEVY_ACCESS_RESOURCE, type_id, true);
+}
+
+tbevy_system_builder_t* tbevy_system_reads_events(tbevy_system_builder_t* builder,
+                                                   uint64_t event_type_id) {
+    return tbevy_system_access(builder, TBEVY_ACCESS_EVENT, event_type_id, false);
+}
+
+tecs_query_cursor_t* tbevy_system_cursor(tbevy_system_ctx_t* ctx) {
+    return ctx->_system ? &ctx->_system->cursor : NULL;
+}
+
+bool tbevy_app_system_stats(tbevy_app_t* app, const char* label, tbevy_system_stats_t* out) {
+    tbevy_system_t* sys = (tbevy_system_t*)tbevy_hashmap_get(&app->labeled_systems,
+                                                             tbevy_hash_string(label));
+    if (!sys) return false;
+    *out = sys->stats;
+    return true;
+}
+
 void tbevy_system_build(tbevy_system_builder_t* builder) {
     tbevy_system_t* system = builder->system;
 
@@ -1192,6 +1578,183 @@ static void tbevy_sort_systems(tbevy_system_list_t* systems) {
     *systems = sorted;
 }
 
+/* Pool for parallel batches, NULL while the app runs serially */
+static tecs_task_pool_t* tbevy_app_pool(tbevy_app_t* app) {
+    if (app->pool || app->threading_mode == TBEVY_THREADING_SINGLE) return app->pool;
+
+    int count = app->thread_count > 0 ? app->thread_count : tecs_cpu_count();
+    if (count > TBEVY_MAX_WORKERS) count = TBEVY_MAX_WORKERS;
+    if (count <= 1) return NULL;
+
+    app->pool = tecs_task_pool_new(count);
+    app->scheduler_stats.worker_count = count;
+    return app->pool;
+}
+
+void tbevy_app_set_threads(tbevy_app_t* app, int thread_count) {
+    tecs_task_pool_free(app->pool);
+    app->pool = NULL;
+    app->thread_count = thread_count > 0 ? thread_count : 0;
+    app->scheduler_stats.worker_count = 0;
+}
+
+void tbevy_app_scheduler_stats(const tbevy_app_t* app, tbevy_scheduler_stats_t* out) {
+    *out = app->scheduler_stats;
+    if (out->worker_count == 0) out->worker_count = 1;
+}
+
+void tbevy_app_reset_scheduler_stats(tbevy_app_t* app) {
+    int worker_count = app->scheduler_stats.worker_count;
+    memset(&app->scheduler_stats, 0, sizeof(app->scheduler_stats));
+    app->scheduler_stats.worker_count = worker_count;
+}
+
+static bool tbevy_system_should_run(tbevy_app_t* app, tbevy_system_t* sys) {
+    for (size_t j = 0; j < sys->run_condition_count; j++) {
+        if (!sys->run_conditions[j](app, sys->run_condition_data[j]))
+            return false;
+    }
+    return true;
+}
+
+/* Run one system, queueing into its commands; returns the elapsed time */
+static uint64_t tbevy_system_execute(tbevy_app_t* app, tbevy_system_t* sys,
+                                     tbevy_commands_t* commands) {
+    tbevy_system_ctx_t ctx = {
+        .world = app->world,
+        .commands = commands,
+        ._app = app,
+        ._system = sys
+    };
+
+    sys->start_ns = tecs_time_ns();
+    sys->fn(&ctx, sys->user_data);
+
+    uint64_t elapsed_ns = tecs_time_ns() - sys->start_ns;
+    double elapsed_ms = (double)elapsed_ns / 1e6;
+    sys->stats.run_count++;
+    sys->stats.last_ms = elapsed_ms;
+    sys->stats.total_ms += elapsed_ms;
+    if (elapsed_ms > sys->stats.max_ms) sys->stats.max_ms = elapsed_ms;
+    if (sys->budget_ms > 0.0 && elapsed_ms > sys->budget_ms) sys->stats.overrun_count++;
+    return elapsed_ns;
+}
+
+static bool tbevy_system_ordered_with(const tbevy_system_t* a, const tbevy_system_t* b) {
+    for (size_t i = 0; i < a->before_count; i++) if (a->before_systems[i] == b) return true;
+    for (size_t i = 0; i < a->after_count; i++) if (a->after_systems[i] == b) return true;
+    for (size_t i = 0; i < b->before_count; i++) if (b->before_systems[i] == a) return true;
+    for (size_t i = 0; i < b->after_count; i++) if (b->after_systems[i] == a) return true;
+    return false;
+}
+
+static bool tbevy_system_conflicts(const tbevy_system_t* a, const tbevy_system_t* b) {
+    for (size_t i = 0; i < a->access_count; i++) {
+        for (size_t j = 0; j < b->access_count; j++) {
+            if (a->access[i].kind == b->access[j].kind && a->access[i].id == b->access[j].id &&
+                (a->access[i].write || b->access[j].write))
+                return true;
+        }
+    }
+    return false;
+}
+
+typedef struct {
+    tbevy_app_t* app;
+    tbevy_system_t** systems;
+    tbevy_commands_t* commands;
+    uint64_t busy_ns[TBEVY_MAX_WORKERS];
+    uint64_t tasks[TBEVY_MAX_WORKERS];
+} tbevy_batch_job_t;
+
+static void tbevy_batch_run_system(void* arg, int index, int worker) {
+    tbevy_batch_job_t* job = (tbevy_batch_job_t*)arg;
+    job->busy_ns[worker] += tbevy_system_execute(job->app, job->systems[index],
+                                                 &job->commands[index]);
+    job->tasks[worker]++;
+}
+
+/* Run a batch of non-conflicting systems on the pool, then apply their commands
+ * in schedule order so the result matches a serial run */
+static void tbevy_run_batch(tbevy_app_t* app, tecs_task_pool_t* pool,
+                            tbevy_system_t** systems, int count) {
+    tbevy_scheduler_stats_t* stats = &app->scheduler_stats;
+    tbevy_batch_job_t job;
+    memset(&job, 0, sizeof(job));
+    job.app = app;
+    job.systems = systems;
+    job.commands = TBEVY_MALLOC((size_t)count * sizeof(tbevy_commands_t));
+    for (int i = 0; i < count; i++) {
+        tbevy_commands_init(&job.commands[i], app);
+        job.commands[i].deferred_spawn = true;
+    }
+
+    uint64_t start_ns = tecs_time_ns();
+    tecs_task_pool_run(pool, count, tbevy_batch_run_system, &job);
+    uint64_t wall_ns = tecs_time_ns() - start_ns;
+
+    stats->batches++;
+    stats->parallel_systems += (uint64_t)count;
+    stats->steals += (uint64_t)count - job.tasks[0];
+    stats->batch_ms += (double)wall_ns / 1e6;
+    stats->barrier_ms += (double)(wall_ns > job.busy_ns[0] ? wall_ns - job.busy_ns[0] : 0) / 1e6;
+    for (int w = 0; w < stats->worker_count; w++) {
+        uint64_t busy = job.busy_ns[w] < wall_ns ? job.busy_ns[w] : wall_ns;
+        stats->busy_ms[w] += (double)busy / 1e6;
+        stats->idle_ms[w] += (double)(wall_ns - busy) / 1e6;
+        stats->tasks[w] += job.tasks[w];
+    }
+
+    start_ns = tecs_time_ns();
+    for (int i = 0; i < count; i++) {
+        stats->commands += job.commands[i].command_count;
+        tbevy_commands_apply(&job.commands[i]);
+        tbevy_commands_free(&job.commands[i]);
+    }
+    stats->apply_ms += (double)(tecs_time_ns() - start_ns) / 1e6;
+    TBEVY_FREE(job.commands);
+}
+
+/* Exclusive system: runs alone, its commands apply right after it */
+static void tbevy_run_exclusive(tbevy_app_t* app, tbevy_system_t* sys) {
+    tbevy_scheduler_stats_t* stats = &app->scheduler_stats;
+    tbevy_commands_t sys_commands;
+    tbevy_commands_init(&sys_commands, app);
+
+    stats->serial_systems++;
+    stats->serial_ms += (double)tbevy_system_execute(app, sys, &sys_commands) / 1e6;
+    stats->commands += sys_commands.command_count;
+
+    uint64_t start_ns = tecs_time_ns();
+    tbevy_commands_apply(&sys_commands);
+    tbevy_commands_free(&sys_commands);
+    stats->apply_ms += (double)(tecs_time_ns() - start_ns) / 1e6;
+}
+
+/* Longest run of declared systems from `first` that may share the pool; systems whose
+ * run conditions fail are skipped. Returns the index after the run. */
+static size_t tbevy_gather_batch(tbevy_app_t* app, const tbevy_system_list_t* sys_list,
+                                 size_t first, tbevy_system_t** batch, int* batch_count) {
+    size_t next = first;
+    *batch_count = 0;
+    while (next < sys_list->count && *batch_count < TBEVY_MAX_SYSTEMS) {
+        tbevy_system_t* candidate = sys_list->systems[next];
+        if (candidate->threading_mode == TBEVY_THREADING_SINGLE || candidate->access_count == 0)
+            break;
+
+        for (int b = 0; b < *batch_count; b++) {
+            if (tbevy_system_conflicts(batch[b], candidate) ||
+                tbevy_system_ordered_with(batch[b], candidate))
+                return next;
+        }
+
+        if (tbevy_system_should_run(app, candidate))
+            batch[(*batch_count)++] = candidate;
+        next++;
+    }
+    return next;
+}
+
 /* Run systems in a stage */
 static void tbevy_run_stage_systems(tbevy_app_t* app, tbevy_stage_t* stage) {
     tbevy_system_list_t* sys_list = (tbevy_system_list_t*)tbevy_hashmap_get(
@@ -1202,37 +1765,25 @@ static void tbevy_run_stage_systems(tbevy_app_t* app, tbevy_stage_t* stage) {
     /* Sort systems by dependencies */
     tbevy_sort_systems(sys_list);
 
-    /* Execute systems (single-threaded for now) */
-    for (size_t i = 0; i < sys_list->count; i++) {
-        tbevy_system_t* sys = sys_list->systems[i];
-
-        /* Check run conditions */
-        bool should_run = true;
-        for (size_t j = 0; j < sys->run_condition_count; j++) {
-            if (!sys->run_conditions[j](app, sys->run_condition_data[j])) {
-                should_run = false;
-                break;
-            }
-        }
-
-        if (should_run) {
-            /* Create per-system context with commands */
-            tbevy_commands_t sys_commands;
-            tbevy_commands_init(&sys_commands, app);
+    tecs_task_pool_t* pool = tbevy_app_pool(app);
+    tbevy_system_t* batch[TBEVY_MAX_SYSTEMS];
 
-            tbevy_system_ctx_t ctx = {
-                .world = app->world,
-                .commands = &sys_commands,
-                ._app = app
-            };
+    size_t i = 0;
+    while (i < sys_list->count) {
+        int batch_count = 0;
+        size_t next = pool ? tbevy_gather_batch(app, sys_list, i, batch, &batch_count) : i;
 
-            /* Execute system with context (queues commands) */
-            sys->fn(&ctx, sys->user_data);
-
-            /* Apply system's commands in deferred mode */
-            tbevy_commands_apply(&sys_commands);
-            tbevy_commands_free(&sys_commands);
+        if (next == i) {
+            /* Undeclared or single-threaded */
+            tbevy_system_t* sys = sys_list->systems[next++];
+            if (tbevy_system_should_run(app, sys)) batch[batch_count++] = sys;
         }
+
+        if (batch_count > 1)
+            tbevy_run_batch(app, pool, batch, batch_count);
+        else if (batch_count == 1)
+            tbevy_run_exclusive(app, batch[0]);
+        i = next;
     }
 
     /* Flush observers */
@@ -1257,6 +1808,9 @@ void tbevy_app_update(tbevy_app_t* app) {
     if (!app->startup_run)
         tbevy_app_run_startup(app);
 
+    app->scheduler_stats.frames++;
+    uint64_t start_ns = app->telemetry ? tecs_time_ns() : 0;
+
     /* Process state transitions first */
     /* (Implementation omitted for brevity - would call process_state_transitions) */
 
@@ -1267,9 +1821,16 @@ void tbevy_app_update(tbevy_app_t* app) {
             tbevy_run_stage_systems(app, stage);
     }
 
+    /* Extract into sub-apps and start their frame */
+    if (app->sub_app_count > 0)
+        tbevy_app_sync_sub_apps(app);
+
     /* Clear events */
     tbevy_app_clear_events(app);
 
+    if (app->telemetry)
+        tbevy_telemetry_publish(app, start_ns);
+
     /* Increment world tick */
     tecs_world_update(app->world);
 }
@@ -1357,6 +1918,7 @@ void tbevy_commands_init(tbevy_commands_t* commands, tbevy_app_t* app) {
     commands->spawned_entities = TBEVY_MALLOC(commands->spawned_capacity *
                                                sizeof(tecs_entity_t));
     commands->spawned_count = 0;
+    commands->deferred_spawn = false;
 }
 
 void tbevy_commands_free(tbevy_commands_t* commands) {
@@ -1395,7 +1957,14 @@ static void tbevy_commands_queue(tbevy_commands_t* commands, tbevy_command_type_
 }
 
 tbevy_entity_commands_t tbevy_commands_spawn(tbevy_commands_t* commands) {
-    tecs_entity_t entity = tecs_entity_new(commands->app->world);
+    tecs_entity_t entity;
+    if (commands->deferred_spawn) {
+        /* The world is shared with other systems: create it when the commands apply */
+        entity = TECS_ENTITY_PROVISIONAL | commands->spawned_count;
+        tbevy_commands_queue(commands, TBEVY_CMD_SPAWN, entity, 0, NULL, 0);
+    } else {
+        entity = tecs_entity_new(commands->app->world);
+    }
 
     if (commands->spawned_count >= commands->spawned_capacity) {
         commands->spawned_capacity *= 2;
@@ -1481,6 +2050,20 @@ tecs_entity_t tbevy_entity_id(const tbevy_entity_commands_t* ec) {
     return ec->entity_id;
 }
 
+void tbevy_commands_send_event(tbevy_commands_t* commands, uint64_t event_type_id,
+                               const void* event_data, size_t event_size) {
+    tbevy_commands_queue(commands, TBEVY_CMD_TRIGGER_EVENT, TECS_ENTITY_NULL, event_type_id,
+                         event_data, event_size);
+}
+
+/* Provisional IDs index the spawned list */
+static tecs_entity_t tbevy_commands_resolve(const tbevy_commands_t* commands,
+                                            tecs_entity_t entity) {
+    if (!(entity & TECS_ENTITY_PROVISIONAL)) return entity;
+    size_t index = (size_t)(entity & ~TECS_ENTITY_PROVISIONAL);
+    return index < commands->spawned_count ? commands->spawned_entities[index] : TECS_ENTITY_NULL;
+}
+
 void tbevy_commands_apply(tbevy_commands_t* commands) {
     if (commands->command_count == 0) {
         commands->spawned_count = 0;
@@ -1495,10 +2078,15 @@ void tbevy_commands_apply(tbevy_commands_t* commands) {
     /* Process commands in order */
     for (size_t i = 0; i < commands->command_count; i++) {
         tbevy_deferred_command_t* cmd = &commands->commands[i];
+        if (cmd->type == TBEVY_CMD_SPAWN && (cmd->entity_id & TECS_ENTITY_PROVISIONAL)) {
+            size_t index = (size_t)(cmd->entity_id & ~TECS_ENTITY_PROVISIONAL);
+            commands->spawned_entities[index] = tecs_entity_new(world);
+        }
+        cmd->entity_id = tbevy_commands_resolve(commands, cmd->entity_id);
 
         switch (cmd->type) {
             case TBEVY_CMD_SPAWN:
-                /* Already spawned immediately for ID assignment */
+                /* Created above, or immediately for ID assignment outside batches */
                 break;
 
             case TBEVY_CMD_INSERT:
@@ -1520,7 +2108,8 @@ void tbevy_commands_apply(tbevy_commands_t* commands) {
                 break;
 
             case TBEVY_CMD_TRIGGER_EVENT:
-                /* Event triggering (if implemented) */
+                if (cmd->data)
+                    tbevy_app_send_event(commands->app, cmd->component_id, cmd->data, cmd->data_size);
                 break;
 
             case TBEVY_CMD_ATTACH_OBSERVER:
@@ -1723,6 +2312,601 @@ tbevy_system_builder_t* tbevy_app_add_system_on_exit(tbevy_app_t* app,
     return tbevy_app_add_system(app, fn, user_data);
 }
 
+/* ============================================================================
+ * Sub-Apps
+ * ========================================================================= */
+
+static void tbevy_sub_app_thread(void* arg) {
+    tbevy_sub_app_t* sub_app = (tbevy_sub_app_t*)arg;
+
+    tecs_mutex_lock(sub_app->mutex);
+    for (;;) {
+        if (sub_app->frame_pending) {
+            tecs_mutex_unlock(sub_app->mutex);
+            tbevy_app_update(sub_app->app);
+            tecs_mutex_lock(sub_app->mutex);
+
+            sub_app->frame_pending = false;
+            tecs_cond_broadcast(sub_app->cond);
+        } else if (sub_app->quit) {
+            break;
+        } else {
+            tecs_cond_wait(sub_app->cond, sub_app->mutex);
+        }
+    }
+    tecs_mutex_unlock(sub_app->mutex);
+}
+
+static void tbevy_sub_app_run_on_exit(tbevy_sub_app_t* sub_app) {
+    if (!sub_app->on_exit) return;
+
+    tbevy_commands_t commands;
+    tbevy_commands_init(&commands, sub_app->app);
+    tbevy_system_ctx_t ctx = {
+        .world = sub_app->app->world,
+        .commands = &commands,
+        ._app = sub_app->app,
+        ._system = NULL
+    };
+    sub_app->on_exit(&ctx, sub_app->on_exit_data);
+    tbevy_commands_apply(&commands);
+    tbevy_commands_free(&commands);
+}
+
+static void tbevy_sub_app_exit_thread(void* arg) {
+    tbevy_sub_app_thread(arg);
+    tbevy_sub_app_run_on_exit((tbevy_sub_app_t*)arg);
+}
+
+tbevy_sub_app_t* tbevy_app_add_sub_app(tbevy_app_t* app, bool threaded) {
+    tbevy_sub_app_t* sub_app = TBEVY_CALLOC(1, sizeof(tbevy_sub_app_t));
+    sub_app->main_app = app;
+    sub_app->threaded = threaded;
+
+    /* Keep tbevy_stage_default() pointing at the main app */
+    tbevy_app_t* current = g_current_app;
+    sub_app->app = tbevy_app_new(TBEVY_THREADING_SINGLE);
+    g_current_app = current;
+
+    sub_app->component_map = tecs_world_map_new(app->world, sub_app->app->world);
+
+    if (app->sub_app_count >= app->sub_app_capacity) {
+        app->sub_app_capacity = app->sub_app_capacity ? app->sub_app_capacity * 2 : 4;
+        app->sub_apps = TBEVY_REALLOC(app->sub_apps,
+                                      app->sub_app_capacity * sizeof(tbevy_sub_app_t*));
+    }
+    app->sub_apps[app->sub_app_count++] = sub_app;
+
+    return sub_app;
+}
+
+static void tbevy_sub_app_start_thread(tbevy_sub_app_t* sub_app) {
+    sub_app->mutex = tecs_mutex_new();
+    sub_app->cond = tecs_cond_new();
+    sub_app->thread = tecs_thread_start(tbevy_sub_app_exit_thread, sub_app);
+}
+
+static void tbevy_sub_app_free(tbevy_sub_app_t* sub_app) {
+    if (sub_app->thread) {
+        tecs_mutex_lock(sub_app->mutex);
+        sub_app->quit = true;
+        tecs_cond_broadcast(sub_app->cond);
+        tecs_mutex_unlock(sub_app->mutex);
+
+        tecs_thread_join(sub_app->thread);
+        tecs_cond_free(sub_app->cond);
+        tecs_mutex_free(sub_app->mutex);
+    } else {
+        tbevy_sub_app_run_on_exit(sub_app);
+    }
+
+    for (int i = 0; i < sub_app->component_count; i++)
+        tecs_query_free(sub_app->components[i].query);
+    tecs_world_map_free(sub_app->component_map);
+
+    TBEVY_FREE(sub_app->extract_fns);
+    TBEVY_FREE(sub_app->extract_data);
+    TBEVY_FREE(sub_app->slots);
+    TBEVY_FREE(sub_app->live);
+    tbevy_app_free(sub_app->app);
+    TBEVY_FREE(sub_app);
+}
+
+tbevy_app_t* tbevy_sub_app_app(tbevy_sub_app_t* sub_app) {
+    return sub_app->app;
+}
+
+tecs_component_id_t tbevy_sub_app_extract_component(tbevy_sub_app_t* sub_app,
+                                                     tecs_component_id_t component_id) {
+    for (int i = 0; i < sub_app->component_count; i++) {
+        if (sub_app->components[i].main_id == component_id)
+            return sub_app->components[i].sub_id;
+    }
+    if (sub_app->component_count >= TBEVY_MAX_EXTRACT_COMPONENTS) return 0;
+
+    tecs_component_id_t sub_id = tecs_world_map_component(sub_app->component_map, component_id);
+    if (sub_id == 0) return 0;
+
+    tbevy_extract_component_t* comp = &sub_app->components[sub_app->component_count++];
+    comp->main_id = component_id;
+    comp->sub_id = sub_id;
+    comp->size = tecs_get_component_size(sub_app->main_app->world, component_id);
+    comp->query = tecs_query_new(sub_app->main_app->world);
+    tecs_query_with(comp->query, component_id);
+    tecs_query_build(comp->query);
+
+    return sub_id;
+}
+
+void tbevy_sub_app_add_extract(tbevy_sub_app_t* sub_app, tbevy_extract_fn_t fn,
+                                void* user_data) {
+    if (sub_app->extract_count >= sub_app->extract_capacity) {
+        sub_app->extract_capacity = sub_app->extract_capacity ? sub_app->extract_capacity * 2 : 4;
+        sub_app->extract_fns = TBEVY_REALLOC(sub_app->extract_fns,
+            sub_app->extract_capacity * sizeof(tbevy_extract_fn_t));
+        sub_app->extract_data = TBEVY_REALLOC(sub_app->extract_data,
+            sub_app->extract_capacity * sizeof(void*));
+    }
+    sub_app->extract_fns[sub_app->extract_count] = fn;
+    sub_app->extract_data[sub_app->extract_count] = user_data;
+    sub_app->extract_count++;
+}
+
+void tbevy_sub_app_on_exit(tbevy_sub_app_t* sub_app, tbevy_system_fn_t fn, void* user_data) {
+    sub_app->on_exit = fn;
+    sub_app->on_exit_data = user_data;
+}
+
+tecs_entity_t tbevy_sub_app_entity(const tbevy_sub_app_t* sub_app, tecs_entity_t main_entity) {
+    uint32_t index = TECS_ENTITY_INDEX(main_entity);
+    if (main_entity == TECS_ENTITY_NULL || index >= sub_app->slot_capacity) return TECS_ENTITY_NULL;
+
+    const tbevy_extract_slot_t* slot = &sub_app->slots[index];
+    return slot->main_entity == main_entity ? slot->sub_entity : TECS_ENTITY_NULL;
+}
+
+void tbevy_sub_app_wait(tbevy_sub_app_t* sub_app) {
+    if (!sub_app->thread) return;
+
+    tecs_mutex_lock(sub_app->mutex);
+    while (sub_app->frame_pending)
+        tecs_cond_wait(sub_app->cond, sub_app->mutex);
+    tecs_mutex_unlock(sub_app->mutex);
+}
+
+static void tbevy_sub_app_release_slot(tbevy_sub_app_t* sub_app, tbevy_extract_slot_t* slot) {
+    tecs_entity_delete(sub_app->app->world, slot->sub_entity);
+
+    uint32_t moved = sub_app->live[--sub_app->live_count];
+    sub_app->live[slot->live_index] = moved;
+    sub_app->slots[moved].live_index = slot->live_index;
+
+    slot->main_entity = TECS_ENTITY_NULL;
+    slot->sub_entity = TECS_ENTITY_NULL;
+    slot->mask = 0;
+}
+
+static tbevy_extract_slot_t* tbevy_sub_app_slot(tbevy_sub_app_t* sub_app, tecs_entity_t main_entity) {
+    uint32_t index = TECS_ENTITY_INDEX(main_entity);
+
+    if (index >= sub_app->slot_capacity) {
+        uint32_t capacity = sub_app->slot_capacity ? sub_app->slot_capacity : 256;
+        while (capacity <= index) capacity *= 2;
+        sub_app->slots = TBEVY_REALLOC(sub_app->slots, capacity * sizeof(tbevy_extract_slot_t));
+        memset(sub_app->slots + sub_app->slot_capacity, 0,
+               (capacity - sub_app->slot_capacity) * sizeof(tbevy_extract_slot_t));
+        sub_app->slot_capacity = capacity;
+    }
+
+    tbevy_extract_slot_t* slot = &sub_app->slots[index];
+    if (slot->main_entity == main_entity) return slot;
+
+    /* Index was recycled by the main world since the last extract */
+    if (slot->main_entity != TECS_ENTITY_NULL)
+        tbevy_sub_app_release_slot(sub_app, slot);
+
+    if (sub_app->live_count >= sub_app->live_capacity) {
+        sub_app->live_capacity = sub_app->live_capacity ? sub_app->live_capacity * 2 : 256;
+        sub_app->live = TBEVY_REALLOC(sub_app->live, sub_app->live_capacity * sizeof(uint32_t));
+    }
+
+    slot->main_entity = main_entity;
+    slot->sub_entity = tecs_entity_new(sub_app->app->world);
+    slot->mask = 0;
+    slot->seen_mask = 0;
+    slot->seen_frame = 0;
+    slot->live_index = sub_app->live_count;
+    sub_app->live[sub_app->live_count++] = index;
+    return slot;
+}
+
+static void tbevy_sub_app_extract(tbevy_sub_app_t* sub_app) {
+    tecs_world_t* main_world = sub_app->main_app->world;
+    tecs_world_t* sub_world = sub_app->app->world;
+    uint32_t frame = ++sub_app->frame;
+
+    for (int k = 0; k < sub_app->component_count; k++) {
+        tbevy_extract_component_t* comp = &sub_app->components[k];
+        uint64_t bit = 1ULL << k;
+
+        tecs_query_iter_t* iter = tecs_query_iter(comp->query);
+        while (tecs_iter_next(iter)) {
+            int count = tecs_iter_count(iter);
+            tecs_entity_t* entities = tecs_iter_entities(iter);
+            int column = tecs_iter_column_index(iter, comp->main_id);
+            const char* data = comp->size > 0 ? (const char*)tecs_iter_column(iter, column) : NULL;
+            const tecs_tick_t* ticks = comp->size > 0 ? tecs_iter_changed_ticks(iter, column) : NULL;
+
+            for (int i = 0; i < count; i++) {
+                tbevy_extract_slot_t* slot = tbevy_sub_app_slot(sub_app, entities[i]);
+                if (slot->seen_frame != frame) {
+                    slot->seen_frame = frame;
+                    slot->seen_mask = 0;
+                }
+                slot->seen_mask |= bit;
+
+                bool added = (slot->mask & bit) == 0;
+                if (comp->size == 0) {
+                    if (added) tecs_add_tag(sub_world, slot->sub_entity, comp->sub_id);
+                    continue;
+                }
+
+                /* Only deltas: rows untouched since the last extract are skipped */
+                if (!added && ticks[i] <= sub_app->last_tick) continue;
+
+                const void* src = data ? data + (size_t)i * comp->size
+                                       : tecs_get(main_world, entities[i], comp->main_id);
+                tecs_set(sub_world, slot->sub_entity, comp->sub_id, src, comp->size);
+            }
+        }
+        tecs_query_iter_free(iter);
+    }
+
+    /* Propagate removed components and despawned entities */
+    for (uint32_t i = sub_app->live_count; i-- > 0;) {
+        tbevy_extract_slot_t* slot = &sub_app->slots[sub_app->live[i]];
+        uint64_t present = slot->seen_frame == frame ? slot->seen_mask : 0;
+
+        if (present == 0) {
+            tbevy_sub_app_release_slot(sub_app, slot);
+            continue;
+        }
+
+        uint64_t removed = slot->mask & ~present;
+        for (int k = 0; removed != 0; k++, removed >>= 1) {
+            if (removed & 1)
+                tecs_unset(sub_world, slot->sub_entity, sub_app->components[k].sub_id);
+        }
+        slot->mask = present;
+    }
+
+    sub_app->last_tick = tecs_world_tick(main_world);
+
+    for (size_t i = 0; i < sub_app->extract_count; i++)
+        sub_app->extract_fns[i](sub_app->main_app, sub_app->app, sub_app->extract_data[i]);
+}
+
+static void tbevy_app_sync_sub_apps(tbevy_app_t* app) {
+    for (size_t i = 0; i < app->sub_app_count; i++) {
+        tbevy_sub_app_t* sub_app = app->sub_apps[i];
+
+        if (!sub_app->threaded) {
+            tbevy_sub_app_extract(sub_app);
+            tbevy_app_update(sub_app->app);
+            continue;
+        }
+
+        /* Previous frame must be done before its world is written again */
+        if (!sub_app->thread) tbevy_sub_app_start_thread(sub_app);
+        tbevy_sub_app_wait(sub_app);
+        tbevy_sub_app_extract(sub_app);
+
+        tecs_mutex_lock(sub_app->mutex);
+        sub_app->frame_pending = true;
+        tecs_cond_broadcast(sub_app->cond);
+        tecs_mutex_unlock(sub_app->mutex);
+    }
+}
+
+/* ============================================================================
+ * Telemetry
+ * ========================================================================= */
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* Seqlock primitives: the block is shared with other processes, so these stay plain
+ * fences instead of going through the core's atomics */
+#if defined(_MSC_VER)
+static uint32_t tbevy_seq_load(const volatile uint32_t* ptr) {
+    uint32_t value = *ptr;
+    _ReadWriteBarrier();
+    return value;
+}
+static void tbevy_seq_store(volatile uint32_t* ptr, uint32_t value) {
+    _ReadWriteBarrier();
+    *ptr = value;
+}
+static void tbevy_seq_fence(void) { MemoryBarrier(); }
+#else
+static uint32_t tbevy_seq_load(const volatile uint32_t* ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static void tbevy_seq_store(volatile uint32_t* ptr, uint32_t value) { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+static void tbevy_seq_fence(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+#endif
+
+struct tbevy_telemetry_writer_s {
+    tbevy_telemetry_t* block;
+    char name[64];
+#if defined(_WIN32)
+    HANDLE mapping;
+#endif
+
+    /* Archetype sweep over table slots, a few rows per frame */
+    int sweep_slot;
+    int sweep_rows;
+    int sweep_chunks;
+    uint64_t sweep_bytes;
+    size_t system_cursor;
+    uint64_t last_commands;
+};
+
+static bool tbevy_telemetry_name(const char* name, char* out, size_t size) {
+    if (!name || !name[0] || strlen(name) + 2 > size) return false;
+#if defined(_WIN32)
+    strcpy(out, name);
+#else
+    out[0] = '/';
+    strcpy(out + (name[0] == '/' ? 0 : 1), name);
+#endif
+    return true;
+}
+
+static void* tbevy_telemetry_map(const char* name, bool create, void** handle) {
+    size_t size = sizeof(tbevy_telemetry_t);
+#if defined(_WIN32)
+    HANDLE mapping = create
+        ? CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, (DWORD)size, name)
+        : OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (!mapping) return NULL;
+    void* view = MapViewOfFile(mapping, create ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, size);
+    if (!view) {
+        CloseHandle(mapping);
+        return NULL;
+    }
+    *handle = mapping;
+    return view;
+#else
+    (void)handle;
+    int fd = create ? shm_open(name, O_CREAT | O_RDWR, 0644) : shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return NULL;
+    }
+    if (create && (size_t)st.st_size < size) {
+        /* Grow by writing the last byte: ftruncate is hidden under strict -std=c99 */
+        char zero = 0;
+        if (lseek(fd, (off_t)size - 1, SEEK_SET) < 0 || write(fd, &zero, 1) != 1) {
+            close(fd);
+            return NULL;
+        }
+    } else if ((size_t)st.st_size < size) {
+        close(fd);
+        return NULL;
+    }
+
+    void* view = mmap(NULL, size, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return view == MAP_FAILED ? NULL : view;
+#endif
+}
+
+static void tbevy_telemetry_unmap(const void* view, void* handle) {
+#if defined(_WIN32)
+    UnmapViewOfFile(view);
+    if (handle) CloseHandle((HANDLE)handle);
+#else
+    (void)handle;
+    munmap((void*)view, sizeof(tbevy_telemetry_t));
+#endif
+}
+
+bool tbevy_app_enable_telemetry(tbevy_app_t* app, const char* name) {
+    char path[64];
+    if (app->telemetry || !tbevy_telemetry_name(name, path, sizeof(path))) return false;
+
+    void* handle = NULL;
+    tbevy_telemetry_t* block = (tbevy_telemetry_t*)tbevy_telemetry_map(path, true, &handle);
+    if (!block) return false;
+
+    tbevy_telemetry_writer_t* writer = TBEVY_CALLOC(1, sizeof(tbevy_telemetry_writer_t));
+    writer->block = block;
+    strcpy(writer->name, path);
+#if defined(_WIN32)
+    writer->mapping = (HANDLE)handle;
+    block->writer_pid = (uint32_t)GetCurrentProcessId();
+#else
+    block->writer_pid = (uint32_t)getpid();
+#endif
+
+    /* Readers ignore the block until the magic appears */
+    tbevy_seq_store(&block->sequence, 1);
+    block->version = TBEVY_TELEMETRY_VERSION;
+    block->size = (uint32_t)sizeof(tbevy_telemetry_t);
+    block->archetype_capacity = TBEVY_TELEMETRY_ARCHETYPES;
+    block->system_capacity = TBEVY_TELEMETRY_SYSTEMS;
+    block->archetype_rows = 0;
+    block->system_rows = 0;
+    block->frame = 0;
+    tbevy_seq_fence();
+    block->magic = TBEVY_TELEMETRY_MAGIC;
+    tbevy_seq_store(&block->sequence, 2);
+
+    writer->last_commands = app->scheduler_stats.commands;
+    app->telemetry = writer;
+    return true;
+}
+
+void tbevy_app_disable_telemetry(tbevy_app_t* app) {
+    tbevy_telemetry_writer_t* writer = app->telemetry;
+    if (!writer) return;
+
+#if defined(_WIN32)
+    tbevy_telemetry_unmap(writer->block, writer->mapping);
+#else
+    tbevy_telemetry_unmap(writer->block, NULL);
+    shm_unlink(writer->name);
+#endif
+    TBEVY_FREE(writer);
+    app->telemetry = NULL;
+}
+
+/* Next few live archetypes of the current sweep */
+static void tbevy_telemetry_sweep_archetypes(tbevy_telemetry_writer_t* writer,
+                                             tecs_world_t* world, uint32_t frame) {
+    tbevy_telemetry_t* block = writer->block;
+    int slots = tecs_world_archetype_slots(world);
+    int sampled = 0;
+
+    /* Bound the slots visited too, so a sparse table does not stall a frame */
+    for (int visited = 0; visited < TBEVY_TELEMETRY_ROWS_PER_FRAME * 8 &&
+                          sampled < TBEVY_TELEMETRY_ROWS_PER_FRAME; visited++) {
+        if (writer->sweep_slot >= slots) {
+            block->archetype_rows = writer->sweep_rows;
+            block->chunk_count = writer->sweep_chunks;
+            block->memory_bytes = writer->sweep_bytes;
+            writer->sweep_slot = 0;
+            writer->sweep_rows = 0;
+            writer->sweep_chunks = 0;
+            writer->sweep_bytes = 0;
+            break;
+        }
+
+        tecs_archetype_info_t info;
+        if (!tecs_world_archetype_info(world, writer->sweep_slot++, &info)) continue;
+        sampled++;
+        writer->sweep_chunks += info.chunk_count;
+        writer->sweep_bytes += info.bytes;
+        if (writer->sweep_rows >= TBEVY_TELEMETRY_ARCHETYPES) continue;
+
+        tbevy_telemetry_archetype_t* row = &block->archetypes[writer->sweep_rows++];
+        row->archetype_id = info.archetype_id;
+        row->bytes = info.bytes;
+        row->entity_count = info.entity_count;
+        row->chunk_count = info.chunk_count;
+        row->component_count = info.component_count;
+        row->sampled_frame = frame;
+        if (writer->sweep_rows > block->archetype_rows) block->archetype_rows = writer->sweep_rows;
+    }
+}
+
+static void tbevy_telemetry_sample_systems(tbevy_telemetry_writer_t* writer,
+                                           const tbevy_system_list_t* systems, uint32_t frame) {
+    tbevy_telemetry_t* block = writer->block;
+    size_t count = systems->count < TBEVY_TELEMETRY_SYSTEMS ? systems->count : TBEVY_TELEMETRY_SYSTEMS;
+    block->system_rows = (int32_t)count;
+
+    for (int i = 0; i < TBEVY_TELEMETRY_ROWS_PER_FRAME && count > 0; i++) {
+        if (writer->system_cursor >= count) writer->system_cursor = 0;
+        const tbevy_system_t* sys = systems->systems[writer->system_cursor];
+        tbevy_telemetry_system_t* row = &block->systems[writer->system_cursor++];
+
+        size_t length = strlen(sys->label);
+        if (length >= sizeof(row->label)) length = sizeof(row->label) - 1;
+        memcpy(row->label, sys->label, length);
+        row->label[length] = '\0';
+        row->run_count = sys->stats.run_count;
+        row->overrun_count = sys->stats.overrun_count;
+        row->last_ms = sys->stats.last_ms;
+        row->max_ms = sys->stats.max_ms;
+        row->total_ms = sys->stats.total_ms;
+        row->sampled_frame = frame;
+        row->declaration_order = (uint32_t)sys->declaration_order;
+    }
+}
+
+static void tbevy_telemetry_publish(tbevy_app_t* app, uint64_t start_ns) {
+    tbevy_telemetry_writer_t* writer = app->telemetry;
+    tbevy_telemetry_t* block = writer->block;
+    const tbevy_scheduler_stats_t* stats = &app->scheduler_stats;
+    uint64_t publish_start = tecs_time_ns();
+    uint32_t sequence = block->sequence;
+
+    tbevy_seq_store(&block->sequence, sequence + 1);
+    tbevy_seq_fence();
+
+    uint64_t frame = block->frame + 1;
+    block->frame = frame;
+    block->timestamp_ns = publish_start;
+    block->frame_ms = (double)(publish_start - start_ns) / 1e6;
+    block->entity_count = tecs_world_entity_count(app->world);
+    block->archetype_count = tecs_world_archetype_count(app->world);
+    block->system_count = (int32_t)app->all_systems.count;
+    block->commands_frame = stats->commands >= writer->last_commands
+        ? stats->commands - writer->last_commands : stats->commands;
+    writer->last_commands = stats->commands;
+    block->commands = stats->commands;
+    block->batches = stats->batches;
+    block->steals = stats->steals;
+    block->apply_ms = stats->apply_ms;
+    block->batch_ms = stats->batch_ms;
+    block->barrier_ms = stats->barrier_ms;
+    block->serial_ms = stats->serial_ms;
+
+    tbevy_telemetry_sweep_archetypes(writer, app->world, (uint32_t)frame);
+    tbevy_telemetry_sample_systems(writer, &app->all_systems, (uint32_t)frame);
+
+    block->publish_ns = tecs_time_ns() - publish_start;
+    tbevy_seq_store(&block->sequence, sequence + 2);
+}
+
+const tbevy_telemetry_t* tbevy_telemetry_open(const char* name) {
+    char path[64];
+    if (!tbevy_telemetry_name(name, path, sizeof(path))) return NULL;
+
+    void* handle = NULL;
+    const tbevy_telemetry_t* block = (const tbevy_telemetry_t*)tbevy_telemetry_map(path, false, &handle);
+    if (!block) return NULL;
+#if defined(_WIN32)
+    /* The view keeps the mapping alive */
+    CloseHandle((HANDLE)handle);
+#endif
+
+    if (block->magic != TBEVY_TELEMETRY_MAGIC || block->version != TBEVY_TELEMETRY_VERSION ||
+        block->size != sizeof(tbevy_telemetry_t)) {
+        tbevy_telemetry_unmap(block, NULL);
+        return NULL;
+    }
+    return block;
+}
+
+bool tbevy_telemetry_read(const tbevy_telemetry_t* block, tbevy_telemetry_t* out) {
+    for (int attempt = 0; attempt < 1000; attempt++) {
+        uint32_t before = tbevy_seq_load(&block->sequence);
+        if (before & 1) continue;
+
+        memcpy(out, (const void*)block, sizeof(tbevy_telemetry_t));
+        tbevy_seq_fence();
+        if (tbevy_seq_load(&block->sequence) == before) return true;
+    }
+    return false;
+}
+
+void tbevy_telemetry_close(const tbevy_telemetry_t* block) {
+    if (block) tbevy_telemetry_unmap(block, NULL);
+}
+
 /* ============================================================================
  * Bundles
  * ========================================================================= */
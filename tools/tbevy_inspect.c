@@ -0,0 +1,188 @@
+/*
+ * tbevy_inspect - reads the live telemetry block of a running tbevy app
+ *
+ * The app publishes with tbevy_app_enable_telemetry(app, "name"); this tool maps the
+ * same segment read-only and never blocks the app.
+ *
+ * Usage: tbevy_inspect <name> [--watch <ms>] [--json] [--top <n>]
+ *   --watch  Print again every <ms> milliseconds until interrupted
+ *   --json   One JSON object per sample instead of tables
+ *   --top    Archetypes and systems listed (default 10)
+ */
+
+#define _POSIX_C_SOURCE 200809L  /* nanosleep */
+
+#define TINYECS_IMPLEMENTATION
+#define TINYECS_BEVY_IMPLEMENTATION
+#include "tinyecs.h"
+#include "tinyecs_bevy.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+static void sleep_ms(int ms) { Sleep((DWORD)ms); }
+#else
+#include <time.h>
+static void sleep_ms(int ms) {
+    struct timespec ts = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    nanosleep(&ts, NULL);
+}
+#endif
+
+/* Indices of the `top` largest archetypes by entity count */
+static int top_archetypes(const tbevy_telemetry_t* block, int* order, int top) {
+    int count = 0;
+    for (int i = 0; i < block->archetype_rows; i++) {
+        int pos = count < top ? count++ : top;
+        if (pos == top && block->archetypes[i].entity_count <= block->archetypes[order[top - 1]].entity_count)
+            continue;
+        if (pos == top) pos = top - 1;
+        while (pos > 0 && block->archetypes[order[pos - 1]].entity_count < block->archetypes[i].entity_count) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+    return count;
+}
+
+/* Indices of the `top` most expensive systems by last run time */
+static int top_systems(const tbevy_telemetry_t* block, int* order, int top) {
+    int count = 0;
+    for (int i = 0; i < block->system_rows; i++) {
+        int pos = count < top ? count++ : top;
+        if (pos == top && block->systems[i].last_ms <= block->systems[order[top - 1]].last_ms)
+            continue;
+        if (pos == top) pos = top - 1;
+        while (pos > 0 && block->systems[order[pos - 1]].last_ms < block->systems[i].last_ms) {
+            order[pos] = order[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+    }
+    return count;
+}
+
+static void print_text(const tbevy_telemetry_t* block, double fps, int top) {
+    int order[TBEVY_TELEMETRY_ARCHETYPES > TBEVY_TELEMETRY_SYSTEMS ? TBEVY_TELEMETRY_ARCHETYPES
+                                                                   : TBEVY_TELEMETRY_SYSTEMS];
+
+    printf("frame %llu  pid %u  fps %.1f  frame %.3f ms  publish %llu ns\n",
+           (unsigned long long)block->frame, block->writer_pid, fps, block->frame_ms,
+           (unsigned long long)block->publish_ns);
+    printf("entities %d  archetypes %d  chunks %d  memory %.2f MiB\n", block->entity_count,
+           block->archetype_count, block->chunk_count, (double)block->memory_bytes / (1024.0 * 1024.0));
+    printf("commands %llu (%llu last frame)  batches %llu  steals %llu\n",
+           (unsigned long long)block->commands, (unsigned long long)block->commands_frame,
+           (unsigned long long)block->batches, (unsigned long long)block->steals);
+    printf("apply %.3f ms  batch %.3f ms  barrier %.3f ms  serial %.3f ms (totals)\n",
+           block->apply_ms, block->batch_ms, block->barrier_ms, block->serial_ms);
+
+    int count = top_archetypes(block, order, top);
+    printf("\n%-16s %10s %7s %6s %12s\n", "archetype", "entities", "chunks", "comps", "bytes");
+    for (int i = 0; i < count; i++) {
+        const tbevy_telemetry_archetype_t* row = &block->archetypes[order[i]];
+        printf("%016llx %10d %7d %6d %12llu\n", (unsigned long long)row->archetype_id,
+               row->entity_count, row->chunk_count, row->component_count,
+               (unsigned long long)row->bytes);
+    }
+
+    count = top_systems(block, order, top);
+    printf("\n%-32s %10s %10s %10s %9s\n", "system", "last ms", "max ms", "runs", "overruns");
+    for (int i = 0; i < count; i++) {
+        const tbevy_telemetry_system_t* row = &block->systems[order[i]];
+        char label[48];
+        if (row->label[0]) snprintf(label, sizeof(label), "%s", row->label);
+        else snprintf(label, sizeof(label), "#%u", row->declaration_order);
+        printf("%-32s %10.3f %10.3f %10llu %9llu\n", label, row->last_ms, row->max_ms,
+               (unsigned long long)row->run_count, (unsigned long long)row->overrun_count);
+    }
+    printf("\n");
+}
+
+static void print_json(const tbevy_telemetry_t* block, double fps, int top) {
+    int order[TBEVY_TELEMETRY_ARCHETYPES > TBEVY_TELEMETRY_SYSTEMS ? TBEVY_TELEMETRY_ARCHETYPES
+                                                                   : TBEVY_TELEMETRY_SYSTEMS];
+
+    printf("{\"frame\": %llu, \"pid\": %u, \"fps\": %.2f, \"frame_ms\": %.4f, \"publish_ns\": %llu, ",
+           (unsigned long long)block->frame, block->writer_pid, fps, block->frame_ms,
+           (unsigned long long)block->publish_ns);
+    printf("\"entities\": %d, \"archetypes\": %d, \"chunks\": %d, \"memory_bytes\": %llu, ",
+           block->entity_count, block->archetype_count, block->chunk_count,
+           (unsigned long long)block->memory_bytes);
+    printf("\"commands\": %llu, \"commands_frame\": %llu, \"batches\": %llu, \"steals\": %llu, ",
+           (unsigned long long)block->commands, (unsigned long long)block->commands_frame,
+           (unsigned long long)block->batches, (unsigned long long)block->steals);
+    printf("\"apply_ms\": %.4f, \"batch_ms\": %.4f, \"barrier_ms\": %.4f, \"serial_ms\": %.4f, ",
+           block->apply_ms, block->batch_ms, block->barrier_ms, block->serial_ms);
+
+    int count = top_archetypes(block, order, top);
+    printf("\"top_archetypes\": [");
+    for (int i = 0; i < count; i++) {
+        const tbevy_telemetry_archetype_t* row = &block->archetypes[order[i]];
+        printf("%s{\"id\": \"%llx\", \"entities\": %d, \"chunks\": %d, \"bytes\": %llu}", i ? ", " : "",
+               (unsigned long long)row->archetype_id, row->entity_count, row->chunk_count,
+               (unsigned long long)row->bytes);
+    }
+
+    count = top_systems(block, order, top);
+    printf("], \"top_systems\": [");
+    for (int i = 0; i < count; i++) {
+        const tbevy_telemetry_system_t* row = &block->systems[order[i]];
+        printf("%s{\"label\": \"%s\", \"order\": %u, \"last_ms\": %.4f, \"max_ms\": %.4f, \"runs\": %llu}",
+               i ? ", " : "", row->label, row->declaration_order, row->last_ms, row->max_ms,
+               (unsigned long long)row->run_count);
+    }
+    printf("]}\n");
+}
+
+int main(int argc, char** argv) {
+    const char* name = NULL;
+    int watch_ms = 0;
+    int top = 10;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--watch") == 0 && i + 1 < argc) watch_ms = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) top = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (!name) name = argv[i];
+    }
+    if (!name) {
+        fprintf(stderr, "usage: %s <name> [--watch <ms>] [--json] [--top <n>]\n", argv[0]);
+        return 2;
+    }
+    if (top < 1) top = 1;
+    if (top > TBEVY_TELEMETRY_SYSTEMS) top = TBEVY_TELEMETRY_SYSTEMS;
+
+    const tbevy_telemetry_t* shared = tbevy_telemetry_open(name);
+    if (!shared) {
+        fprintf(stderr, "no telemetry block named '%s' (or built with a different layout)\n", name);
+        return 1;
+    }
+
+    tbevy_telemetry_t* block = malloc(sizeof(tbevy_telemetry_t));
+    uint64_t last_frame = 0, last_ns = 0;
+    do {
+        if (!tbevy_telemetry_read(shared, block)) {
+            fprintf(stderr, "writer busy, retrying\n");
+        } else {
+            double fps = 0.0;
+            if (last_ns && block->timestamp_ns > last_ns)
+                fps = (double)(block->frame - last_frame) * 1e9 / (double)(block->timestamp_ns - last_ns);
+            last_frame = block->frame;
+            last_ns = block->timestamp_ns;
+
+            if (json) print_json(block, fps, top);
+            else print_text(block, fps, top);
+            fflush(stdout);
+        }
+        if (watch_ms > 0) sleep_ms(watch_ms);
+    } while (watch_ms > 0);
+
+    free(block);
+    tbevy_telemetry_close(shared);
+    return 0;
+}
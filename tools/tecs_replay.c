@@ -0,0 +1,499 @@
+/*
+ * tecs_replay - re-executes an API trace recorded with tecs_trace_begin and times it
+ *
+ * The trace is decoded up front; replay then issues the same structural calls against
+ * a fresh world of this build. Component values are not part of a trace, so sets write
+ * zeroes; iteration passes read every row of their data columns. Entities the library
+ * created on its own (migrations, region loads) are spawned when first referenced.
+ *
+ * Usage: tecs_replay <trace> [--repeat <n>] [--json]
+ *   --repeat  Replay the trace n times, each against a fresh world (default 1)
+ *   --json    One JSON object instead of tables
+ */
+
+#define TINYECS_IMPLEMENTATION
+#include "tinyecs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OP_KINDS (TECS_TRACE_FRAME + 1)
+
+static const char* op_names[OP_KINDS] = {
+    "", "register", "spawn", "spawn_id", "delete", "set", "unset", "add_child", "remove_child",
+    "remove_children", "defer_begin", "defer_end", "query", "iter", "frame"
+};
+
+typedef struct {
+    int op;
+    uint64_t a, b, c;  /* Entities are slots, queries their trace number */
+} op_t;
+
+typedef struct {
+    char* name;
+    int size;
+    bool boxed;
+} component_t;
+
+typedef struct {
+    op_t* ops;
+    int op_count;
+    component_t* components;
+    int component_count;
+    uint64_t* terms;           /* QUERY operands: {type, component} pairs, ops index into it */
+    int term_count;
+    uint64_t* entity_ids;      /* Recorded ID of each slot */
+    int slot_count;
+    uint32_t query_count;
+    uint64_t op_counts[OP_KINDS];
+    uint64_t recorded_rows;
+    uint64_t recorded_frame_ns;
+    int frames;
+} trace_t;
+
+/* ============================================================================
+ * Decoding
+ * ========================================================================= */
+
+typedef struct {
+    const unsigned char* pos;
+    const unsigned char* end;
+    bool bad;
+} reader_t;
+
+static uint64_t read_u64(reader_t* r) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (r->pos >= r->end) {
+            r->bad = true;
+            return 0;
+        }
+        unsigned char byte = *r->pos++;
+        value |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return value;
+    }
+    r->bad = true;
+    return 0;
+}
+
+/* Recorded entity ID -> slot, open addressing */
+typedef struct {
+    uint64_t* keys;
+    int* slots;
+    int capacity;
+} slot_map_t;
+
+static int slot_of(trace_t* trace, slot_map_t* map, uint64_t id) {
+    if (trace->slot_count * 2 >= map->capacity) {
+        slot_map_t grown = {calloc((size_t)map->capacity * 2, sizeof(uint64_t)),
+                            calloc((size_t)map->capacity * 2, sizeof(int)), map->capacity * 2};
+        for (int i = 0; i < map->capacity; i++) {
+            if (!map->keys[i]) continue;
+            size_t h = (size_t)(map->keys[i] * 0x9E3779B97F4A7C15ull) & (size_t)(grown.capacity - 1);
+            while (grown.keys[h]) h = (h + 1) & (size_t)(grown.capacity - 1);
+            grown.keys[h] = map->keys[i];
+            grown.slots[h] = map->slots[i];
+        }
+        free(map->keys);
+        free(map->slots);
+        *map = grown;
+        trace->entity_ids = realloc(trace->entity_ids, (size_t)map->capacity * sizeof(uint64_t));
+    }
+
+    size_t h = (size_t)(id * 0x9E3779B97F4A7C15ull) & (size_t)(map->capacity - 1);
+    while (map->keys[h]) {
+        if (map->keys[h] == id) return map->slots[h];
+        h = (h + 1) & (size_t)(map->capacity - 1);
+    }
+    map->keys[h] = id;
+    map->slots[h] = trace->slot_count;
+    trace->entity_ids[trace->slot_count] = id;
+    return trace->slot_count++;
+}
+
+static op_t* push_op(trace_t* trace, int* capacity, int op) {
+    if (trace->op_count >= *capacity) {
+        *capacity *= 2;
+        trace->ops = realloc(trace->ops, (size_t)*capacity * sizeof(op_t));
+    }
+    op_t* o = &trace->ops[trace->op_count++];
+    memset(o, 0, sizeof(*o));
+    o->op = op;
+    trace->op_counts[op]++;
+    return o;
+}
+
+static bool decode(const unsigned char* data, size_t size, trace_t* trace, char* error, size_t error_size) {
+    memset(trace, 0, sizeof(*trace));
+    if (size < 8 || memcmp(data, TECS_TRACE_MAGIC, 8) != 0) {
+        snprintf(error, error_size, "not a tecs trace");
+        return false;
+    }
+
+    int op_capacity = 1024, term_capacity = 64, component_capacity = 16;
+    trace->ops = malloc((size_t)op_capacity * sizeof(op_t));
+    trace->terms = malloc((size_t)term_capacity * sizeof(uint64_t));
+    trace->components = malloc((size_t)component_capacity * sizeof(component_t));
+    slot_map_t map = {calloc(1024, sizeof(uint64_t)), calloc(1024, sizeof(int)), 1024};
+    trace->entity_ids = malloc(1024 * sizeof(uint64_t));
+
+    reader_t r = {data + 8, data + size, false};
+    while (r.pos < r.end && !r.bad) {
+        int op = *r.pos++;
+        if (op < TECS_TRACE_REGISTER || op > TECS_TRACE_FRAME) {
+            snprintf(error, error_size, "unknown record %d at byte %ld", op, (long)(r.pos - 1 - data));
+            return false;
+        }
+
+        if (op == TECS_TRACE_REGISTER) {
+            if (trace->component_count >= component_capacity) {
+                component_capacity *= 2;
+                trace->components = realloc(trace->components, (size_t)component_capacity * sizeof(component_t));
+            }
+            component_t* c = &trace->components[trace->component_count++];
+            c->name = NULL;
+            c->size = (int)read_u64(&r);
+            c->boxed = (read_u64(&r) & 1) != 0;
+            uint64_t length = read_u64(&r);
+            if (length > (uint64_t)(r.end - r.pos)) {
+                r.bad = true;
+                break;
+            }
+            c->name = malloc((size_t)length + 1);
+            memcpy(c->name, r.pos, (size_t)length);
+            c->name[length] = '\0';
+            r.pos += length;
+            trace->op_counts[op]++;
+            continue;
+        }
+
+        op_t* o = push_op(trace, &op_capacity, op);
+        switch (op) {
+            case TECS_TRACE_SPAWN:
+            case TECS_TRACE_SPAWN_ID:
+            case TECS_TRACE_DELETE:
+            case TECS_TRACE_REMOVE_CHILDREN:
+                o->a = (uint64_t)slot_of(trace, &map, read_u64(&r));
+                break;
+            case TECS_TRACE_SET:
+            case TECS_TRACE_UNSET:
+                o->a = (uint64_t)slot_of(trace, &map, read_u64(&r));
+                o->b = read_u64(&r);
+                if (o->b >= (uint64_t)trace->component_count) r.bad = true;
+                break;
+            case TECS_TRACE_ADD_CHILD:
+            case TECS_TRACE_REMOVE_CHILD:
+                o->a = (uint64_t)slot_of(trace, &map, read_u64(&r));
+                o->b = (uint64_t)slot_of(trace, &map, read_u64(&r));
+                break;
+            case TECS_TRACE_QUERY: {
+                o->a = read_u64(&r);
+                o->b = read_u64(&r);
+                o->c = (uint64_t)trace->term_count;
+                if (o->b > TECS_MAX_QUERY_TERMS || o->a == 0) {
+                    r.bad = true;
+                    break;
+                }
+                if (o->a > trace->query_count) trace->query_count = (uint32_t)o->a;
+                while (trace->term_count + 2 * (int)o->b > term_capacity) {
+                    term_capacity *= 2;
+                    trace->terms = realloc(trace->terms, (size_t)term_capacity * sizeof(uint64_t));
+                }
+                for (uint64_t t = 0; t < o->b; t++) {
+                    trace->terms[trace->term_count++] = read_u64(&r);
+                    trace->terms[trace->term_count] = read_u64(&r);
+                    if (trace->terms[trace->term_count++] >= (uint64_t)trace->component_count) r.bad = true;
+                }
+                break;
+            }
+            case TECS_TRACE_ITER:
+                o->a = read_u64(&r);
+                o->b = read_u64(&r);
+                o->c = read_u64(&r);
+                if (o->a == 0 || o->a > trace->query_count) r.bad = true;
+                trace->recorded_rows += o->c;
+                break;
+            case TECS_TRACE_FRAME:
+                o->a = read_u64(&r);
+                trace->recorded_frame_ns += o->a;
+                trace->frames++;
+                break;
+            default:
+                break;
+        }
+    }
+
+    free(map.keys);
+    free(map.slots);
+    if (r.bad) {
+        snprintf(error, error_size, "truncated or corrupt record at byte %ld", (long)(r.pos - data));
+        return false;
+    }
+    return true;
+}
+
+/* ============================================================================
+ * Replay
+ * ========================================================================= */
+
+typedef struct {
+    double total_ms;
+    double* frame_ms;          /* Replayed time between FRAME records */
+    uint64_t rows;
+    uint64_t spawned_late;     /* Entities first seen after their creation */
+} run_t;
+
+static volatile uint64_t touch_sink;
+
+static tecs_entity_t live_entity(tecs_world_t* world, tecs_entity_t* live, uint64_t slot, run_t* run) {
+    if (!live[slot]) {
+        live[slot] = tecs_entity_new(world);
+        run->spawned_late++;
+    }
+    return live[slot];
+}
+
+static void replay(const trace_t* trace, run_t* run) {
+    tecs_world_t* world = tecs_world_new();
+    tecs_component_id_t* ids = malloc((size_t)(trace->component_count + 1) * sizeof(tecs_component_id_t));
+    int max_size = 1;
+    for (int i = 0; i < trace->component_count; i++) {
+        const component_t* c = &trace->components[i];
+        ids[i] = c->boxed ? tecs_register_component_boxed(world, c->name, c->size)
+                          : tecs_register_component(world, c->name, c->size);
+        if (c->size > max_size) max_size = c->size;
+    }
+    void* zero = calloc(1, (size_t)max_size);
+    tecs_entity_t* live = calloc((size_t)trace->slot_count + 1, sizeof(tecs_entity_t));
+    tecs_query_t** queries = calloc((size_t)trace->query_count + 1, sizeof(tecs_query_t*));
+    const op_t** definitions = calloc((size_t)trace->query_count + 1, sizeof(op_t*));
+
+    int frame = 0;
+    uint64_t sink = 0;
+    uint64_t start = tecs_time_ns();
+    uint64_t frame_start = start;
+
+    for (int i = 0; i < trace->op_count; i++) {
+        const op_t* o = &trace->ops[i];
+        switch (o->op) {
+            case TECS_TRACE_SPAWN:
+                live[o->a] = tecs_entity_new(world);
+                break;
+            case TECS_TRACE_SPAWN_ID:
+                live[o->a] = tecs_entity_new_with_id(world, trace->entity_ids[o->a]);
+                if (!live[o->a]) live[o->a] = tecs_entity_new(world);
+                break;
+            case TECS_TRACE_DELETE:
+                if (live[o->a]) tecs_entity_delete(world, live[o->a]);
+                live[o->a] = TECS_ENTITY_NULL;
+                break;
+            case TECS_TRACE_SET: {
+                int size = trace->components[o->b].size;
+                tecs_set(world, live_entity(world, live, o->a, run), ids[o->b], size ? zero : NULL, size);
+                break;
+            }
+            case TECS_TRACE_UNSET:
+                if (live[o->a]) tecs_unset(world, live[o->a], ids[o->b]);
+                break;
+            case TECS_TRACE_ADD_CHILD:
+                tecs_add_child(world, live_entity(world, live, o->a, run), live_entity(world, live, o->b, run));
+                break;
+            case TECS_TRACE_REMOVE_CHILD:
+                if (live[o->a] && live[o->b]) tecs_remove_child(world, live[o->a], live[o->b]);
+                break;
+            case TECS_TRACE_REMOVE_CHILDREN:
+                if (live[o->a]) tecs_remove_all_children(world, live[o->a]);
+                break;
+            case TECS_TRACE_DEFER_BEGIN:
+                tecs_begin_deferred(world);
+                break;
+            case TECS_TRACE_DEFER_END:
+                tecs_end_deferred(world);
+                break;
+            case TECS_TRACE_QUERY: {
+                if (queries[o->a]) tecs_query_free(queries[o->a]);
+                tecs_query_t* query = queries[o->a] = tecs_query_new(world);
+                definitions[o->a] = o;
+                for (uint64_t t = 0; t < o->b; t++) {
+                    uint64_t type = trace->terms[o->c + 2 * t];
+                    tecs_component_id_t id = ids[trace->terms[o->c + 2 * t + 1]];
+                    switch (type) {
+                        case TECS_TERM_WITHOUT: tecs_query_without(query, id); break;
+                        case TECS_TERM_OPTIONAL: tecs_query_optional(query, id); break;
+                        case TECS_TERM_CHANGED: tecs_query_changed(query, id); break;
+                        case TECS_TERM_ADDED: tecs_query_added(query, id); break;
+                        default: tecs_query_with(query, id); break;
+                    }
+                }
+                tecs_query_build(query);
+                break;
+            }
+            case TECS_TRACE_ITER: {
+                const op_t* definition = definitions[o->a];
+                if (!definition) break;
+
+                /* Read every row of the data columns, like a system would */
+                const uint64_t* terms = trace->terms + definition->c;
+                tecs_query_iter_t iter;
+                tecs_query_iter_init(&iter, queries[o->a]);
+                while (tecs_iter_next(&iter)) {
+                    int count = tecs_iter_count(&iter);
+                    for (uint64_t t = 0; t < definition->b; t++) {
+                        const component_t* c = &trace->components[terms[2 * t + 1]];
+                        if (terms[2 * t] == TECS_TERM_WITHOUT || c->size == 0) continue;
+                        int column = tecs_iter_column_index(&iter, ids[terms[2 * t + 1]]);
+                        if (column < 0) continue;
+                        if (c->boxed) {
+                            void** boxes = tecs_iter_boxed(&iter, column);
+                            for (int row = 0; boxes && row < count; row++) {
+                                if (boxes[row]) sink += *(const unsigned char*)boxes[row];
+                            }
+                        } else {
+                            const unsigned char* data = tecs_iter_column(&iter, column);
+                            for (int row = 0; data && row < count; row++) sink += data[(size_t)row * (size_t)c->size];
+                        }
+                    }
+                    run->rows += (uint64_t)count;
+                }
+                break;
+            }
+            case TECS_TRACE_FRAME: {
+                tecs_world_update(world);
+                uint64_t now = tecs_time_ns();
+                run->frame_ms[frame++] = (double)(now - frame_start) / 1e6;
+                frame_start = now;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    run->total_ms = (double)(tecs_time_ns() - start) / 1e6;
+    touch_sink = sink;
+
+    for (uint32_t q = 1; q <= trace->query_count; q++) {
+        if (queries[q]) tecs_query_free(queries[q]);
+    }
+    free(queries);
+    free(definitions);
+    free(live);
+    free(zero);
+    free(ids);
+    tecs_world_free(world);
+}
+
+/* ============================================================================
+ * Report
+ * ========================================================================= */
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    const char* path = NULL;
+    int repeat = 1;
+    bool json = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) repeat = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (!path) path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "usage: %s <trace> [--repeat <n>] [--json]\n", argv[0]);
+        return 2;
+    }
+    if (repeat < 1) repeat = 1;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "cannot open '%s'\n", path);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* data = malloc(size > 0 ? (size_t)size : 1);
+    size_t read = fread(data, 1, size > 0 ? (size_t)size : 0, file);
+    fclose(file);
+
+    trace_t trace;
+    char error[128];
+    if (size <= 0 || read != (size_t)size || !decode(data, read, &trace, error, sizeof(error))) {
+        fprintf(stderr, "%s: %s\n", path, size <= 0 || read != (size_t)size ? "read failed" : error);
+        return 1;
+    }
+    free(data);
+
+    /* Frame times of all runs pooled; totals from the fastest run */
+    int frames = trace.frames;
+    double* frame_ms = malloc((size_t)(frames * repeat + 1) * sizeof(double));
+    double best_ms = 0.0, sum_ms = 0.0;
+    run_t run = {0};
+    for (int n = 0; n < repeat; n++) {
+        run_t current = {0, frame_ms + (size_t)n * (size_t)frames, 0, 0};
+        replay(&trace, &current);
+        sum_ms += current.total_ms;
+        if (n == 0 || current.total_ms < best_ms) best_ms = current.total_ms;
+        run.rows = current.rows;
+        run.spawned_late = current.spawned_late;
+    }
+
+    double frame_mean = 0.0, frame_p50 = 0.0, frame_p99 = 0.0, frame_max = 0.0;
+    if (frames > 0) {
+        int pooled = frames * repeat;
+        for (int i = 0; i < pooled; i++) frame_mean += frame_ms[i];
+        frame_mean /= pooled;
+        qsort(frame_ms, (size_t)pooled, sizeof(double), compare_double);
+        frame_p50 = frame_ms[pooled / 2];
+        frame_p99 = frame_ms[(int)((pooled - 1) * 0.99)];
+        frame_max = frame_ms[pooled - 1];
+    }
+    double recorded_frame_ms = frames > 0 ? (double)trace.recorded_frame_ns / 1e6 / frames : 0.0;
+    double ops_per_s = best_ms > 0.0 ? trace.op_count / (best_ms / 1000.0) : 0.0;
+
+    if (json) {
+        printf("{\"trace\": \"%s\", \"ops\": %d, \"components\": %d, \"entities\": %d, \"queries\": %u, ",
+               path, trace.op_count, trace.component_count, trace.slot_count, trace.query_count);
+        printf("\"repeat\": %d, \"best_ms\": %.4f, \"mean_ms\": %.4f, \"ops_per_s\": %.0f, ",
+               repeat, best_ms, sum_ms / repeat, ops_per_s);
+        printf("\"frames\": %d, \"frame_mean_ms\": %.4f, \"frame_p50_ms\": %.4f, \"frame_p99_ms\": %.4f, "
+               "\"frame_max_ms\": %.4f, \"recorded_frame_ms\": %.4f, ",
+               frames, frame_mean, frame_p50, frame_p99, frame_max, recorded_frame_ms);
+        printf("\"recorded_rows\": %llu, \"replayed_rows\": %llu, \"spawned_late\": %llu, \"counts\": {",
+               (unsigned long long)trace.recorded_rows, (unsigned long long)run.rows,
+               (unsigned long long)run.spawned_late);
+        for (int op = 1; op < OP_KINDS; op++) {
+            printf("%s\"%s\": %llu", op > 1 ? ", " : "", op_names[op], (unsigned long long)trace.op_counts[op]);
+        }
+        printf("}}\n");
+    } else {
+        printf("trace %s  ops %d  components %d  entities %d  queries %u\n", path, trace.op_count,
+               trace.component_count, trace.slot_count, trace.query_count);
+        printf("replay %.3f ms best, %.3f ms mean over %d run(s)  %.0f ops/s\n", best_ms, sum_ms / repeat,
+               repeat, ops_per_s);
+        if (frames > 0) {
+            printf("frames %d  mean %.3f  p50 %.3f  p99 %.3f  max %.3f ms  (recorded mean %.3f ms)\n", frames,
+                   frame_mean, frame_p50, frame_p99, frame_max, recorded_frame_ms);
+        }
+        printf("rows iterated %llu (recorded %llu)", (unsigned long long)run.rows,
+               (unsigned long long)trace.recorded_rows);
+        if (run.spawned_late) printf("  late spawns %llu", (unsigned long long)run.spawned_late);
+        printf("\n\n%-16s %12s\n", "record", "count");
+        for (int op = 1; op < OP_KINDS; op++) {
+            if (trace.op_counts[op]) printf("%-16s %12llu\n", op_names[op], (unsigned long long)trace.op_counts[op]);
+        }
+    }
+
+    free(frame_ms);
+    free(trace.ops);
+    free(trace.terms);
+    for (int i = 0; i < trace.component_count; i++) free(trace.components[i].name);
+    free(trace.components);
+    free(trace.entity_ids);
+    return 0;
+}